@@ -0,0 +1,18 @@
+/*
+ *          Copyright Andrey Semashev 2007 - 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <nmmintrin.h>
+#include <stdio.h>
+
+int main(int, char*[])
+{
+    __m128i mm = _mm_setzero_si128();
+    fread(&mm, 1u, sizeof(mm), stdin);
+    int n = _mm_cmpestri(mm, 4, mm, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+    fwrite(&n, 1u, sizeof(n), stdout);
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_record_codec.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_DETAIL_BINARY_RECORD_CODEC_HPP_INCLUDED_
+#define BOOST_LOG_DETAIL_BINARY_RECORD_CODEC_HPP_INCLUDED_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+/*!
+ * Serializes attribute values into the binary record format and appends the result to \a buffer.
+ * Only the values with the names listed in \a names are serialized. If \a names is empty, all
+ * values are serialized. Values of types not supported by the format are skipped, unless a string
+ * conversion is registered for the type with \c register_binary_string_conversion.
+ */
+BOOST_LOG_API void encode_binary_record(attribute_value_set const& values, std::vector< attribute_name > const& names, std::string& buffer);
+
+/*!
+ * Deserializes a record in the binary record format and inserts the attribute values into \a values.
+ * Throws \c parse_error if the record is malformed or has an unsupported version.
+ */
+BOOST_LOG_API void decode_binary_record(const void* data, std::size_t size, attribute_value_set& values);
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_DETAIL_BINARY_RECORD_CODEC_HPP_INCLUDED_
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <locale>
+#include <utility>
 #include <boost/cstdint.hpp>
 #include <boost/move/core.hpp>
 #include <boost/range/iterator_range_core.hpp>
@@ -27,6 +28,10 @@
 #include <boost/log/detail/date_time_format_parser.hpp>
 #include <boost/log/detail/attachable_sstream_buf.hpp>
 #include <boost/log/utility/formatting_ostream.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+#endif
 #include <boost/log/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -152,20 +157,76 @@ private:
     typedef std::vector< formatter_type > formatters;
     typedef std::vector< unsigned int > literal_lens;
 
+    //! Formatting result for the most recently formatted second
+    struct second_cache
+    {
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! The flag is set while a thread is using the cache
+        boost::atomic< bool > m_busy;
+#endif
+        //! Indicates that the cache contents are valid
+        bool m_valid;
+        //! The second the cached text was formatted for
+        uint64_t m_second;
+        //! Formatted text
+        string_type m_text;
+        //! Positions of fractional seconds in the formatted text
+        std::vector< std::size_t > m_subseconds_positions;
+
+        second_cache() :
+#if !defined(BOOST_LOG_NO_THREADS)
+            m_busy(false),
+#endif
+            m_valid(false),
+            m_second(0u)
+        {
+        }
+
+        BOOST_DELETED_FUNCTION(second_cache(second_cache const&))
+        BOOST_DELETED_FUNCTION(second_cache& operator=(second_cache const&))
+    };
+
+    //! The guard releases the cache on destruction
+    struct second_cache_guard
+    {
+        second_cache& m_cache;
+
+        explicit second_cache_guard(second_cache& cache) BOOST_NOEXCEPT : m_cache(cache)
+        {
+        }
+
+        ~second_cache_guard()
+        {
+#if !defined(BOOST_LOG_NO_THREADS)
+            m_cache.m_busy.store(false, boost::memory_order_release);
+#endif
+        }
+
+        BOOST_DELETED_FUNCTION(second_cache_guard(second_cache_guard const&))
+        BOOST_DELETED_FUNCTION(second_cache_guard& operator=(second_cache_guard const&))
+    };
+
 protected:
     formatters m_formatters;
     literal_lens m_literal_lens;
     string_type m_literal_chars;
+    //! Indicates that the formatting result only depends on the decomposed time fields
+    bool m_cacheable;
+    //! Formatting result cache
+    mutable second_cache m_cache;
 
 public:
-    BOOST_DEFAULTED_FUNCTION(date_time_formatter(), {})
+    date_time_formatter() : m_cacheable(true)
+    {
+    }
     date_time_formatter(date_time_formatter const& that) :
         m_formatters(that.m_formatters),
         m_literal_lens(that.m_literal_lens),
-        m_literal_chars(that.m_literal_chars)
+        m_literal_chars(that.m_literal_chars),
+        m_cacheable(that.m_cacheable)
     {
     }
-    date_time_formatter(BOOST_RV_REF(date_time_formatter) that) BOOST_NOEXCEPT
+    date_time_formatter(BOOST_RV_REF(date_time_formatter) that) BOOST_NOEXCEPT : m_cacheable(true)
     {
         this->swap(static_cast< date_time_formatter& >(that));
     }
@@ -187,7 +248,62 @@ public:
         }
     }
 
+    /*!
+     * Formats the value, reusing the formatting result for the previous value if both values belong to the same second.
+     * Only the fractional seconds are updated in the reused result. The caller provides the sequential number of the second
+     * and the fractional seconds of the value. The rest of the value fields are filled by \a decompose when the value
+     * needs to be formatted anew.
+     */
+    result_type format_cached(stream_type& strm, value_type& value, uint64_t second, void (*decompose)(value_type&)) const
+    {
+#if !defined(BOOST_LOG_NO_THREADS)
+        // If another thread is using the cache, don't wait for it and just format the value
+        if (m_cacheable && !m_cache.m_busy.exchange(true, boost::memory_order_acquire))
+#else
+        if (m_cacheable)
+#endif
+        {
+            second_cache_guard guard(m_cache);
+
+            if (!m_cache.m_valid || m_cache.m_second != second)
+            {
+                m_cache.m_valid = false;
+                decompose(value);
+                format_to_cache(value);
+                m_cache.m_second = second;
+                m_cache.m_valid = true;
+            }
+            else
+            {
+                char_type* const text = &m_cache.m_text[0];
+                for (typename std::vector< std::size_t >::const_iterator it = m_cache.m_subseconds_positions.begin(), end = m_cache.m_subseconds_positions.end(); it != end; ++it)
+                {
+                    uint32_t subseconds = value.subseconds;
+                    for (std::size_t i = *it + decomposed_time::subseconds_digits10; i > *it; --i, subseconds /= 10u)
+                        text[i - 1u] = static_cast< char_type >('0' + subseconds % 10u);
+                }
+            }
+
+            strm.flush();
+            if (strm.good())
+                strm.rdbuf()->append(m_cache.m_text.data(), m_cache.m_text.size());
+
+            return;
+        }
+
+        decompose(value);
+        (*this)(strm, value);
+    }
+
+    //! Adds a formatter that may depend on anything but the fractional seconds of the value. Results of such formatters are not cached.
     void add_formatter(formatter_type fun)
+    {
+        m_formatters.push_back(fun);
+        m_cacheable = false;
+    }
+
+    //! Adds a formatter that depends only on the decomposed time fields of the value
+    void add_field_formatter(formatter_type fun)
     {
         m_formatters.push_back(fun);
     }
@@ -204,6 +320,9 @@ public:
         m_formatters.swap(that.m_formatters);
         m_literal_lens.swap(that.m_literal_lens);
         m_literal_chars.swap(that.m_literal_chars);
+        std::swap(m_cacheable, that.m_cacheable);
+        m_cache.m_valid = false;
+        that.m_cache.m_valid = false;
     }
 
 public:
@@ -289,6 +408,24 @@ public:
     }
 
 private:
+    //! Formats the value into the cache and records positions of fractional seconds in the formatted text
+    void format_to_cache(value_type const& value) const
+    {
+        m_cache.m_text.clear();
+        m_cache.m_subseconds_positions.clear();
+
+        stream_type strm(m_cache.m_text);
+        context ctx(*this, strm, value);
+        for (typename formatters::const_iterator it = m_formatters.begin(), end = m_formatters.end(); it != end; ++it)
+        {
+            formatter_type fun = *it;
+            if (fun == &date_time_formatter_::format_fractional_seconds)
+                m_cache.m_subseconds_positions.push_back(m_cache.m_text.size());
+            fun(ctx);
+        }
+        strm.detach();
+    }
+
     static void format_literal(context& ctx)
     {
         unsigned int len = ctx.self.m_literal_lens[ctx.literal_index], pos = ctx.literal_pos;
@@ -326,17 +463,17 @@ public:
 
     void on_short_year()
     {
-        m_formatter.add_formatter(&formatter_type::format_short_year);
+        m_formatter.add_field_formatter(&formatter_type::format_short_year);
     }
 
     void on_full_year()
     {
-        m_formatter.add_formatter(&formatter_type::format_full_year);
+        m_formatter.add_field_formatter(&formatter_type::format_full_year);
     }
 
     void on_numeric_month()
     {
-        m_formatter.add_formatter(&formatter_type::format_numeric_month);
+        m_formatter.add_field_formatter(&formatter_type::format_numeric_month);
     }
 
     void on_short_month()
@@ -352,14 +489,14 @@ public:
     void on_month_day(bool leading_zero)
     {
         if (leading_zero)
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_month_day< '0' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_month_day< '0' >);
         else
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_month_day< ' ' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_month_day< ' ' >);
     }
 
     void on_numeric_week_day()
     {
-        m_formatter.add_formatter(&formatter_type::format_week_day);
+        m_formatter.add_field_formatter(&formatter_type::format_week_day);
     }
 
     void on_short_week_day()
@@ -375,48 +512,48 @@ public:
     void on_hours(bool leading_zero)
     {
         if (leading_zero)
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours< '0' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours< '0' >);
         else
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours< ' ' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours< ' ' >);
     }
 
     void on_hours_12(bool leading_zero)
     {
         if (leading_zero)
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours_12< '0' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours_12< '0' >);
         else
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours_12< ' ' >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_hours_12< ' ' >);
     }
 
     void on_minutes()
     {
-        m_formatter.add_formatter(&formatter_type::format_minutes);
+        m_formatter.add_field_formatter(&formatter_type::format_minutes);
     }
 
     void on_seconds()
     {
-        m_formatter.add_formatter(&formatter_type::format_seconds);
+        m_formatter.add_field_formatter(&formatter_type::format_seconds);
     }
 
     void on_fractional_seconds()
     {
-        m_formatter.add_formatter(&formatter_type::format_fractional_seconds);
+        m_formatter.add_field_formatter(&formatter_type::format_fractional_seconds);
     }
 
     void on_am_pm(bool upper_case)
     {
         if (upper_case)
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_am_pm< true >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_am_pm< true >);
         else
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_am_pm< false >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_am_pm< false >);
     }
 
     void on_duration_sign(bool display_positive)
     {
         if (display_positive)
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_sign< true >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_sign< true >);
         else
-            m_formatter.add_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_sign< false >);
+            m_formatter.add_field_formatter(&formatter_type::BOOST_NESTED_TEMPLATE format_sign< false >);
     }
 
     void on_iso_time_zone()
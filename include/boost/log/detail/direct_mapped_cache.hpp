@@ -0,0 +1,165 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   direct_mapped_cache.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_DETAIL_DIRECT_MAPPED_CACHE_HPP_INCLUDED_
+#define BOOST_LOG_DETAIL_DIRECT_MAPPED_CACHE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/atomic/atomic.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+/*!
+ * \brief A bounded direct-mapped table of cache entries
+ *
+ * The table stores pointers to immutable entries, indexed by the entry hash values. Looking up and
+ * inserting entries does not involve locking, so the table can be used by multiple threads concurrently.
+ * An entry is only inserted into an empty slot of the table and is never replaced, so the entries can be
+ * freed as soon as the table is cleared or destroyed, and the pointers returned by lookups stay valid
+ * until then. Keys that map to an occupied slot are not cached, which means that every allocated entry is
+ * reachable from the table and repeated or concurrent insertions of the same key do not consume the capacity.
+ *
+ * The entry type must have a \c hash member of type \c std::size_t and a static \c destroy function
+ * that frees an entry.
+ */
+template< typename EntryT >
+class direct_mapped_cache
+{
+public:
+    //! Entry type
+    typedef EntryT entry_type;
+
+private:
+    //! Cache table, the size is a power of two
+    boost::atomic< entry_type* >* m_table;
+    //! Cache table size mask
+    std::size_t m_mask;
+    //! Maximum number of entries
+    std::size_t m_capacity;
+    //! Number of entries
+    boost::atomic< std::size_t > m_size;
+
+public:
+    /*!
+     * Initializing constructor
+     *
+     * \param table_size Minimum number of slots in the table, rounded up to a power of two
+     * \param capacity Maximum number of entries
+     */
+    direct_mapped_cache(std::size_t table_size, std::size_t capacity) :
+        m_table(NULL),
+        m_mask(0u),
+        m_capacity(capacity)
+    {
+        std::size_t size = 16u;
+        while (size < table_size)
+            size *= 2u;
+
+        m_table = new boost::atomic< entry_type* >[size];
+        for (std::size_t i = 0u; i < size; ++i)
+            m_table[i].store(NULL, boost::memory_order_relaxed);
+        m_mask = size - 1u;
+        m_size.store(0u, boost::memory_order_relaxed);
+    }
+
+    ~direct_mapped_cache()
+    {
+        clear();
+        delete[] m_table;
+    }
+
+    //! Returns the maximum number of entries
+    std::size_t capacity() const BOOST_NOEXCEPT { return m_capacity; }
+    //! Returns the number of entries
+    std::size_t size() const BOOST_NOEXCEPT { return m_size.load(boost::memory_order_relaxed); }
+
+    /*!
+     * Looks up the entry with the hash value. The caller has to compare the entry key, as different keys may have equal hash values.
+     *
+     * \return The pointer to the entry with the hash value, or \c NULL if there is no such entry in the table
+     */
+    entry_type const* find(std::size_t hash) const BOOST_NOEXCEPT
+    {
+        entry_type const* const p = m_table[hash & m_mask].load(boost::memory_order_acquire);
+        if (p != NULL && p->hash == hash)
+            return p;
+        return NULL;
+    }
+
+    /*!
+     * Checks whether an entry with the hash value can be inserted. Can be used to avoid creating entries that will not be inserted.
+     *
+     * \return \c true if the table is not full and the slot for the hash value is empty, \c false otherwise
+     */
+    bool is_insertable(std::size_t hash) const BOOST_NOEXCEPT
+    {
+        return m_size.load(boost::memory_order_relaxed) < m_capacity && m_table[hash & m_mask].load(boost::memory_order_relaxed) == NULL;
+    }
+
+    /*!
+     * Inserts the entry into the table. The table takes ownership of the entry. If the slot for the entry hash value is occupied
+     * or the table is full, the entry is destroyed.
+     *
+     * \return \c true if the entry was inserted, \c false otherwise
+     */
+    bool insert(entry_type* p) BOOST_NOEXCEPT
+    {
+        entry_type* expected = NULL;
+        if (m_size.fetch_add(1u, boost::memory_order_relaxed) < m_capacity &&
+            m_table[p->hash & m_mask].compare_exchange_strong(expected, p, boost::memory_order_release, boost::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        m_size.fetch_sub(1u, boost::memory_order_relaxed);
+        entry_type::destroy(p);
+        return false;
+    }
+
+    //! Removes and frees all entries. Must not be called concurrently with other methods.
+    void clear() BOOST_NOEXCEPT
+    {
+        for (std::size_t i = 0u, n = m_mask + 1u; i < n; ++i)
+        {
+            entry_type* const p = m_table[i].exchange(NULL, boost::memory_order_relaxed);
+            if (p)
+                entry_type::destroy(p);
+        }
+        m_size.store(0u, boost::memory_order_relaxed);
+    }
+
+    BOOST_DELETED_FUNCTION(direct_mapped_cache(direct_mapped_cache const&))
+    BOOST_DELETED_FUNCTION(direct_mapped_cache& operator= (direct_mapped_cache const&))
+};
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_DETAIL_DIRECT_MAPPED_CACHE_HPP_INCLUDED_
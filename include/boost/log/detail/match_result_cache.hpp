@@ -0,0 +1,172 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   match_result_cache.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_DETAIL_MATCH_RESULT_CACHE_HPP_INCLUDED_
+#define BOOST_LOG_DETAIL_MATCH_RESULT_CACHE_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <boost/container_hash/hash.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/direct_mapped_cache.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+/*!
+ * \brief A bounded cache of string matching results
+ *
+ * The cache maps strings to the results of a costly matching operation, such as a regular expression match.
+ * The results are stored in a \c direct_mapped_cache with twice as many slots as the cache capacity, so the cache
+ * can be used by multiple threads concurrently. Once the number of cached results reaches the capacity of the cache,
+ * no new results are added. Strings that collide with a cached string in the table and strings longer than
+ * \c max_key_size bytes are not cached.
+ */
+class match_result_cache
+{
+public:
+    //! Default maximum number of cached results
+    static BOOST_CONSTEXPR_OR_CONST std::size_t default_capacity = 1024u;
+    //! Maximum size of cached strings, in bytes
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_key_size = 256u;
+
+private:
+    //! Cached result. The string contents follow the structure in memory.
+    struct entry
+    {
+        //! Hash value of the string
+        std::size_t hash;
+        //! String size, in bytes
+        std::size_t size;
+        //! Character size, in bytes
+        unsigned char char_size;
+        //! Matching result
+        bool result;
+
+        //! Returns a pointer to the string contents
+        unsigned char* key() BOOST_NOEXCEPT { return reinterpret_cast< unsigned char* >(this + 1); }
+        //! Returns a pointer to the string contents
+        const unsigned char* key() const BOOST_NOEXCEPT { return reinterpret_cast< const unsigned char* >(this + 1); }
+
+        //! Frees the entry
+        static void destroy(entry* p) BOOST_NOEXCEPT
+        {
+            p->~entry();
+            ::operator delete(p);
+        }
+    };
+
+private:
+    //! Cache table
+    direct_mapped_cache< entry > m_table;
+
+public:
+    /*!
+     * Initializing constructor
+     *
+     * \param capacity Maximum number of cached results
+     */
+    explicit match_result_cache(std::size_t capacity = default_capacity) : m_table(capacity * 2u, capacity)
+    {
+    }
+
+    //! Returns the maximum number of cached results
+    std::size_t capacity() const BOOST_NOEXCEPT { return m_table.capacity(); }
+
+    /*!
+     * Looks up the matching result for a string
+     *
+     * \param str Pointer to the string
+     * \param len String length, in characters
+     * \param result Receives the cached matching result, if found
+     * \return \c true if the result was found in the cache, \c false otherwise
+     */
+    template< typename CharT >
+    bool find(const CharT* str, std::size_t len, bool& result) const BOOST_NOEXCEPT
+    {
+        const std::size_t size = len * sizeof(CharT);
+        if (size > max_key_size)
+            return false;
+
+        entry const* const p = m_table.find(hash_key(str, size, sizeof(CharT)));
+        if (p != NULL && p->size == size && p->char_size == sizeof(CharT) && std::memcmp(p->key(), str, size) == 0)
+        {
+            result = p->result;
+            return true;
+        }
+
+        return false;
+    }
+
+    /*!
+     * Saves the matching result for a string
+     *
+     * \param str Pointer to the string
+     * \param len String length, in characters
+     * \param result The matching result
+     */
+    template< typename CharT >
+    void insert(const CharT* str, std::size_t len, bool result)
+    {
+        const std::size_t size = len * sizeof(CharT);
+        if (size > max_key_size)
+            return;
+
+        const std::size_t hash = hash_key(str, size, sizeof(CharT));
+        if (!m_table.is_insertable(hash))
+            return;
+
+        entry* const p = new (::operator new(sizeof(entry) + size)) entry();
+        p->hash = hash;
+        p->size = size;
+        p->char_size = static_cast< unsigned char >(sizeof(CharT));
+        p->result = result;
+        std::memcpy(p->key(), str, size);
+
+        m_table.insert(p);
+    }
+
+private:
+    //! Computes the hash value of the string
+    static std::size_t hash_key(const void* str, std::size_t size, std::size_t char_size) BOOST_NOEXCEPT
+    {
+        const unsigned char* const p = static_cast< const unsigned char* >(str);
+        std::size_t hash = boost::hash_range(p, p + size);
+        boost::hash_combine(hash, char_size);
+        return hash;
+    }
+
+    BOOST_DELETED_FUNCTION(match_result_cache(match_result_cache const&))
+    BOOST_DELETED_FUNCTION(match_result_cache& operator= (match_result_cache const&))
+};
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_DETAIL_MATCH_RESULT_CACHE_HPP_INCLUDED_
@@ -0,0 +1,202 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   open_hash_map.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_DETAIL_OPEN_HASH_MAP_HPP_INCLUDED_
+#define BOOST_LOG_DETAIL_OPEN_HASH_MAP_HPP_INCLUDED_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/allocator_traits.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+/*!
+ * \brief A minimal associative container based on an open addressing hash table
+ *
+ * The container is intended for lookup-heavy mappings that are filled once and then queried many times.
+ * The elements are stored in a contiguous array in the order of insertion, the hash table with linear probing
+ * only stores the hash values of the keys and the indices of the elements. The stored hash values are compared
+ * before the keys, so a lookup typically involves a single key comparison. Elements cannot be removed.
+ *
+ * Insertion invalidates iterators.
+ */
+template< typename KeyT, typename MappedT, typename HashT, typename KeyEqualT, typename AllocatorT >
+class open_hash_map
+{
+public:
+    typedef KeyT key_type;
+    typedef MappedT mapped_type;
+    typedef std::pair< KeyT, MappedT > value_type;
+    typedef HashT hasher;
+    typedef KeyEqualT key_equal;
+    typedef std::size_t size_type;
+
+private:
+    //! Hash table bucket
+    struct bucket
+    {
+        //! Hash value of the key
+        std::size_t hash;
+        //! Index of the element plus one, zero if the bucket is empty
+        std::size_t index;
+    };
+
+    typedef std::vector< value_type, typename rebind_alloc< AllocatorT, value_type >::type > elements_type;
+    typedef std::vector< bucket, typename rebind_alloc< AllocatorT, bucket >::type > buckets_type;
+
+public:
+    typedef typename elements_type::iterator iterator;
+    typedef typename elements_type::const_iterator const_iterator;
+
+private:
+    //! Elements
+    elements_type m_elements;
+    //! Hash table, the size is always a power of two or zero
+    buckets_type m_buckets;
+    //! Hash function
+    hasher m_hash;
+    //! Key equality predicate
+    key_equal m_key_equal;
+
+public:
+    explicit open_hash_map(hasher const& hash = hasher(), key_equal const& key_eq = key_equal()) :
+        m_hash(hash),
+        m_key_equal(key_eq)
+    {
+    }
+
+    iterator begin() { return m_elements.begin(); }
+    iterator end() { return m_elements.end(); }
+    const_iterator begin() const { return m_elements.begin(); }
+    const_iterator end() const { return m_elements.end(); }
+
+    size_type size() const BOOST_NOEXCEPT { return m_elements.size(); }
+    bool empty() const BOOST_NOEXCEPT { return m_elements.empty(); }
+
+    //! Removes all elements
+    void clear() BOOST_NOEXCEPT
+    {
+        m_elements.clear();
+        m_buckets.clear();
+    }
+
+    //! Looks up an element
+    template< typename T >
+    iterator find(T const& key)
+    {
+        const std::size_t index = find_index(key, m_hash(key));
+        return index > 0u ? m_elements.begin() + (index - 1u) : m_elements.end();
+    }
+
+    //! Looks up an element
+    template< typename T >
+    const_iterator find(T const& key) const
+    {
+        const std::size_t index = find_index(key, m_hash(key));
+        return index > 0u ? m_elements.begin() + (index - 1u) : m_elements.end();
+    }
+
+    //! Inserts an element, if there is no element with the equivalent key
+    std::pair< iterator, bool > insert(value_type const& value)
+    {
+        const std::size_t hash = m_hash(value.first);
+        std::size_t index = find_index(value.first, hash);
+        if (index > 0u)
+            return std::pair< iterator, bool >(m_elements.begin() + (index - 1u), false);
+
+        // Keep the load factor below 1/2
+        if ((m_elements.size() + 1u) * 2u > m_buckets.size())
+            rehash(m_buckets.empty() ? 16u : m_buckets.size() * 2u);
+
+        m_elements.push_back(value);
+        index = m_elements.size();
+        insert_bucket(hash, index);
+
+        return std::pair< iterator, bool >(m_elements.begin() + (index - 1u), true);
+    }
+
+private:
+    //! Returns the initial bucket position for the hash value
+    std::size_t bucket_position(std::size_t hash) const BOOST_NOEXCEPT
+    {
+        // Mix the hash value since the hash function may return the key itself for integral keys
+        const uint64_t h = static_cast< uint64_t >(hash) * UINT64_C(0x9E3779B97F4A7C15);
+        return static_cast< std::size_t >(h ^ (h >> 32u)) & (m_buckets.size() - 1u);
+    }
+
+    //! Returns the element index plus one, or zero if the key is not found
+    template< typename T >
+    std::size_t find_index(T const& key, std::size_t hash) const
+    {
+        if (BOOST_UNLIKELY(m_buckets.empty()))
+            return 0u;
+
+        const std::size_t mask = m_buckets.size() - 1u;
+        for (std::size_t pos = bucket_position(hash); true; pos = (pos + 1u) & mask)
+        {
+            bucket const& b = m_buckets[pos];
+            if (b.index == 0u)
+                return 0u;
+            if (b.hash == hash && m_key_equal(m_elements[b.index - 1u].first, key))
+                return b.index;
+        }
+    }
+
+    //! Inserts the element index into the hash table
+    void insert_bucket(std::size_t hash, std::size_t index) BOOST_NOEXCEPT
+    {
+        const std::size_t mask = m_buckets.size() - 1u;
+        std::size_t pos = bucket_position(hash);
+        while (m_buckets[pos].index != 0u)
+            pos = (pos + 1u) & mask;
+
+        m_buckets[pos].hash = hash;
+        m_buckets[pos].index = index;
+    }
+
+    //! Rebuilds the hash table with the new size
+    void rehash(std::size_t size)
+    {
+        buckets_type buckets(size);
+        m_buckets.swap(buckets);
+        for (std::size_t i = 0u, n = buckets.size(); i < n; ++i)
+        {
+            if (buckets[i].index != 0u)
+                insert_bucket(buckets[i].hash, buckets[i].index);
+        }
+    }
+};
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_DETAIL_OPEN_HASH_MAP_HPP_INCLUDED_
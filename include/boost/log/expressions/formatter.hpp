@@ -27,6 +27,7 @@
 #endif
 #include <boost/log/detail/config.hpp>
 #include <boost/log/detail/light_function.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
 #include <boost/log/attributes/attribute_value_set.hpp>
 #include <boost/log/attributes/value_visitation.hpp>
 #include <boost/log/core/record_view.hpp>
@@ -43,6 +44,14 @@ namespace boost {
 
 BOOST_LOG_OPEN_NAMESPACE
 
+namespace aux {
+
+//! The function formats the attribute value if it is a deferred message. Returns \c false if the value has a different type.
+template< typename CharT >
+BOOST_LOG_API bool format_deferred_message(basic_formatting_ostream< CharT >& strm, attribute_value const& value);
+
+} // namespace aux
+
 namespace expressions {
 
 namespace aux {
@@ -309,7 +318,13 @@ struct message_formatter
     template< typename StreamT >
     BOOST_FORCEINLINE result_type operator() (record_view const& rec, StreamT& strm) const
     {
-        boost::log::visit< expressions::tag::message::value_type >(m_MessageName, rec, boost::log::bind_output(strm));
+        const visitation_result res = boost::log::visit< expressions::tag::message::value_type >(m_MessageName, rec, boost::log::bind_output(strm));
+        if (BOOST_UNLIKELY(res.code() == visitation_result::value_has_invalid_type))
+        {
+            // The message may be a deferred message, which is formatted by the library
+            typedef typename StreamT::char_type char_type;
+            boost::log::aux::format_deferred_message(static_cast< basic_formatting_ostream< char_type >& >(strm), rec.attribute_values()[m_MessageName]);
+        }
     }
 
 private:
@@ -22,6 +22,7 @@
 
 #include <boost/log/expressions/formatters/date_time.hpp>
 #include <boost/log/expressions/formatters/named_scope.hpp>
+#include <boost/log/expressions/formatters/json.hpp>
 
 #include <boost/log/expressions/formatters/char_decorator.hpp>
 #include <boost/log/expressions/formatters/xml_decorator.hpp>
@@ -15,6 +15,7 @@
 #ifndef BOOST_LOG_EXPRESSIONS_FORMATTERS_CHAR_DECORATOR_HPP_INCLUDED_
 #define BOOST_LOG_EXPRESSIONS_FORMATTERS_CHAR_DECORATOR_HPP_INCLUDED_
 
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <iterator>
@@ -53,10 +54,37 @@ namespace boost {
 
 BOOST_LOG_OPEN_NAMESPACE
 
+namespace aux {
+
+//! The function type that returns a pointer to the first character in the range that is equal to any of the \a count characters in \a chars, or \a end if there is none
+typedef const char* find_any_char_t(const char* begin, const char* end, const char* chars, std::size_t count);
+//! The pointer to the implementation of the function, which is selected at run time depending on the CPU features
+extern BOOST_LOG_API find_any_char_t* find_any_char;
+
+} // namespace aux
+
 namespace expressions {
 
 namespace aux {
 
+//! Returns a pointer to the first character in the range that is equal to any of the \a count characters in \a chars
+template< typename CharT >
+inline const CharT* find_decorated_char(const CharT* begin, const CharT* end, const CharT* chars, std::size_t count)
+{
+    for (; begin != end; ++begin)
+    {
+        if (std::char_traits< CharT >::find(chars, count, *begin))
+            break;
+    }
+
+    return begin;
+}
+
+inline const char* find_decorated_char(const char* begin, const char* end, const char* chars, std::size_t count)
+{
+    return boost::log::aux::find_any_char(begin, end, chars, count);
+}
+
 template< typename RangeT >
 struct string_const_iterator : range_const_iterator< RangeT > {};
 template< >
@@ -96,11 +124,24 @@ private:
     //! List of the decorations to apply
     typedef std::vector< string_lengths > string_lengths_list;
 
+    //! Position and length of a replacement of a single character pattern
+    struct replacement
+    {
+        unsigned int pos, len;
+    };
+
+    //! List of replacements of single character patterns
+    typedef std::vector< replacement > replacement_list;
+
 private:
     //! Characters of the interleaved source patterns and replacements
     string_type m_decoration_chars;
     //! List of the decorations to apply
     string_lengths_list m_string_lengths;
+    //! Source patterns, if all patterns are single characters and can be replaced in one pass
+    string_type m_pattern_chars;
+    //! Replacements of the characters in \c m_pattern_chars
+    replacement_list m_replacements;
 
 public:
     /*!
@@ -134,6 +175,8 @@ public:
             }
             m_string_lengths.push_back(lens);
         }
+
+        init_single_pass();
     }
     /*!
      * Initializing constructor. Creates a pattern replacer with decorations specified
@@ -168,9 +211,15 @@ public:
         // Both sequences should be of the same size
         BOOST_ASSERT(it1 == end1);
         BOOST_ASSERT(it2 == end2);
+
+        init_single_pass();
     }
     //! Copy constructor
-    pattern_replacer(pattern_replacer const& that) : m_decoration_chars(that.m_decoration_chars), m_string_lengths(that.m_string_lengths)
+    pattern_replacer(pattern_replacer const& that) :
+        m_decoration_chars(that.m_decoration_chars),
+        m_string_lengths(that.m_string_lengths),
+        m_pattern_chars(that.m_pattern_chars),
+        m_replacements(that.m_replacements)
     {
     }
 
@@ -179,6 +228,12 @@ public:
     {
         typedef typename string_type::size_type size_type;
 
+        if (!m_pattern_chars.empty())
+        {
+            replace_single_pass(str, start_pos);
+            return;
+        }
+
         const char_type* from_chars = m_decoration_chars.c_str();
         for (typename string_lengths_list::const_iterator it = m_string_lengths.begin(), end = m_string_lengths.end(); it != end; ++it)
         {
@@ -194,6 +249,84 @@ public:
     }
 
 private:
+    /*!
+     * Prepares for applying all decorations in a single pass over the string. This is possible if all source
+     * patterns are single characters and no replacement contains a character matched by a subsequent pattern.
+     * Otherwise, the result of the single pass would differ from applying the decorations one by one.
+     */
+    void init_single_pass()
+    {
+        string_type pattern_chars;
+        replacement_list replacements;
+        replacements.reserve(m_string_lengths.size());
+        unsigned int pos = 0u;
+        for (typename string_lengths_list::const_iterator it = m_string_lengths.begin(), end = m_string_lengths.end(); it != end; ++it)
+        {
+            if (it->from_len != 1u)
+                return;
+
+            pattern_chars.push_back(m_decoration_chars[pos]);
+            replacement r = { pos + 1u, it->to_len };
+            replacements.push_back(r);
+            pos += 1u + it->to_len;
+        }
+
+        for (std::size_t i = 0u, n = replacements.size(); i < n; ++i)
+        {
+            const char_type* const to_chars = m_decoration_chars.data() + replacements[i].pos;
+            for (unsigned int j = 0u; j < replacements[i].len; ++j)
+            {
+                if (std::char_traits< char_type >::find(pattern_chars.data() + i + 1u, n - i - 1u, to_chars[j]))
+                    return;
+            }
+        }
+
+        m_pattern_chars.swap(pattern_chars);
+        m_replacements.swap(replacements);
+    }
+
+    //! Applies all decorations in a single pass, copying the parts of the string that don't need decoration in bulk
+    void replace_single_pass(string_type& str, typename string_type::size_type start_pos) const
+    {
+        const char_type* const pattern_chars = m_pattern_chars.data();
+        const std::size_t pattern_count = m_pattern_chars.size();
+        const char_type* p = str.data() + start_pos;
+        const char_type* end = str.data() + str.size();
+        p = aux::find_decorated_char(p, end, pattern_chars, pattern_count);
+        if (p == end)
+            return;
+
+        // Most strings don't need decoration, so we only make a copy of the tail when needed. Short tails are copied to the stack.
+        const std::size_t tail_size = static_cast< std::size_t >(end - p);
+        char_type small_tail[256u];
+        string_type large_tail;
+        if (tail_size <= sizeof(small_tail) / sizeof(*small_tail))
+        {
+            std::char_traits< char_type >::copy(small_tail, p, tail_size);
+            p = small_tail;
+        }
+        else
+        {
+            large_tail.assign(p, end);
+            p = large_tail.data();
+        }
+        end = p + tail_size;
+        str.resize(str.size() - tail_size);
+        const char_type* const decoration_chars = m_decoration_chars.data();
+        while (true)
+        {
+            // Find the first matching pattern, in case if there are duplicates
+            replacement const& r = m_replacements[std::char_traits< char_type >::find(pattern_chars, pattern_count, *p) - pattern_chars];
+            str.append(decoration_chars + r.pos, r.len);
+
+            const char_type* const next = aux::find_decorated_char(++p, end, pattern_chars, pattern_count);
+            str.append(p, next);
+            if (next == end)
+                break;
+            p = next;
+        }
+    }
+
     static char_type* string_begin(char_type* p)
     {
         return p;
@@ -0,0 +1,831 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   formatters/json.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * The header contains implementation of a formatter that outputs attribute values as a JSON object.
+ */
+
+#ifndef BOOST_LOG_EXPRESSIONS_FORMATTERS_JSON_HPP_INCLUDED_
+#define BOOST_LOG_EXPRESSIONS_FORMATTERS_JSON_HPP_INCLUDED_
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/phoenix/core/actor.hpp>
+#include <boost/phoenix/core/meta_grammar.hpp>
+#include <boost/phoenix/core/terminal_fwd.hpp>
+#include <boost/phoenix/core/is_nullary.hpp>
+#include <boost/phoenix/core/environment.hpp>
+#include <boost/fusion/sequence/intrinsic/at_c.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/custom_terminal_spec.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/utility/string_literal_fwd.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/type_dispatch/standard_types.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+//! The function type that returns a pointer to the first character in the range that has to be escaped in a JSON string, or \a end if there is none
+typedef const char* find_json_escape_char_t(const char* begin, const char* end);
+//! The pointer to the implementation of the function, which is selected at run time depending on the CPU features
+extern BOOST_LOG_API find_json_escape_char_t* find_json_escape_char;
+
+//! Size of the buffer that is sufficient to hold any number written by \c format_json_floating_point
+BOOST_CONSTEXPR_OR_CONST std::size_t json_floating_point_buffer_size = 64u;
+
+/*!
+ * Writes the finite floating point number to the buffer with the specified number of significant digits,
+ * regardless of the current locale. Returns the number of characters written.
+ */
+BOOST_LOG_API std::size_t format_json_floating_point(char* buf, long double value, int precision);
+
+/*!
+ * Writes the attribute value as a JSON value. Values of the types supported by the default formatter of the settings parsers
+ * that are not represented with native JSON types are written as JSON strings, formatted the same way as by the default formatter.
+ * Values of other types are written as \c null.
+ */
+template< typename CharT >
+BOOST_LOG_API void put_json_default_value(basic_formatting_ostream< CharT >& strm, attribute_value const& value);
+
+} // namespace aux
+
+namespace expressions {
+
+/*!
+ * \brief The tag type that selects the default set of attribute value types of the JSON formatter
+ *
+ * The set includes the arithmetic and string types, date and time types, \c trivial::severity_level,
+ * named scope lists, process and thread identifiers. This is the same set of types that is supported
+ * by the default formatter of the settings parsers, and the values of these types are formatted the same way.
+ */
+struct default_json_value_types {};
+
+namespace aux {
+
+template< typename StreamT >
+class stream_ref;
+
+//! Returns a pointer to the first character in the range that has to be escaped in a JSON string
+template< typename CharT >
+inline const CharT* find_json_escape(const CharT* begin, const CharT* end)
+{
+    for (; begin != end; ++begin)
+    {
+        const CharT c = *begin;
+        if (static_cast< uint32_t >(c) < 0x20u || c == static_cast< CharT >('"') || c == static_cast< CharT >('\\'))
+            break;
+    }
+
+    return begin;
+}
+
+//! Returns a pointer to the first character in the range that has to be escaped in a JSON string
+BOOST_FORCEINLINE const char* find_json_escape(const char* begin, const char* end)
+{
+    return (boost::log::aux::find_json_escape_char)(begin, end);
+}
+
+//! Writes the escape sequence of the character to the stream
+template< typename CharT >
+inline void put_json_escape_sequence(basic_formatting_ostream< CharT >& strm, uint32_t c)
+{
+    char buf[6] = { '\\', '\0', '\0', '\0', '\0', '\0' };
+    std::size_t size = 2u;
+    switch (c)
+    {
+    case '"':
+    case '\\':
+        buf[1] = static_cast< char >(c);
+        break;
+    case '\b':
+        buf[1] = 'b';
+        break;
+    case '\f':
+        buf[1] = 'f';
+        break;
+    case '\n':
+        buf[1] = 'n';
+        break;
+    case '\r':
+        buf[1] = 'r';
+        break;
+    case '\t':
+        buf[1] = 't';
+        break;
+    default:
+        {
+            static const char hex_digits[] = "0123456789abcdef";
+            buf[1] = 'u';
+            buf[2] = '0';
+            buf[3] = '0';
+            buf[4] = hex_digits[(c >> 4) & 0x0Fu];
+            buf[5] = hex_digits[c & 0x0Fu];
+            size = 6u;
+        }
+        break;
+    }
+
+    strm.write(buf, static_cast< std::streamsize >(size));
+}
+
+//! Writes the string to the stream, escaping the characters that are not allowed in JSON strings. The quotes are not written.
+template< typename CharT, typename StringCharT >
+inline void put_json_escaped(basic_formatting_ostream< CharT >& strm, const StringCharT* str, std::size_t size)
+{
+    const StringCharT* const end = str + size;
+    while (true)
+    {
+        const StringCharT* p = aux::find_json_escape(str, end);
+        if (p != str)
+            strm.write(str, static_cast< std::streamsize >(p - str));
+        if (p == end)
+            break;
+
+        aux::put_json_escape_sequence(strm, static_cast< uint32_t >(*p));
+        str = p + 1;
+    }
+}
+
+//! Returns \c true if the integer is negative
+template< typename T >
+BOOST_FORCEINLINE bool is_json_integer_negative(T value, mpl::true_)
+{
+    return value < static_cast< T >(0);
+}
+
+template< typename T >
+BOOST_FORCEINLINE bool is_json_integer_negative(T, mpl::false_)
+{
+    return false;
+}
+
+//! Writes the integer to the stream in decimal notation, regardless of the stream locale and formatting flags
+template< typename CharT, typename T >
+inline void put_json_integer(basic_formatting_ostream< CharT >& strm, T value)
+{
+    typedef typename make_unsigned< T >::type unsigned_type;
+
+    char buf[std::numeric_limits< unsigned_type >::digits10 + 2];
+    char* const end = buf + sizeof(buf);
+    char* p = end;
+
+    unsigned_type n = static_cast< unsigned_type >(value);
+    const bool negative = aux::is_json_integer_negative(value, mpl::bool_< is_signed< T >::value >());
+    if (negative)
+        n = static_cast< unsigned_type >(static_cast< unsigned_type >(0u) - n);
+
+    do
+    {
+        *--p = static_cast< char >('0' + static_cast< unsigned int >(n % 10u));
+        n /= 10u;
+    }
+    while (n != 0u);
+
+    if (negative)
+        *--p = '-';
+
+    strm.write(p, static_cast< std::streamsize >(end - p));
+}
+
+//! Escapes the characters written to the stream after the specified position in the attached string
+template< typename CharT >
+inline void escape_json_tail(basic_formatting_ostream< CharT >& strm, std::size_t pos)
+{
+    typedef typename basic_formatting_ostream< CharT >::streambuf_type streambuf_type;
+    typedef typename basic_formatting_ostream< CharT >::string_type string_type;
+
+    strm.flush();
+    string_type* const storage = static_cast< streambuf_type* >(strm.rdbuf())->storage();
+    if (pos >= storage->size())
+        return;
+
+    const CharT* const begin = storage->data();
+    const CharT* const end = begin + storage->size();
+    const CharT* const p = aux::find_json_escape(begin + pos, end);
+    if (p != end)
+    {
+        // Most values don't need escaping, so we only make a copy of the tail when needed
+        const string_type tail(p, end);
+        storage->resize(static_cast< std::size_t >(p - begin));
+        aux::put_json_escaped(strm, tail.data(), tail.size());
+    }
+}
+
+//! The default writer for the values that are not represented with native JSON types
+struct json_stream_output
+{
+    typedef void result_type;
+
+    template< typename CharT, typename T >
+    void operator() (basic_formatting_ostream< CharT >& strm, T const& value) const
+    {
+        strm << value;
+    }
+};
+
+struct json_boolean_tag {};
+struct json_character_tag {};
+struct json_integer_tag {};
+struct json_floating_point_tag {};
+struct json_string_tag {};
+struct json_other_tag {};
+
+//! The trait selects the JSON representation of the attribute value type
+template< typename T, bool IsIntegralV = is_integral< T >::value, bool IsFloatV = is_floating_point< T >::value >
+struct json_value_kind
+{
+    typedef json_other_tag type;
+};
+
+template< typename T >
+struct json_value_kind< T, true, false >
+{
+    typedef json_integer_tag type;
+};
+
+template< typename T >
+struct json_value_kind< T, false, true >
+{
+    typedef json_floating_point_tag type;
+};
+
+template< >
+struct json_value_kind< bool, true, false >
+{
+    typedef json_boolean_tag type;
+};
+
+template< >
+struct json_value_kind< char, true, false >
+{
+    typedef json_character_tag type;
+};
+
+#if !defined(BOOST_NO_INTRINSIC_WCHAR_T)
+template< >
+struct json_value_kind< wchar_t, true, false >
+{
+    typedef json_character_tag type;
+};
+#endif
+
+#if !defined(BOOST_NO_CXX11_CHAR16_T)
+template< >
+struct json_value_kind< char16_t, true, false >
+{
+    typedef json_character_tag type;
+};
+#endif
+
+#if !defined(BOOST_NO_CXX11_CHAR32_T)
+template< >
+struct json_value_kind< char32_t, true, false >
+{
+    typedef json_character_tag type;
+};
+#endif
+
+template< typename CharT, typename TraitsT, typename AllocatorT >
+struct json_value_kind< std::basic_string< CharT, TraitsT, AllocatorT >, false, false >
+{
+    typedef json_string_tag type;
+};
+
+template< typename CharT, typename TraitsT >
+struct json_value_kind< basic_string_literal< CharT, TraitsT >, false, false >
+{
+    typedef json_string_tag type;
+};
+
+//! The visitor writes attribute values as JSON values
+template< typename CharT, typename FallbackT >
+class json_value_writer
+{
+public:
+    typedef void result_type;
+    typedef basic_formatting_ostream< CharT > stream_type;
+
+private:
+    stream_type& m_strm;
+    FallbackT const& m_fallback;
+
+public:
+    json_value_writer(stream_type& strm, FallbackT const& fallback) : m_strm(strm), m_fallback(fallback)
+    {
+    }
+
+    template< typename T >
+    result_type operator() (T const& value) const
+    {
+        this->put(value, typename json_value_kind< T >::type());
+    }
+
+private:
+    void put(bool value, json_boolean_tag) const
+    {
+        if (value)
+            m_strm.write("true", 4);
+        else
+            m_strm.write("false", 5);
+    }
+
+    template< typename T >
+    void put(T const& value, json_character_tag) const
+    {
+        m_strm.put('"');
+        aux::put_json_escaped(m_strm, &value, 1u);
+        m_strm.put('"');
+    }
+
+    template< typename T >
+    void put(T const& value, json_integer_tag) const
+    {
+        aux::put_json_integer(m_strm, value);
+    }
+
+    template< typename T >
+    void put(T const& value, json_floating_point_tag) const
+    {
+        // JSON does not support infinities and NaNs. Note that (value - value) is NaN for these values.
+        if ((value - value) == static_cast< T >(0))
+        {
+            // Use enough digits for the value to be parsed back exactly
+            char buf[boost::log::aux::json_floating_point_buffer_size];
+            const std::size_t size = boost::log::aux::format_json_floating_point(buf, value, std::numeric_limits< T >::max_digits10);
+            m_strm.write(buf, static_cast< std::streamsize >(size));
+        }
+        else
+        {
+            m_strm.write("null", 4);
+        }
+    }
+
+    template< typename T >
+    void put(T const& value, json_string_tag) const
+    {
+        m_strm.put('"');
+        aux::put_json_escaped(m_strm, value.data(), value.size());
+        m_strm.put('"');
+    }
+
+    template< typename T >
+    void put(T const& value, json_other_tag) const
+    {
+        m_strm.put('"');
+        m_strm.flush();
+        typedef typename stream_type::streambuf_type streambuf_type;
+        const std::size_t pos = static_cast< streambuf_type* >(m_strm.rdbuf())->storage()->size();
+        m_fallback(m_strm, value);
+        aux::escape_json_tail(m_strm, pos);
+        m_strm.put('"');
+    }
+};
+
+//! Writes attribute values of the types from the sequence as JSON values
+template< typename ValueTypesT >
+struct json_value_dispatcher
+{
+    template< typename CharT, typename FallbackT >
+    static void put(basic_formatting_ostream< CharT >& strm, json_value_writer< CharT, FallbackT > const& writer, attribute_value const& value)
+    {
+        if (!boost::log::visit< ValueTypesT >(value, writer))
+        {
+            // The value type is not supported
+            strm.write("null", 4);
+        }
+    }
+};
+
+//! Writes attribute values of the default types as JSON values
+template< >
+struct json_value_dispatcher< default_json_value_types >
+{
+    template< typename CharT, typename FallbackT >
+    static void put(basic_formatting_ostream< CharT >& strm, json_value_writer< CharT, FallbackT > const&, attribute_value const& value)
+    {
+        boost::log::aux::put_json_default_value(strm, value);
+    }
+};
+
+//! The formatter writes the selected attribute values of a log record as a JSON object
+template< typename ValueTypesT, typename FallbackT = json_stream_output >
+class json_object_formatter
+{
+public:
+    typedef void result_type;
+    //! Attribute value types supported by the formatter
+    typedef ValueTypesT value_types;
+    //! Writer of the values that are not represented with native JSON types
+    typedef FallbackT fallback_type;
+
+private:
+    //! Object member description
+    struct member
+    {
+        //! Attribute name
+        attribute_name m_name;
+        //! Quoted and escaped member name, followed by a colon
+        std::string m_key;
+    };
+    typedef std::vector< member > members;
+
+private:
+    //! Object members, if empty, all attribute values are written
+    members m_members;
+    //! Writer of the values that are not represented with native JSON types
+    fallback_type m_fallback;
+
+public:
+    //! Constructs the formatter that writes all attribute values
+    explicit json_object_formatter(fallback_type const& fallback = fallback_type()) : m_fallback(fallback)
+    {
+    }
+
+    //! Constructs the formatter that writes the selected attribute values
+    explicit json_object_formatter(std::vector< attribute_name > const& names, fallback_type const& fallback = fallback_type()) : m_fallback(fallback)
+    {
+        m_members.reserve(names.size());
+        for (std::vector< attribute_name >::const_iterator it = names.begin(), end = names.end(); it != end; ++it)
+        {
+            m_members.push_back(member());
+            member& m = m_members.back();
+            m.m_name = *it;
+            make_key(it->string(), m.m_key);
+        }
+    }
+
+    //! Writes the JSON object to the stream
+    template< typename CharT >
+    result_type operator() (attribute_value_set const& values, basic_formatting_ostream< CharT >& strm) const
+    {
+        json_value_writer< CharT, fallback_type > writer(strm, m_fallback);
+        bool first = true;
+        strm.put('{');
+        if (m_members.empty())
+        {
+            std::string key;
+            for (attribute_value_set::const_iterator it = values.begin(), end = values.end(); it != end; ++it)
+            {
+                make_key(it->first.string(), key);
+                put_member(strm, writer, key, it->second, first);
+            }
+        }
+        else
+        {
+            for (typename members::const_iterator it = m_members.begin(), end = m_members.end(); it != end; ++it)
+            {
+                attribute_value_set::const_iterator value = values.find(it->m_name);
+                if (value != values.end())
+                    put_member(strm, writer, it->m_key, value->second, first);
+            }
+        }
+        strm.put('}');
+    }
+
+    //! Writes the JSON object to the stream
+    template< typename CharT >
+    result_type operator() (record_view const& rec, basic_formatting_ostream< CharT >& strm) const
+    {
+        (*this)(rec.attribute_values(), strm);
+    }
+
+    //! Writes the JSON object to the stream
+    template< typename StreamT >
+    result_type operator() (record_view const& rec, stream_ref< StreamT > const& strm) const
+    {
+        (*this)(rec.attribute_values(), strm.get());
+    }
+
+private:
+    //! Writes an object member to the stream
+    template< typename CharT >
+    static void put_member(basic_formatting_ostream< CharT >& strm, json_value_writer< CharT, fallback_type > const& writer, std::string const& key, attribute_value const& value, bool& first)
+    {
+        if (!first)
+            strm.put(',');
+        first = false;
+
+        strm.write(key.data(), static_cast< std::streamsize >(key.size()));
+        json_value_dispatcher< value_types >::put(strm, writer, value);
+    }
+
+    //! Composes a quoted and escaped member name, followed by a colon
+    static void make_key(std::string const& name, std::string& key)
+    {
+        key.clear();
+        basic_formatting_ostream< char > strm(key);
+        strm.put('"');
+        aux::put_json_escaped(strm, name.data(), name.size());
+        strm.write("\":", 2);
+        strm.flush();
+    }
+};
+
+//! Stream output expression of the JSON formatter
+template< typename LeftT, typename ImplT >
+class json_output_terminal
+{
+private:
+    //! Self type
+    typedef json_output_terminal< LeftT, ImplT > this_type;
+
+public:
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    //! Internal typedef for type categorization
+    typedef void _is_boost_log_terminal;
+#endif
+
+    //! Formatter implementation type
+    typedef ImplT impl_type;
+
+    //! Result type definition
+    template< typename >
+    struct result;
+
+    template< typename ThisT, typename ContextT >
+    struct result< ThisT(ContextT) >
+    {
+        typedef typename remove_cv< typename remove_reference< ContextT >::type >::type context_type;
+        typedef typename phoenix::evaluator::impl<
+            typename LeftT::proto_base_expr&,
+            context_type,
+            phoenix::unused
+        >::result_type type;
+    };
+
+private:
+    //! Left argument actor
+    LeftT m_left;
+    //! Formatter implementation
+    impl_type m_impl;
+
+public:
+    //! Initializing constructor
+    json_output_terminal(LeftT const& left, impl_type const& impl) : m_left(left), m_impl(impl)
+    {
+    }
+
+    //! Copy constructor
+    json_output_terminal(json_output_terminal const& that) : m_left(that.m_left), m_impl(that.m_impl)
+    {
+    }
+
+    //! Invokation operator
+    template< typename ContextT >
+    typename result< this_type(ContextT const&) >::type operator() (ContextT const& ctx)
+    {
+        typedef typename result< this_type(ContextT const&) >::type result_type;
+        result_type strm = phoenix::eval(m_left, ctx);
+        m_impl(fusion::at_c< 0 >(phoenix::env(ctx).args()), strm);
+        return strm;
+    }
+
+    //! Invokation operator
+    template< typename ContextT >
+    typename result< const this_type(ContextT const&) >::type operator() (ContextT const& ctx) const
+    {
+        typedef typename result< const this_type(ContextT const&) >::type result_type;
+        result_type strm = phoenix::eval(m_left, ctx);
+        m_impl(fusion::at_c< 0 >(phoenix::env(ctx).args()), strm);
+        return strm;
+    }
+
+    BOOST_DELETED_FUNCTION(json_output_terminal())
+};
+
+} // namespace aux
+
+/*!
+ * JSON formatter terminal. When evaluated outside of a stream output expression, the terminal
+ * returns the formatted JSON object as a string.
+ */
+template< typename ValueTypesT >
+class format_json_terminal
+{
+public:
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    //! Internal typedef for type categorization
+    typedef void _is_boost_log_terminal;
+#endif
+
+    //! Attribute value types supported by the formatter
+    typedef ValueTypesT value_types;
+    //! Formatter implementation type
+    typedef aux::json_object_formatter< value_types > impl_type;
+
+    //! Function result type
+    typedef std::string result_type;
+
+private:
+    //! Formatter implementation
+    impl_type m_impl;
+
+public:
+    //! Initializing constructor
+    explicit format_json_terminal(impl_type const& impl) : m_impl(impl)
+    {
+    }
+
+    //! Returns formatter implementation
+    impl_type const& get_impl() const
+    {
+        return m_impl;
+    }
+
+    //! Invokation operator
+    template< typename ContextT >
+    result_type operator() (ContextT const& ctx) const
+    {
+        std::string str;
+        basic_formatting_ostream< char > strm(str);
+        m_impl(fusion::at_c< 0 >(phoenix::env(ctx).args()), strm);
+        strm.flush();
+        return BOOST_LOG_NRVO_RESULT(str);
+    }
+
+    BOOST_DELETED_FUNCTION(format_json_terminal())
+};
+
+/*!
+ * JSON formatter actor.
+ */
+template< typename ValueTypesT, template< typename > class ActorT = phoenix::actor >
+class format_json_actor :
+    public ActorT< format_json_terminal< ValueTypesT > >
+{
+public:
+    //! Attribute value types supported by the formatter
+    typedef ValueTypesT value_types;
+    //! Base terminal type
+    typedef format_json_terminal< value_types > terminal_type;
+    //! Formatter implementation type
+    typedef typename terminal_type::impl_type impl_type;
+
+    //! Base actor type
+    typedef ActorT< terminal_type > base_type;
+
+public:
+    //! Initializing constructor
+    explicit format_json_actor(base_type const& act) : base_type(act)
+    {
+    }
+
+    /*!
+     * \returns Formatter implementation
+     */
+    impl_type const& get_impl() const
+    {
+        return this->proto_expr_.child0.get_impl();
+    }
+};
+
+#ifndef BOOST_LOG_DOXYGEN_PASS
+
+} // namespace expressions
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+namespace phoenix {
+
+namespace result_of {
+
+template< typename ValueTypesT >
+struct is_nullary< custom_terminal< boost::log::expressions::format_json_terminal< ValueTypesT > > > :
+    public mpl::false_
+{
+};
+
+template< typename LeftT, typename ImplT >
+struct is_nullary< custom_terminal< boost::log::expressions::aux::json_output_terminal< LeftT, ImplT > > > :
+    public mpl::false_
+{
+};
+
+} // namespace result_of
+
+} // namespace phoenix
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace expressions {
+
+#define BOOST_LOG_AUX_OVERLOAD(left_ref, right_ref)\
+    template< typename LeftExprT, typename ValueTypesT >\
+    BOOST_FORCEINLINE phoenix::actor< aux::json_output_terminal< phoenix::actor< LeftExprT >, typename format_json_actor< ValueTypesT >::impl_type > >\
+    operator<< (phoenix::actor< LeftExprT > left_ref left, format_json_actor< ValueTypesT > right_ref right)\
+    {\
+        typedef aux::json_output_terminal< phoenix::actor< LeftExprT >, typename format_json_actor< ValueTypesT >::impl_type > terminal_type;\
+        phoenix::actor< terminal_type > actor = {{ terminal_type(left, right.get_impl()) }};\
+        return actor;\
+    }
+
+#include <boost/log/detail/generate_overloads.hpp>
+
+#undef BOOST_LOG_AUX_OVERLOAD
+
+#endif // BOOST_LOG_DOXYGEN_PASS
+
+/*!
+ * The function generates a JSON formatter node in a template expression. The formatter writes
+ * all attribute values of the log record as members of a JSON object. Integral and floating point
+ * values are written as JSON numbers, \c bool values as JSON booleans, characters and strings as
+ * JSON strings. Values of other types from the \a ValueTypesT sequence are written as JSON strings
+ * containing the result of the stream output of the value. Values of types that are not in the
+ * sequence are written as \c null.
+ *
+ * The formatter must participate in a formatting expression (stream output or \c format placeholder filler).
+ */
+template< typename ValueTypesT >
+BOOST_FORCEINLINE format_json_actor< ValueTypesT > format_json()
+{
+    typedef format_json_actor< ValueTypesT > actor_type;
+    typedef typename actor_type::terminal_type terminal_type;
+    typename actor_type::base_type act = {{ terminal_type(typename terminal_type::impl_type()) }};
+    return actor_type(act);
+}
+
+/*!
+ * The function generates a JSON formatter node in a template expression. The formatter writes
+ * all attribute values of the log record as members of a JSON object. The values of the types listed
+ * in the \c default_json_value_types description are supported, other values are written as \c null.
+ *
+ * The formatter must participate in a formatting expression (stream output or \c format placeholder filler).
+ */
+BOOST_FORCEINLINE format_json_actor< default_json_value_types > format_json()
+{
+    return expressions::format_json< default_json_value_types >();
+}
+
+/*!
+ * The function generates a JSON formatter node in a template expression. The formatter writes
+ * the attribute values with the specified names as members of a JSON object, in the specified order.
+ * The attribute values not found in the log record are not written. See the description of the
+ * other overload for details on how attribute values are written.
+ *
+ * The formatter must participate in a formatting expression (stream output or \c format placeholder filler).
+ *
+ * \param names Attribute names
+ */
+template< typename ValueTypesT >
+BOOST_FORCEINLINE format_json_actor< ValueTypesT > format_json(std::vector< attribute_name > const& names)
+{
+    typedef format_json_actor< ValueTypesT > actor_type;
+    typedef typename actor_type::terminal_type terminal_type;
+    typename actor_type::base_type act = {{ terminal_type(typename terminal_type::impl_type(names)) }};
+    return actor_type(act);
+}
+
+/*!
+ * The function generates a JSON formatter node in a template expression. The formatter writes
+ * the attribute values with the specified names as members of a JSON object, in the specified order.
+ * The values of the types listed in the \c default_json_value_types description are supported,
+ * other values are written as \c null.
+ *
+ * The formatter must participate in a formatting expression (stream output or \c format placeholder filler).
+ *
+ * \param names Attribute names
+ */
+BOOST_FORCEINLINE format_json_actor< default_json_value_types > format_json(std::vector< attribute_name > const& names)
+{
+    return expressions::format_json< default_json_value_types >(names);
+}
+
+} // namespace expressions
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_EXPRESSIONS_FORMATTERS_JSON_HPP_INCLUDED_
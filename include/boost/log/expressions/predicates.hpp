@@ -26,6 +26,7 @@
 
 #include <boost/log/expressions/predicates/is_debugger_present.hpp>
 #include <boost/log/expressions/predicates/channel_severity_filter.hpp>
+#include <boost/log/expressions/predicates/hierarchical_channel_severity_filter.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 #pragma once
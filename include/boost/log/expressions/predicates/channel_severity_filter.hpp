@@ -18,6 +18,8 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <cstddef>
+#include <boost/container_hash/hash.hpp>
 #include <boost/phoenix/core/actor.hpp>
 #include <boost/phoenix/core/terminal_fwd.hpp>
 #include <boost/phoenix/core/is_nullary.hpp>
@@ -27,6 +29,7 @@
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/log/detail/config.hpp>
 #include <boost/log/detail/allocator_traits.hpp>
+#include <boost/log/detail/open_hash_map.hpp>
 #include <boost/log/detail/custom_terminal_spec.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
 #include <boost/log/attributes/fallback_policy.hpp>
@@ -47,6 +50,72 @@ BOOST_LOG_OPEN_NAMESPACE
 
 namespace expressions {
 
+//! Hash function object that uses \c boost::hash to hash channel names
+struct channel_hash
+{
+    typedef std::size_t result_type;
+
+    template< typename T >
+    result_type operator() (T const& value) const
+    {
+        return boost::hash< T >()(value);
+    }
+};
+
+/*!
+ * \brief Channel lookup policy for the channel severity filter
+ *
+ * When this type is specified instead of the channel ordering predicate, the channel severity filter keeps the channel
+ * thresholds in a hash table rather than \c std::map. The hash values of the channel names are stored in the table,
+ * so looking up a channel typically requires calculating the hash of the channel name and a single comparison
+ * of the names, regardless of the number of channels in the filter. This is beneficial when the filter contains
+ * many channels.
+ */
+template< typename HashT = channel_hash, typename KeyEqualT = equal_to >
+struct hashed_channel_lookup
+{
+    //! Hash function
+    HashT hash;
+    //! Channel equality predicate
+    KeyEqualT key_equal;
+
+    explicit hashed_channel_lookup(HashT const& h = HashT(), KeyEqualT const& eq = KeyEqualT()) : hash(h), key_equal(eq)
+    {
+    }
+};
+
+namespace aux {
+
+//! The trait selects the container for the channel to severity mapping
+template< typename ChannelT, typename SeverityT, typename ChannelOrderT, typename AllocatorT >
+struct channel_severity_mapping
+{
+    typedef std::map<
+        ChannelT,
+        SeverityT,
+        ChannelOrderT,
+        typename boost::log::aux::rebind_alloc< AllocatorT, std::pair< const ChannelT, SeverityT > >::type
+    > type;
+
+    static type make(ChannelOrderT const& channel_order)
+    {
+        return type(channel_order);
+    }
+};
+
+template< typename ChannelT, typename SeverityT, typename HashT, typename KeyEqualT, typename AllocatorT >
+struct channel_severity_mapping< ChannelT, SeverityT, hashed_channel_lookup< HashT, KeyEqualT >, AllocatorT >
+{
+    typedef boost::log::aux::open_hash_map< ChannelT, SeverityT, HashT, KeyEqualT, AllocatorT > type;
+
+    static type make(hashed_channel_lookup< HashT, KeyEqualT > const& channel_lookup)
+    {
+        return type(channel_lookup.hash, channel_lookup.key_equal);
+    }
+};
+
+} // namespace aux
+
 template<
     typename ChannelT,
     typename SeverityT,
@@ -77,13 +146,10 @@ public:
     typedef SeverityFallbackT severity_fallback_policy;
 
 private:
+    //! Channel to severity mapping traits
+    typedef aux::channel_severity_mapping< channel_value_type, severity_value_type, ChannelOrderT, AllocatorT > mapping_traits;
     //! Channel to severity mapping type
-    typedef std::map<
-        channel_value_type,
-        severity_value_type,
-        ChannelOrderT,
-        typename boost::log::aux::rebind_alloc< AllocatorT, std::pair< const channel_value_type, severity_value_type > >::type
-    > mapping_type;
+    typedef typename mapping_traits::type mapping_type;
     //! Attribute value visitor invoker for channel
     typedef value_visitor_invoker< channel_value_type, channel_fallback_policy > channel_visitor_invoker_type;
     //! Attribute value visitor invoker for severity level
@@ -163,7 +229,7 @@ public:
         m_severity_name(severity_name),
         m_channel_visitor_invoker(channel_fallback),
         m_severity_visitor_invoker(severity_fallback),
-        m_mapping(channel_order),
+        m_mapping(mapping_traits::make(channel_order)),
         m_severity_compare(severity_compare),
         m_default(false)
     {
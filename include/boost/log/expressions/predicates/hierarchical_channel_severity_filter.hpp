@@ -0,0 +1,592 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   hierarchical_channel_severity_filter.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * The header contains implementation of a minimal severity per channel filter for hierarchical channel names.
+ */
+
+#ifndef BOOST_LOG_EXPRESSIONS_PREDICATES_HIERARCHICAL_CHANNEL_SEVERITY_FILTER_HPP_INCLUDED_
+#define BOOST_LOG_EXPRESSIONS_PREDICATES_HIERARCHICAL_CHANNEL_SEVERITY_FILTER_HPP_INCLUDED_
+
+#include <cstddef>
+#include <utility>
+#include <boost/container_hash/hash.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/phoenix/core/actor.hpp>
+#include <boost/phoenix/core/terminal_fwd.hpp>
+#include <boost/phoenix/core/is_nullary.hpp>
+#include <boost/phoenix/core/environment.hpp>
+#include <boost/fusion/sequence/intrinsic/at_c.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/open_hash_map.hpp>
+#include <boost/log/detail/direct_mapped_cache.hpp>
+#include <boost/log/detail/custom_terminal_spec.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/fallback_policy.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/utility/use_std_allocator.hpp>
+#include <boost/log/utility/functional/logical.hpp>
+#include <boost/log/expressions/attr_fwd.hpp>
+#include <boost/log/expressions/keyword_fwd.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace expressions {
+
+namespace aux {
+
+//! A part of a channel name
+template< typename CharT >
+struct channel_name_part
+{
+    const CharT* data;
+    std::size_t size;
+
+    channel_name_part(const CharT* d, std::size_t s) BOOST_NOEXCEPT : data(d), size(s)
+    {
+    }
+};
+
+//! Hash function for channel names and their parts
+struct channel_name_hash
+{
+    typedef std::size_t result_type;
+
+    template< typename StringT >
+    result_type operator() (StringT const& str) const
+    {
+        return boost::hash_range(str.data(), str.data() + str.size());
+    }
+
+    template< typename CharT >
+    result_type operator() (channel_name_part< CharT > const& part) const
+    {
+        return boost::hash_range(part.data, part.data + part.size);
+    }
+};
+
+//! Equality predicate for channel names and their parts
+struct channel_name_equal
+{
+    typedef bool result_type;
+
+    template< typename StringT >
+    result_type operator() (StringT const& left, StringT const& right) const
+    {
+        return left == right;
+    }
+
+    template< typename StringT, typename CharT >
+    result_type operator() (StringT const& left, channel_name_part< CharT > const& right) const
+    {
+        return left.size() == right.size && StringT::traits_type::compare(left.data(), right.data, right.size) == 0;
+    }
+};
+
+} // namespace aux
+
+template<
+    typename ChannelT,
+    typename SeverityT,
+    typename ChannelFallbackT = fallback_to_none,
+    typename SeverityFallbackT = fallback_to_none,
+    typename SeverityCompareT = greater_equal
+>
+class hierarchical_channel_severity_filter_terminal
+{
+public:
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    //! Internal typedef for type categorization
+    typedef void _is_boost_log_terminal;
+#endif
+
+    //! Function result type
+    typedef bool result_type;
+
+    //! Channel attribute value type
+    typedef ChannelT channel_value_type;
+    //! Channel fallback policy
+    typedef ChannelFallbackT channel_fallback_policy;
+    //! Severity level attribute value type
+    typedef SeverityT severity_value_type;
+    //! Severity level fallback policy
+    typedef SeverityFallbackT severity_fallback_policy;
+    //! Channel name character type
+    typedef typename channel_value_type::value_type char_type;
+
+private:
+    //! Channel to severity mapping type
+    typedef boost::log::aux::open_hash_map<
+        channel_value_type,
+        severity_value_type,
+        aux::channel_name_hash,
+        aux::channel_name_equal,
+        use_std_allocator
+    > mapping_type;
+    //! Attribute value visitor invoker for channel
+    typedef value_visitor_invoker< channel_value_type, channel_fallback_policy > channel_visitor_invoker_type;
+    //! Attribute value visitor invoker for severity level
+    typedef value_visitor_invoker< severity_value_type, severity_fallback_policy > severity_visitor_invoker_type;
+
+    //! Resolved threshold of a channel
+    struct cache_entry
+    {
+        //! Hash value of the channel name
+        std::size_t hash;
+        //! Channel name
+        channel_value_type channel;
+        //! Severity threshold, or \c NULL if no rule applies to the channel
+        severity_value_type const* threshold;
+        cache_entry(std::size_t h, channel_value_type const& ch, severity_value_type const* th) : hash(h), channel(ch), threshold(th)
+        {
+        }
+
+        //! Frees the entry
+        static void destroy(cache_entry* p) BOOST_NOEXCEPT
+        {
+            delete p;
+        }
+    };
+
+    /*!
+     * Filter rules and the cache of resolved channel thresholds. The rules are not modified while the state
+     * is shared between multiple copies of the filter, so the cache never needs to be invalidated. The cache
+     * is a \c direct_mapped_cache, which is updated without locking.
+     */
+    struct state
+    {
+        //! Cache table size, which is also the maximum number of cached channels
+        static BOOST_CONSTEXPR_OR_CONST std::size_t cache_size = 4096u;
+
+        //! Channel to severity mapping
+        mapping_type m_mapping;
+        //! Channel name level separator
+        char_type m_separator;
+
+        //! Cache of resolved channel thresholds
+        boost::log::aux::direct_mapped_cache< cache_entry > m_cache;
+
+        state() : m_separator(static_cast< char_type >('.')), m_cache(cache_size, cache_size)
+        {
+        }
+
+        state(state const& that) : m_mapping(that.m_mapping), m_separator(that.m_separator), m_cache(cache_size, cache_size)
+        {
+        }
+
+        //! Returns the threshold for the channel or \c NULL if no rules apply to the channel
+        severity_value_type const* find_threshold(channel_value_type const& channel)
+        {
+            const std::size_t hash = aux::channel_name_hash()(channel);
+            cache_entry const* const entry = m_cache.find(hash);
+            if (BOOST_LIKELY(entry != NULL && entry->channel == channel))
+                return entry->threshold;
+
+            severity_value_type const* const threshold = resolve(channel);
+            if (m_cache.is_insertable(hash))
+                m_cache.insert(new cache_entry(hash, channel, threshold));
+
+            return threshold;
+        }
+
+        //! Removes all cache entries. Must not be called while the state is shared.
+        void clear_cache()
+        {
+            m_cache.clear();
+        }
+
+    private:
+        //! Finds the rule for the channel or the closest of its parents
+        severity_value_type const* resolve(channel_value_type const& channel) const
+        {
+            typename mapping_type::const_iterator it = m_mapping.find(channel);
+            if (it != m_mapping.end())
+                return &it->second;
+
+            const char_type* const name = channel.data();
+            std::size_t size = channel.size();
+            while (size > 0u)
+            {
+                --size;
+                if (name[size] == m_separator)
+                {
+                    it = m_mapping.find(aux::channel_name_part< char_type >(name, size));
+                    if (it != m_mapping.end())
+                        return &it->second;
+                }
+            }
+
+            // The rule for the empty channel name applies to all channels
+            it = m_mapping.find(aux::channel_name_part< char_type >(name, 0u));
+            if (it != m_mapping.end())
+                return &it->second;
+
+            return NULL;
+        }
+
+        BOOST_DELETED_FUNCTION(state& operator= (state const&))
+    };
+
+    //! Channel visitor
+    template< typename ArgT >
+    struct channel_visitor
+    {
+        typedef void result_type;
+
+        channel_visitor(hierarchical_channel_severity_filter_terminal const& self, ArgT arg, bool& res) : m_self(self), m_arg(arg), m_res(res)
+        {
+        }
+
+        result_type operator() (channel_value_type const& channel) const
+        {
+            m_self.visit_channel(channel, m_arg, m_res);
+        }
+
+    private:
+        hierarchical_channel_severity_filter_terminal const& m_self;
+        ArgT m_arg;
+        bool& m_res;
+    };
+
+    //! Severity level visitor
+    struct severity_visitor
+    {
+        typedef void result_type;
+
+        severity_visitor(hierarchical_channel_severity_filter_terminal const& self, severity_value_type const& severity, bool& res) : m_self(self), m_severity(severity), m_res(res)
+        {
+        }
+
+        result_type operator() (severity_value_type const& severity) const
+        {
+            m_res = m_self.m_severity_compare(severity, m_severity);
+        }
+
+    private:
+        hierarchical_channel_severity_filter_terminal const& m_self;
+        severity_value_type const& m_severity;
+        bool& m_res;
+    };
+
+private:
+    //! Channel attribute name
+    attribute_name m_channel_name;
+    //! Severity level attribute name
+    attribute_name m_severity_name;
+    //! Channel value visitor invoker
+    channel_visitor_invoker_type m_channel_visitor_invoker;
+    //! Severity level value visitor invoker
+    severity_visitor_invoker_type m_severity_visitor_invoker;
+
+    //! Filter rules and the cache, shared between the copies of the filter
+    shared_ptr< state > m_state;
+    //! Severity checking predicate
+    SeverityCompareT m_severity_compare;
+
+    //! Default result
+    bool m_default;
+
+public:
+    //! Initializing constructor
+    hierarchical_channel_severity_filter_terminal
+    (
+        attribute_name const& channel_name,
+        attribute_name const& severity_name,
+        channel_fallback_policy const& channel_fallback = channel_fallback_policy(),
+        severity_fallback_policy const& severity_fallback = severity_fallback_policy(),
+        SeverityCompareT const& severity_compare = SeverityCompareT()
+    ) :
+        m_channel_name(channel_name),
+        m_severity_name(severity_name),
+        m_channel_visitor_invoker(channel_fallback),
+        m_severity_visitor_invoker(severity_fallback),
+        m_state(boost::make_shared< state >()),
+        m_severity_compare(severity_compare),
+        m_default(false)
+    {
+    }
+
+    //! Adds a new rule for the channel and its descendants
+    void add(channel_value_type const& channel, severity_value_type const& severity)
+    {
+        state& st = get_unique_state();
+        typedef typename mapping_type::iterator iterator;
+        std::pair< iterator, bool > res = st.m_mapping.insert(typename mapping_type::value_type(channel, severity));
+        if (!res.second)
+            res.first->second = severity;
+    }
+
+    //! Sets the separator of the channel name levels
+    void set_separator(char_type separator)
+    {
+        get_unique_state().m_separator = separator;
+    }
+
+    //! Sets the default result of the predicate
+    void set_default(bool def)
+    {
+        m_default = def;
+    }
+
+    //! Returns the threshold for the channel, or \c NULL if no rules apply to the channel
+    severity_value_type const* find_threshold(channel_value_type const& channel) const
+    {
+        return m_state->find_threshold(channel);
+    }
+
+    //! Invokation operator
+    template< typename ContextT >
+    result_type operator() (ContextT const& ctx) const
+    {
+        result_type res = m_default;
+
+        typedef typename remove_cv<
+            typename remove_reference< typename phoenix::result_of::env< ContextT >::type >::type
+        >::type env_type;
+        typedef typename env_type::args_type args_type;
+        typedef typename fusion::result_of::at_c< args_type, 0 >::type arg_type;
+        arg_type arg = fusion::at_c< 0 >(phoenix::env(ctx).args());
+
+        m_channel_visitor_invoker(m_channel_name, arg, channel_visitor< arg_type >(*this, arg, res));
+
+        return res;
+    }
+
+private:
+    //! Returns the state that is not shared with other filters, with an empty cache
+    state& get_unique_state()
+    {
+        if (!m_state.unique())
+            m_state = boost::make_shared< state >(static_cast< state const& >(*m_state));
+        else
+            m_state->clear_cache();
+        return *m_state;
+    }
+
+    //! Visits channel name
+    template< typename ArgT >
+    void visit_channel(channel_value_type const& channel, ArgT const& arg, bool& res) const
+    {
+        severity_value_type const* const threshold = find_threshold(channel);
+        if (threshold)
+        {
+            m_severity_visitor_invoker(m_severity_name, arg, severity_visitor(*this, *threshold, res));
+        }
+    }
+};
+
+template<
+    typename ChannelT,
+    typename SeverityT,
+    typename ChannelFallbackT = fallback_to_none,
+    typename SeverityFallbackT = fallback_to_none,
+    typename SeverityCompareT = greater_equal,
+    template< typename > class ActorT = phoenix::actor
+>
+class hierarchical_channel_severity_filter_actor :
+    public ActorT< hierarchical_channel_severity_filter_terminal< ChannelT, SeverityT, ChannelFallbackT, SeverityFallbackT, SeverityCompareT > >
+{
+private:
+    //! Self type
+    typedef hierarchical_channel_severity_filter_actor this_type;
+
+public:
+    //! Terminal type
+    typedef hierarchical_channel_severity_filter_terminal< ChannelT, SeverityT, ChannelFallbackT, SeverityFallbackT, SeverityCompareT > terminal_type;
+    //! Base actor type
+    typedef ActorT< terminal_type > base_type;
+
+    //! Channel attribute value type
+    typedef typename terminal_type::channel_value_type channel_value_type;
+    //! Channel fallback policy
+    typedef typename terminal_type::channel_fallback_policy channel_fallback_policy;
+    //! Severity level attribute value type
+    typedef typename terminal_type::severity_value_type severity_value_type;
+    //! Severity level fallback policy
+    typedef typename terminal_type::severity_fallback_policy severity_fallback_policy;
+    //! Channel name character type
+    typedef typename terminal_type::char_type char_type;
+
+private:
+    //! An auxiliary pseudo-reference to implement insertion through subscript operator
+    class subscript_result
+    {
+    private:
+        hierarchical_channel_severity_filter_actor& m_owner;
+        channel_value_type const& m_channel;
+
+    public:
+        subscript_result(hierarchical_channel_severity_filter_actor& owner, channel_value_type const& channel) : m_owner(owner), m_channel(channel)
+        {
+        }
+
+        void operator= (severity_value_type const& severity)
+        {
+            m_owner.add(m_channel, severity);
+        }
+    };
+
+public:
+    //! Initializing constructor
+    explicit hierarchical_channel_severity_filter_actor(base_type const& act) : base_type(act)
+    {
+    }
+    //! Copy constructor
+    hierarchical_channel_severity_filter_actor(hierarchical_channel_severity_filter_actor const& that) : base_type(static_cast< base_type const& >(that))
+    {
+    }
+
+    //! Sets the default function result
+    this_type& set_default(bool def)
+    {
+        this->proto_expr_.child0.set_default(def);
+        return *this;
+    }
+
+    //! Sets the separator of the channel name levels
+    this_type& set_separator(char_type separator)
+    {
+        this->proto_expr_.child0.set_separator(separator);
+        return *this;
+    }
+
+    //! Adds a new rule for the channel and its descendants
+    this_type& add(channel_value_type const& channel, severity_value_type const& severity)
+    {
+        this->proto_expr_.child0.add(channel, severity);
+        return *this;
+    }
+
+    //! Alternative interface for adding a new rule
+    subscript_result operator[] (channel_value_type const& channel)
+    {
+        return subscript_result(*this, channel);
+    }
+};
+
+/*!
+ * The function generates a filtering predicate that checks the severity levels of log records in hierarchical channels.
+ * A channel name consists of levels separated with dots, e.g. "net.http.client". A threshold set for a channel applies
+ * to the channel and all its descendants, unless a descendant has its own threshold. A threshold set for the empty channel
+ * name applies to all channels. The predicate will return \c true if the record severity level is not less than
+ * the threshold for the channel the record belongs to.
+ *
+ * The threshold of every channel is resolved once and then cached by the filter, so the filter performance does not
+ * depend on the number of rules. Up to 4096 channels are cached. The thresholds of the channels that do not fit in
+ * the cache, or whose names collide with a cached channel in the internal hash table, are resolved every time.
+ */
+template< typename ChannelT, typename SeverityT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< ChannelT, SeverityT >
+hierarchical_channel_severity_filter(attribute_name const& channel_name, attribute_name const& severity_name)
+{
+    typedef hierarchical_channel_severity_filter_actor< ChannelT, SeverityT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_name, severity_name) }};
+    return result_type(act);
+}
+
+//! \overload
+template< typename SeverityT, typename ChannelDescriptorT, template< typename > class ActorT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, SeverityT, fallback_to_none, fallback_to_none, greater_equal, ActorT >
+hierarchical_channel_severity_filter(attribute_keyword< ChannelDescriptorT, ActorT > const& channel_keyword, attribute_name const& severity_name)
+{
+    typedef hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, SeverityT, fallback_to_none, fallback_to_none, greater_equal, ActorT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_keyword.get_name(), severity_name) }};
+    return result_type(act);
+}
+
+//! \overload
+template< typename ChannelT, typename SeverityDescriptorT, template< typename > class ActorT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< ChannelT, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, greater_equal, ActorT >
+hierarchical_channel_severity_filter(attribute_name const& channel_name, attribute_keyword< SeverityDescriptorT, ActorT > const& severity_keyword)
+{
+    typedef hierarchical_channel_severity_filter_actor< ChannelT, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, greater_equal, ActorT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_name, severity_keyword.get_name()) }};
+    return result_type(act);
+}
+
+//! \overload
+template< typename ChannelDescriptorT, typename SeverityDescriptorT, template< typename > class ActorT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, greater_equal, ActorT >
+hierarchical_channel_severity_filter(attribute_keyword< ChannelDescriptorT, ActorT > const& channel_keyword, attribute_keyword< SeverityDescriptorT, ActorT > const& severity_keyword)
+{
+    typedef hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, greater_equal, ActorT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_keyword.get_name(), severity_keyword.get_name()) }};
+    return result_type(act);
+}
+
+//! \overload
+template< typename ChannelT, typename SeverityT, typename SeverityCompareT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< ChannelT, SeverityT, fallback_to_none, fallback_to_none, SeverityCompareT >
+hierarchical_channel_severity_filter(attribute_name const& channel_name, attribute_name const& severity_name, SeverityCompareT const& severity_compare)
+{
+    typedef hierarchical_channel_severity_filter_actor< ChannelT, SeverityT, fallback_to_none, fallback_to_none, SeverityCompareT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_name, severity_name, fallback_to_none(), fallback_to_none(), severity_compare) }};
+    return result_type(act);
+}
+
+//! \overload
+template< typename ChannelDescriptorT, typename SeverityDescriptorT, template< typename > class ActorT, typename SeverityCompareT >
+BOOST_FORCEINLINE hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, SeverityCompareT, ActorT >
+hierarchical_channel_severity_filter(attribute_keyword< ChannelDescriptorT, ActorT > const& channel_keyword, attribute_keyword< SeverityDescriptorT, ActorT > const& severity_keyword, SeverityCompareT const& severity_compare)
+{
+    typedef hierarchical_channel_severity_filter_actor< typename ChannelDescriptorT::value_type, typename SeverityDescriptorT::value_type, fallback_to_none, fallback_to_none, SeverityCompareT, ActorT > result_type;
+    typedef typename result_type::terminal_type terminal_type;
+    typename result_type::base_type act = {{ terminal_type(channel_keyword.get_name(), severity_keyword.get_name(), fallback_to_none(), fallback_to_none(), severity_compare) }};
+    return result_type(act);
+}
+
+} // namespace expressions
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+#ifndef BOOST_LOG_DOXYGEN_PASS
+
+namespace phoenix {
+
+namespace result_of {
+
+template<
+    typename ChannelT,
+    typename SeverityT,
+    typename ChannelFallbackT,
+    typename SeverityFallbackT,
+    typename SeverityCompareT
+>
+struct is_nullary< custom_terminal< boost::log::expressions::hierarchical_channel_severity_filter_terminal< ChannelT, SeverityT, ChannelFallbackT, SeverityFallbackT, SeverityCompareT > > > :
+    public mpl::false_
+{
+};
+
+} // namespace result_of
+
+} // namespace phoenix
+
+#endif
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_EXPRESSIONS_PREDICATES_HIERARCHICAL_CHANNEL_SEVERITY_FILTER_HPP_INCLUDED_
@@ -15,10 +15,14 @@
 #ifndef BOOST_LOG_EXPRESSIONS_PREDICATES_MATCHES_HPP_INCLUDED_
 #define BOOST_LOG_EXPRESSIONS_PREDICATES_MATCHES_HPP_INCLUDED_
 
+#include <cstddef>
 #include <boost/phoenix/core/actor.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/log/detail/config.hpp>
 #include <boost/log/detail/unary_function_terminal.hpp>
 #include <boost/log/detail/attribute_predicate.hpp>
+#include <boost/log/detail/match_result_cache.hpp>
 #include <boost/log/expressions/attr_fwd.hpp>
 #include <boost/log/expressions/keyword_fwd.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
@@ -69,6 +73,85 @@ public:
     }
 };
 
+namespace aux {
+
+//! Compiled matching expression with a cache of matching results
+template< typename CompiledT >
+struct memoized_match_expression
+{
+    //! Compiled matching expression
+    CompiledT expression;
+    //! Matching results cache
+    shared_ptr< boost::log::aux::match_result_cache > cache;
+
+    memoized_match_expression(CompiledT const& expr, std::size_t cache_capacity) :
+        expression(expr),
+        cache(boost::make_shared< boost::log::aux::match_result_cache >(cache_capacity))
+    {
+    }
+};
+
+//! The regex matching functor that caches the matching results
+struct memoized_matches_fun
+{
+    typedef bool result_type;
+
+    template< typename StringT, typename CompiledT >
+    bool operator() (StringT const& str, memoized_match_expression< CompiledT > const& expr) const
+    {
+        bool result = false;
+        if (!expr.cache->find(str.data(), str.size(), result))
+        {
+            result = matches_fun()(str, expr.expression);
+            expr.cache->insert(str.data(), str.size(), result);
+        }
+        return result;
+    }
+};
+
+} // namespace aux
+
+/*!
+ * The predicate checks if the attribute value matches a regular expression. The attribute value is assumed to be of a string type.
+ * The matching results are cached, so that the regular expression is only matched once for every distinct attribute value.
+ * The number of cached results is limited, the attribute values that are not cached are matched against the regular expression
+ * every time.
+ */
+template< typename T, typename RegexT, typename FallbackPolicyT = fallback_to_none >
+class attribute_memoized_matches :
+    public aux::attribute_predicate< T, aux::memoized_match_expression< typename boost::log::aux::match_traits< RegexT >::compiled_type >, aux::memoized_matches_fun, FallbackPolicyT >
+{
+    typedef aux::memoized_match_expression< typename boost::log::aux::match_traits< RegexT >::compiled_type > expression_type;
+    typedef aux::attribute_predicate< T, expression_type, aux::memoized_matches_fun, FallbackPolicyT > base_type;
+
+public:
+    /*!
+     * Initializing constructor
+     *
+     * \param name Attribute name
+     * \param rex The regular expression to match the attribute value against
+     * \param cache_capacity The maximum number of cached matching results
+     */
+    attribute_memoized_matches(attribute_name const& name, RegexT const& rex, std::size_t cache_capacity) :
+        base_type(name, expression_type(boost::log::aux::match_traits< RegexT >::compile(rex), cache_capacity))
+    {
+    }
+
+    /*!
+     * Initializing constructor
+     *
+     * \param name Attribute name
+     * \param rex The regular expression to match the attribute value against
+     * \param cache_capacity The maximum number of cached matching results
+     * \param arg Additional parameter for the fallback policy
+     */
+    template< typename U >
+    attribute_memoized_matches(attribute_name const& name, RegexT const& rex, std::size_t cache_capacity, U const& arg) :
+        base_type(name, expression_type(boost::log::aux::match_traits< RegexT >::compile(rex), cache_capacity), arg)
+    {
+    }
+};
+
 #if defined(BOOST_MSVC) && BOOST_MSVC == 1925
 // MSVC 14.2 has a codegen bug that makes inlined `matches` functions below crash on copy constructing the phoenix::actor on return.
 // https://developercommunity.visualstudio.com/content/problem/982738/bad-code-generated-in-boostlogboostregex-test-case.html
@@ -116,6 +199,49 @@ matches(attribute_name const& name, RegexT const& rex)
     return act;
 }
 
+/*!
+ * The function generates a terminal node in a template expression. The node will check if the attribute value,
+ * which is assumed to be a string, matches the specified regular expression. The matching results are cached
+ * for up to \a cache_capacity distinct attribute values, which is useful when the attribute values are drawn
+ * from a small set of strings, like channel names.
+ */
+template< typename T, typename FallbackPolicyT, typename TagT, template< typename > class ActorT, typename RegexT >
+BOOST_LOG_AUX_FORCEINLINE_MSVC_BUG982738 ActorT< aux::unary_function_terminal< attribute_memoized_matches< T, RegexT, FallbackPolicyT > > >
+memoized_matches(attribute_actor< T, FallbackPolicyT, TagT, ActorT > const& attr, RegexT const& rex, std::size_t cache_capacity = boost::log::aux::match_result_cache::default_capacity)
+{
+    typedef aux::unary_function_terminal< attribute_memoized_matches< T, RegexT, FallbackPolicyT > > terminal_type;
+    ActorT< terminal_type > act = {{ terminal_type(attr.get_name(), rex, cache_capacity, attr.get_fallback_policy()) }};
+    return act;
+}
+
+/*!
+ * The function generates a terminal node in a template expression. The node will check if the attribute value,
+ * which is assumed to be a string, matches the specified regular expression. The matching results are cached
+ * for up to \a cache_capacity distinct attribute values.
+ */
+template< typename DescriptorT, template< typename > class ActorT, typename RegexT >
+BOOST_LOG_AUX_FORCEINLINE_MSVC_BUG982738 ActorT< aux::unary_function_terminal< attribute_memoized_matches< typename DescriptorT::value_type, RegexT > > >
+memoized_matches(attribute_keyword< DescriptorT, ActorT > const&, RegexT const& rex, std::size_t cache_capacity = boost::log::aux::match_result_cache::default_capacity)
+{
+    typedef aux::unary_function_terminal< attribute_memoized_matches< typename DescriptorT::value_type, RegexT > > terminal_type;
+    ActorT< terminal_type > act = {{ terminal_type(DescriptorT::get_name(), rex, cache_capacity) }};
+    return act;
+}
+
+/*!
+ * The function generates a terminal node in a template expression. The node will check if the attribute value,
+ * which is assumed to be a string, matches the specified regular expression. The matching results are cached
+ * for up to \a cache_capacity distinct attribute values.
+ */
+template< typename T, typename RegexT >
+BOOST_LOG_AUX_FORCEINLINE_MSVC_BUG982738 phoenix::actor< aux::unary_function_terminal< attribute_memoized_matches< T, RegexT > > >
+memoized_matches(attribute_name const& name, RegexT const& rex, std::size_t cache_capacity = boost::log::aux::match_result_cache::default_capacity)
+{
+    typedef aux::unary_function_terminal< attribute_memoized_matches< T, RegexT > > terminal_type;
+    phoenix::actor< terminal_type > act = {{ terminal_type(name, rex, cache_capacity) }};
+    return act;
+}
+
 #undef BOOST_LOG_AUX_FORCEINLINE_MSVC_BUG982738
 
 } // namespace expressions
@@ -0,0 +1,40 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   keywords/persistent_index.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * The header contains the \c persistent_index keyword declaration.
+ */
+
+#ifndef BOOST_LOG_KEYWORDS_PERSISTENT_INDEX_HPP_INCLUDED_
+#define BOOST_LOG_KEYWORDS_PERSISTENT_INDEX_HPP_INCLUDED_
+
+#include <boost/parameter/keyword.hpp>
+#include <boost/log/detail/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace keywords {
+
+//! The keyword allows to enable maintaining a persistent index of the files in the file collector target directory
+BOOST_PARAMETER_KEYWORD(tag, persistent_index)
+
+} // namespace keywords
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#endif // BOOST_LOG_KEYWORDS_PERSISTENT_INDEX_HPP_INCLUDED_
@@ -31,6 +31,8 @@
 #include <boost/log/sinks/block_on_overflow.hpp>
 #endif // !defined(BOOST_LOG_NO_THREADS)
 
+#include <boost/log/sinks/binary_file_backend.hpp>
+#include <boost/log/sinks/binary_ipc_message_queue_backend.hpp>
 #include <boost/log/sinks/syslog_backend.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
 #include <boost/log/sinks/text_ipc_message_queue_backend.hpp>
@@ -549,6 +549,21 @@ private:
             scoped_flag guard(base_type::frontend_mutex(), m_BlockCond, m_FlushRequested);
             base_type::flush_backend(m_BackendMutex, *m_pBackend);
         }
+        else
+        {
+            // Let the backend send the records it may have accumulated while the queue was being drained
+            flush_batched_backend(typename has_requirement< typename sink_backend_type::frontend_requirements, batched_feeding >::type());
+        }
+    }
+
+    //! Flushes the backend that supports batching
+    void flush_batched_backend(boost::true_type)
+    {
+        base_type::flush_backend(m_BackendMutex, *m_pBackend);
+    }
+    //! Flushes the backend that supports batching (stub for backends that don't support batching)
+    static void flush_batched_backend(boost::false_type) BOOST_NOEXCEPT
+    {
     }
 #endif // BOOST_LOG_DOXYGEN_PASS
 };
@@ -0,0 +1,182 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_file_backend.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * The header contains implementation of a binary file sink backend. The written files
+ * can be read with \c binary_log_reader or converted to text with the \c boost_log_decode tool.
+ */
+
+#ifndef BOOST_LOG_SINKS_BINARY_FILE_BACKEND_HPP_INCLUDED_
+#define BOOST_LOG_SINKS_BINARY_FILE_BACKEND_HPP_INCLUDED_
+
+#include <ios>
+#include <cstddef>
+#include <boost/filesystem/path.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/parameter_tools.hpp>
+#include <boost/log/keywords/file_name.hpp>
+#include <boost/log/keywords/open_mode.hpp>
+#include <boost/log/keywords/block_size.hpp>
+#include <boost/log/keywords/auto_flush.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace sinks {
+
+/*!
+ * \brief An implementation of a binary file sink backend
+ *
+ * The sink backend writes attribute values of log records to a file in a compact binary format. Attribute
+ * names and descriptions of the deferred logging statements are written once per file, subsequent records
+ * refer to them by numeric identifiers. Integers are stored as variable length numbers, severity levels
+ * and timestamps are stored as is. Records are grouped into blocks, each of which is protected with a checksum.
+ *
+ * The backend does not format log records, so it does not support formatters. The message text written by
+ * deferred logging statements is not formatted either; instead, the message arguments are stored in the file.
+ * The file can be converted to text with any formatter later, using the \c boost_log_decode tool or
+ * \c binary_log_reader.
+ *
+ * The following attribute value types are supported: \c bool, character and integral types,
+ * floating point types, \c std::string, \c string_literal, \c trivial::severity_level, \c posix_time::ptime,
+ * the process and thread identifiers produced by \c current_process_id and \c current_thread_id attributes
+ * and \c deferred_message. Values of other types are written as strings if a string conversion is registered
+ * for the type with \c register_binary_string_conversion, and are not written otherwise. Note that \c string_literal values are read
+ * back as \c std::string, \c long \c double values are written with \c double precision and time points are written
+ * with microsecond precision.
+ */
+class binary_file_backend :
+    public basic_sink_backend<
+        combine_requirements< synchronized_feeding, flushing >::type
+    >
+{
+    //! Base type
+    typedef basic_sink_backend<
+        combine_requirements< synchronized_feeding, flushing >::type
+    > base_type;
+
+private:
+    //! \cond
+
+    struct implementation;
+    implementation* m_pImpl;
+
+    //! \endcond
+
+public:
+    /*!
+     * Constructor. Creates a sink backend with the specified named parameters.
+     * The following named parameters are supported:
+     *
+     * \li \c file_name - Specifies the name of the file to write. This parameter is mandatory.
+     * \li \c open_mode - File open mode. The mode should be presented in form of mask compatible to
+     *                    <tt>std::ios_base::openmode</tt>. If the mode contains <tt>std::ios_base::app</tt>,
+     *                    the records are appended to the existing file. If not specified, <tt>trunc | out</tt> will be used.
+     * \li \c block_size - Specifies the approximate size of the blocks written to the file, in bytes. Larger blocks
+     *                     reduce the overhead of writing, but more records will be buffered in memory. By default, is 65536.
+     * \li \c auto_flush - Specifies a flag, whether or not to automatically write the block and flush the file after
+     *                     each log record. By default, is \c false.
+     */
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    BOOST_LOG_PARAMETRIZED_CONSTRUCTORS_CALL(binary_file_backend, construct)
+#else
+    template< typename... ArgsT >
+    explicit binary_file_backend(ArgsT... const& args);
+#endif
+
+    /*!
+     * Destructor. Writes the buffered records to the file.
+     */
+    BOOST_LOG_API ~binary_file_backend();
+
+    /*!
+     * The method adds an attribute to the list of attributes whose values are written. If the list is empty,
+     * which is the default, values of all attributes with supported types are written.
+     *
+     * \param name Attribute name.
+     */
+    BOOST_LOG_API void add_attribute(attribute_name const& name);
+
+    /*!
+     * The method clears the list of attributes whose values are written. After this call values of all
+     * attributes with supported types are written.
+     */
+    BOOST_LOG_API void clear_attributes();
+
+    /*!
+     * The method sets the approximate size of the blocks written to the file
+     *
+     * \param size Block size, in bytes.
+     */
+    BOOST_LOG_API void set_block_size(std::size_t size);
+
+    /*!
+     * Sets the flag to automatically write the block and flush the file after each log record.
+     *
+     * \param enable The flag indicates whether the automatic flush should be performed.
+     */
+    BOOST_LOG_API void auto_flush(bool enable = true);
+
+    /*!
+     * \return The name of the file being written
+     */
+    BOOST_LOG_API filesystem::path get_file_name() const;
+
+    /*!
+     * The method writes the record to the buffer. The buffer is written to the file when the block size is reached.
+     * If the record does not fit in the maximum block size of the file format together with the buffered records,
+     * the buffered records are written to the file first.
+     *
+     * \b Throws: \c limitation_error if the record alone exceeds the maximum block size, in which case only this record
+     *            is not written. \c filesystem_error if writing to the file fails.
+     */
+    BOOST_LOG_API void consume(record_view const& rec);
+
+    /*!
+     * The method writes the buffered records to the file and flushes the file
+     */
+    BOOST_LOG_API void flush();
+
+private:
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    //! Constructor implementation
+    template< typename ArgsT >
+    void construct(ArgsT const& args)
+    {
+        construct(
+            filesystem::path(args[keywords::file_name]),
+            args[keywords::open_mode | (std::ios_base::trunc | std::ios_base::out)],
+            args[keywords::block_size | static_cast< std::size_t >(65536u)],
+            args[keywords::auto_flush | false]);
+    }
+    //! Constructor implementation
+    BOOST_LOG_API void construct(filesystem::path const& file_name, std::ios_base::openmode mode, std::size_t block_size, bool auto_flush);
+#endif // BOOST_LOG_DOXYGEN_PASS
+};
+
+} // namespace sinks
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_SINKS_BINARY_FILE_BACKEND_HPP_INCLUDED_
@@ -77,6 +77,13 @@ struct formatted_records {};
  */
 struct flushing {};
 
+/*!
+ * The sink backend may buffer log records between calls to \c consume and expects the frontend to flush
+ * the backend when no more records are immediately available. Asynchronous sink frontends flush such backends
+ * every time their record queue is drained.
+ */
+struct batched_feeding : flushing {};
+
 #if defined(BOOST_LOG_DOXYGEN_PASS)
 
 /*!
@@ -24,10 +24,12 @@
 #ifndef BOOST_LOG_WITHOUT_SYSLOG
 
 #include <string>
+#include <cstddef>
 #include <boost/log/detail/asio_fwd.hpp>
 #include <boost/log/detail/light_function.hpp>
 #include <boost/log/detail/parameter_tools.hpp>
 #include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
 #include <boost/log/sinks/syslog_constants.hpp>
 #include <boost/log/sinks/attribute_mapping.hpp>
 #include <boost/log/attributes/attribute_value_set.hpp>
@@ -62,7 +64,9 @@ namespace syslog {
 #endif
 #endif
 #ifndef BOOST_LOG_NO_ASIO
-        udp_socket_based = 1        //!< Use UDP sockets, according to RFC3164
+        udp_socket_based = 1,       //!< Use UDP sockets, according to RFC3164
+        tcp_socket_based = 2,       //!< Use a TCP connection, according to RFC5424 and RFC6587 octet-counting framing
+        local_socket_based = 3      //!< Use a local (Unix domain) stream socket, according to RFC5424 and RFC6587 octet-counting framing
 #endif
     };
 
@@ -146,12 +150,27 @@ namespace syslog {
  * Obviously, the \c set_local_address and \c set_target_address
  * methods have no effect for native backends. Using <tt>use_impl = native</tt>
  * on platforms with no native support for POSIX syslog API will have no effect.
+ *
+ * The backend can also send log records over a stream connection, either via TCP
+ * (<tt>use_impl = tcp_socket_based</tt>) or via a local stream socket, such as the one
+ * a local syslog daemon listens on (<tt>use_impl = local_socket_based</tt>). In this case,
+ * records are formatted according to RFC5424 and framed according to RFC6587 octet-counting
+ * method. The connection is kept open and is re-established if it breaks. Records that
+ * could not be sent because of a connection failure are retained and sent after
+ * the connection is restored.
+
  */
 class syslog_backend :
-    public basic_formatted_sink_backend< char >
+    public basic_formatted_sink_backend<
+        char,
+        combine_requirements< synchronized_feeding, batched_feeding >::type
+    >
 {
     //! Base type
-    typedef basic_formatted_sink_backend< char > base_type;
+    typedef basic_formatted_sink_backend<
+        char,
+        combine_requirements< synchronized_feeding, batched_feeding >::type
+    > base_type;
     //! Implementation type
     struct implementation;
 
@@ -184,9 +203,16 @@ public:
      *                                   is available, it is equivalent to \c udp_socket_based.
      *                   \li \c udp_socket_based - Use the UDP socket-based implementation, conforming to
      *                                             RFC3164 protocol specification. This is the default.
+     *                   \li \c tcp_socket_based - Use the TCP connection-based implementation, conforming to
+     *                                             RFC5424 and RFC6587 protocol specifications.
+     *                   \li \c local_socket_based - Use the local stream socket-based implementation, conforming to
+     *                                               RFC5424 and RFC6587 protocol specifications. Only supported on
+     *                                               platforms with Unix domain sockets.
+
      * \li \c ip_version - Specifies IP protocol version to use, in case if socket-based implementation
      *                     is used. Can be either \c v4 (the default one) or \c v6.
-     * \li \c ident - Process identification string. This parameter is only supported by native syslog implementation.
+     * \li \c ident - Process identification string. This parameter is supported by native and stream socket-based
+     *                 syslog implementations. For the latter, the string is used as the APP-NAME field of the messages.
      */
 #ifndef BOOST_LOG_DOXYGEN_PASS
     BOOST_LOG_PARAMETRIZED_CONSTRUCTORS_CALL(syslog_backend, construct)
@@ -247,6 +273,33 @@ public:
      */
     BOOST_LOG_API void set_target_address(boost::asio::ip::address const& addr, unsigned short port = 514);
 
+    /*!
+     * The method sets the path of the local socket where log records will be sent to. The path must be specified
+     * before sending log records over a local stream socket. Note that local syslog daemons commonly listen on
+     * datagram sockets (e.g. "/dev/log"), which cannot be used with this implementation.
+     *
+     * \note Only has effect if the backend was constructed to use local stream sockets
+     *
+     * \param path The local socket path
+     */
+    BOOST_LOG_API void set_target_path(std::string const& path);
+
+    /*!
+     * The method sets the maximum number of log records that can be sent to the syslog server in a single batch.
+     * When batching is enabled, the backend accumulates the formatted packets and sends them when the batch
+     * is full or when the backend is flushed. Where supported, the whole batch is sent with a single system call.
+     * For stream socket-based implementations, the whole batch is written to the connection at once.
+     *
+     * Batching is intended to be used with the asynchronous sink frontend, which flushes the backend every time
+     * its record queue is drained. When used with other frontends, the records may be delayed until the backend
+     * is flushed explicitly.
+     *
+     * \note Does not have effect if the backend was constructed to use native syslog API
+     *
+     * \param max_batch_size The maximum number of records in a batch. Values of 0 and 1 disable batching, which is the default.
+     */
+    BOOST_LOG_API void set_max_batch_size(std::size_t max_batch_size);
+
 #endif // !defined(BOOST_LOG_NO_ASIO)
 
     /*!
@@ -254,6 +307,11 @@ public:
      */
     BOOST_LOG_API void consume(record_view const& rec, string_type const& formatted_message);
 
+    /*!
+     * The method sends the log records that may have been accumulated in the current batch
+     */
+    BOOST_LOG_API void flush();
+
 private:
 #ifndef BOOST_LOG_DOXYGEN_PASS
     //! The method creates the backend implementation
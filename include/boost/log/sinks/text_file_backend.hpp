@@ -16,6 +16,8 @@
 #define BOOST_LOG_SINKS_TEXT_FILE_BACKEND_HPP_INCLUDED_
 
 #include <ios>
+#include <ctime>
+#include <chrono>
 #include <string>
 #include <ostream>
 #include <boost/limits.hpp>
@@ -29,6 +31,8 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/log/keywords/max_size.hpp>
 #include <boost/log/keywords/max_files.hpp>
+#include <boost/log/keywords/async_collection.hpp>
+#include <boost/log/keywords/persistent_index.hpp>
 #include <boost/log/keywords/min_free_space.hpp>
 #include <boost/log/keywords/target.hpp>
 #include <boost/log/keywords/target_file_name.hpp>
@@ -155,6 +159,15 @@ struct BOOST_LOG_NO_VTABLE collector
 namespace aux {
 
     //! Creates and returns a file collector with the specified parameters
+    BOOST_LOG_API shared_ptr< collector > make_collector(
+        filesystem::path const& target_dir,
+        uintmax_t max_size,
+        uintmax_t min_free_space,
+        uintmax_t max_files,
+        bool async_collection,
+        bool persistent_index
+    );
+    //! Creates and returns a file collector with the specified parameters. The overload is kept for binary compatibility.
     BOOST_LOG_API shared_ptr< collector > make_collector(
         filesystem::path const& target_dir,
         uintmax_t max_size,
@@ -168,7 +181,9 @@ namespace aux {
             filesystem::path(args[keywords::target]),
             args[keywords::max_size | (std::numeric_limits< uintmax_t >::max)()],
             args[keywords::min_free_space | static_cast< uintmax_t >(0)],
-            args[keywords::max_files | (std::numeric_limits< uintmax_t >::max)()]);
+            args[keywords::max_files | (std::numeric_limits< uintmax_t >::max)()],
+            args[keywords::async_collection | false],
+            args[keywords::persistent_index | false]);
     }
 
 } // namespace aux
@@ -195,6 +210,16 @@ inline shared_ptr< collector > make_collector(T1 const& a1, T2 const& a2, T3 con
 {
     return aux::make_collector((a1, a2, a3, a4));
 }
+template< typename T1, typename T2, typename T3, typename T4, typename T5 >
+inline shared_ptr< collector > make_collector(T1 const& a1, T2 const& a2, T3 const& a3, T4 const& a4, T5 const& a5)
+{
+    return aux::make_collector((a1, a2, a3, a4, a5));
+}
+template< typename T1, typename T2, typename T3, typename T4, typename T5, typename T6 >
+inline shared_ptr< collector > make_collector(T1 const& a1, T2 const& a2, T3 const& a3, T4 const& a4, T5 const& a5, T6 const& a6)
+{
+    return aux::make_collector((a1, a2, a3, a4, a5, a6));
+}
 
 #else
 
@@ -229,6 +254,27 @@ inline shared_ptr< collector > make_collector(T1 const& a1, T2 const& a2, T3 con
  * \li \c max_files - Specifies the maximum number of log files stored.  If the number of files exceeds
  *                    this threshold, the oldest file(s) is deleted to free space.  The threshhold is
  *                    not maintained if not specified.
+ * \li \c async_collection - Specifies whether the rotated files should be stored asynchronously. If \c true,
+ *                           \c store_file only queues the file, and moving it to the target directory and deleting
+ *                           old files to maintain the limits is done in a dedicated thread. This way, the sink backend
+ *                           is not blocked by potentially slow filesystem operations on file rotation. The mode
+ *                           is enabled if any of the requests for the collector of the same target directory
+ *                           enables it. If storing a file fails in the dedicated thread, the error is rethrown from
+ *                           the next call to \c store_file or \c scan_for_files. By default, is \c false. The parameter
+ *                           has no effect in single-threaded builds of the library.
+ * \li \c persistent_index - Specifies whether the collector should maintain an index of the files in the target
+ *                           directory. The index is stored in a file named ".boost_log_collector_index" in the target
+ *                           directory and is updated as the collector stores and deletes files. When the target directory
+ *                           is scanned, the index is used instead of iterating over the directory, if the directory has not
+ *                           been modified since the index was last updated. Otherwise the directory is scanned, and the
+ *                           index is rebuilt. The index is most effective if the sink backend writes the active log file
+ *                           into a different directory. By default, is \c false.
+ *
+ * \note In asynchronous mode the file is moved into the target directory some time after the sink backend
+ *       rotates it. The active file name pattern of the sink backend should therefore produce unique file names
+ *       (e.g. by including a file counter or a timestamp), or the next active file could be opened under the name
+ *       of a file that is still pending collection. Pending files are stored before the collector is destroyed
+ *       and before \c scan_for_files is performed.
  *
  * \return The file collector.
  */
@@ -264,7 +310,8 @@ private:
     unsigned char m_DayKind : 2; // contains day_kind values
     unsigned char m_Hour, m_Minute, m_Second;
 
-    mutable posix_time::ptime m_Previous;
+    //! The next rotation time, in seconds since the Epoch, or the minimum value if the predicate has not been called yet
+    mutable std::time_t m_NextRotation;
 
 public:
     /*!
@@ -306,13 +353,29 @@ public:
 
     /*!
      * Checks if it's time to rotate the file
+     *
+     * \note The next rotation time is calculated when the predicate is first called and after every rotation.
+     *       Otherwise the check only involves reading the current time.
      */
-    BOOST_LOG_API bool operator() () const;
+    bool operator() () const
+    {
+        const std::time_t now = std::time(NULL);
+        if (BOOST_LIKELY(now < m_NextRotation))
+            return false;
+
+        return update_next_rotation(now);
+    }
+
+private:
+    //! Calculates the next rotation time. Returns \c true if the file should be rotated.
+    BOOST_LOG_API bool update_next_rotation(std::time_t now) const;
 };
 
 /*!
  * The class represents the time interval of log file rotation. The log file will be rotated
  * after the specified time interval has passed.
+ *
+ * The time interval is measured with a monotonic clock, so it is not affected by system time adjustments.
  */
 class rotation_at_time_interval
 {
@@ -320,8 +383,14 @@ public:
     typedef bool result_type;
 
 private:
-    posix_time::time_duration m_Interval;
-    mutable posix_time::ptime m_Previous;
+    //! Clock type used to measure the interval
+    typedef std::chrono::steady_clock clock_type;
+    //! Clock tick count type
+    typedef clock_type::duration::rep tick_count_type;
+
+    tick_count_type m_Interval;
+    //! The next rotation time, in clock ticks, or the minimum value if the predicate has not been called yet
+    mutable tick_count_type m_NextRotation;
 
 public:
     /*!
@@ -330,7 +399,8 @@ public:
      * \param interval The interval of the rotation, should be no less than 1 second
      */
     explicit rotation_at_time_interval(posix_time::time_duration const& interval) :
-        m_Interval(interval)
+        m_Interval(std::chrono::duration_cast< clock_type::duration >(std::chrono::microseconds(interval.total_microseconds())).count()),
+        m_NextRotation((std::numeric_limits< tick_count_type >::min)())
     {
         BOOST_ASSERT(!interval.is_special());
         BOOST_ASSERT(interval.total_seconds() > 0);
@@ -339,7 +409,16 @@ public:
     /*!
      * Checks if it's time to rotate the file
      */
-    BOOST_LOG_API bool operator() () const;
+    bool operator() () const
+    {
+        const tick_count_type now = clock_type::now().time_since_epoch().count();
+        if (BOOST_LIKELY(now < m_NextRotation))
+            return false;
+
+        const bool result = m_NextRotation != (std::numeric_limits< tick_count_type >::min)();
+        m_NextRotation = now + m_Interval;
+        return result;
+    }
 };
 
 } // namespace file
@@ -548,6 +627,55 @@ public:
      */
     BOOST_LOG_API void set_auto_newline_mode(auto_newline_mode mode);
 
+    /*!
+     * Enables or disables group commit mode. In this mode, the data written to the file is committed to the storage
+     * device (e.g. with \c fdatasync), which makes the written records durable. In order to reduce the commit
+     * overhead, records are committed in groups: a commit is performed when \a max_group_size records have been
+     * written since the previous commit, or when the oldest uncommitted record has been written more than
+     * \a max_delay ago. The written records are flushed from the file stream buffer once per group, right before
+     * the commit, so the \c auto_flush setting has no effect in this mode. In multithreaded builds, flushes and commits
+     * are performed in a dedicated thread, so the backend continues to write records while the previous group is being
+     * committed. In addition, \c flush commits all written records and the file is committed before it is closed on rotation.
+     *
+     * Every record written in this mode is assigned a durability ticket. Threads that need to know that their
+     * records are durable can obtain the ticket with \c get_durability_ticket after their records have been
+     * passed to the backend and then call \c wait_until_durable with the ticket.
+     *
+     * If flushing or committing the written data fails, the error is thrown from \c wait_until_durable for the records
+     * that were not committed and from \c flush. Since the data of the file cannot be trusted to be durable after a failed
+     * commit, the records written to the same file later are also reported as not committed. The error is not reported
+     * by writing records or rotating the file, so that logging is not interrupted by it.
+     *
+     * \note Committing data to the storage is only supported on POSIX systems. On other systems, the written
+     *       data is only flushed from the stream buffer.
+     *
+     * \param max_group_size The maximum number of records in a group. If 0, group commit is disabled.
+     * \param max_delay The maximum time a written record may stay uncommitted.
+     */
+    BOOST_LOG_API void set_group_commit(uintmax_t max_group_size, std::chrono::microseconds max_delay = std::chrono::milliseconds(10));
+
+    /*!
+     * Returns the durability ticket of the last record written to the file. The ticket can be passed to \c wait_until_durable
+     * to wait until the record, and all records written before it, are committed to the storage. This method is thread-safe.
+     *
+     * \note When used with an asynchronous sink frontend, the ticket only covers records that the frontend has already
+     *       passed to the backend. Flush the sink first to make sure all records emitted by the current thread are covered.
+     *
+     * \return The durability ticket. If group commit is not enabled, returns 0.
+     */
+    BOOST_LOG_API uintmax_t get_durability_ticket() const;
+
+    /*!
+     * Blocks until the record with the specified durability ticket is committed to the storage. The method wakes
+     * the group commit to start committing without waiting for the group to fill. This method is thread-safe.
+     *
+     * \param ticket The durability ticket returned by \c get_durability_ticket. If group commit is not enabled,
+     *                the method returns immediately.
+     *
+     * \b Throws: <tt>boost::system::system_error</tt> if the record could not be committed.
+     */
+    BOOST_LOG_API void wait_until_durable(uintmax_t ticket);
+
     /*!
      * \return The name of the currently open log file. If no file is open, returns an empty path.
      */
@@ -624,6 +752,8 @@ private:
 
     //! Closes the currently open file
     void close_file();
+    //! Writes the formatted log record to the file
+    void write_formatted_message(string_type const& formatted_message);
 #endif // BOOST_LOG_DOXYGEN_PASS
 };
 
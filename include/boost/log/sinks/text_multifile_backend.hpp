@@ -18,6 +18,8 @@
 #include <ios>
 #include <string>
 #include <locale>
+#include <chrono>
+#include <cstddef>
 #include <ostream>
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/bool.hpp>
@@ -27,9 +29,12 @@
 #include <boost/log/detail/light_function.hpp>
 #include <boost/log/detail/parameter_tools.hpp>
 #include <boost/log/detail/cleanup_scope_guard.hpp>
+#include <boost/log/keywords/auto_flush.hpp>
 #include <boost/log/keywords/auto_newline_mode.hpp>
+#include <boost/log/keywords/max_open_files.hpp>
 #include <boost/log/sinks/auto_newline_mode.hpp>
 #include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
 #include <boost/log/utility/formatting_ostream.hpp>
 #include <boost/log/detail/header.hpp>
 
@@ -137,12 +142,22 @@ namespace file {
  * The particular file is chosen upon each record's attribute values, which allows
  * to distribute records into individual files or to group records related to
  * some entity or process in a separate file.
+ *
+ * By default, the backend opens and closes the file for every log record. Optionally,
+ * the backend can keep a limited number of recently used files open, which avoids
+ * the file open and close overhead when records are often written to the same files.
  */
 class text_multifile_backend :
-    public basic_formatted_sink_backend< char >
+    public basic_formatted_sink_backend<
+        char,
+        combine_requirements< synchronized_feeding, flushing >::type
+    >
 {
     //! Base type
-    typedef basic_formatted_sink_backend< char > base_type;
+    typedef basic_formatted_sink_backend<
+        char,
+        combine_requirements< synchronized_feeding, flushing >::type
+    > base_type;
 
 public:
     //! Character type
@@ -174,6 +189,11 @@ public:
      *
      * \li \c auto_newline_mode - Specifies automatic trailing newline insertion mode. Must be a value of
      *                            the \c auto_newline_mode enum. By default, is <tt>auto_newline_mode::insert_if_missing</tt>.
+     * \li \c max_open_files - Specifies the maximum number of files the backend keeps open between writing
+     *                          log records. By default, is 0, which means every file is closed after writing
+     *                          each log record. See \c set_file_cache.
+     * \li \c auto_flush - Specifies a flag, whether or not to automatically flush the file after each
+     *                      written log record. Only has effect when the backend keeps files open. By default, is \c false.
      */
 #ifndef BOOST_LOG_DOXYGEN_PASS
     BOOST_LOG_PARAMETRIZED_CONSTRUCTORS_CALL(text_multifile_backend, construct)
@@ -206,21 +226,56 @@ public:
      */
     BOOST_LOG_API void set_auto_newline_mode(auto_newline_mode mode);
 
+    /*!
+     * Sets the limits of the open file cache. The backend keeps up to \a max_open_files recently used files
+     * open, so that consecutive log records written to the same file do not reopen it. When the limit
+     * is reached, the least recently used file is closed. Files that have not been written to for longer than
+     * \a idle_timeout are closed when the next log record is written or the backend is flushed.
+     *
+     * While a file is kept open, the written log records may stay in the file buffer until the file is flushed
+     * or closed. Use \c auto_flush or \c flush to make the records visible to other readers of the file.
+     *
+     * \param max_open_files The maximum number of files kept open. If 0, every file is closed right after writing
+     *                       a log record, which is the default.
+     * \param idle_timeout The time after which an unused file is closed. If zero, files are only closed
+     *                     when evicted from the cache.
+     */
+    BOOST_LOG_API void set_file_cache(std::size_t max_open_files, std::chrono::milliseconds idle_timeout = std::chrono::seconds(60));
+
+    /*!
+     * Sets the flag to automatically flush the file buffer after each written log record. Only has effect
+     * when the backend keeps files open.
+     *
+     * \param enable The flag indicates whether the automatic buffer flush should be performed.
+     */
+    BOOST_LOG_API void auto_flush(bool enable = true);
+
     /*!
      * The method writes the message to the sink
      */
     BOOST_LOG_API void consume(record_view const& rec, string_type const& formatted_message);
 
+    /*!
+     * The method flushes all files kept open by the backend and closes the files that have been idle
+     * for longer than the configured timeout
+     */
+    BOOST_LOG_API void flush();
+
 private:
 #ifndef BOOST_LOG_DOXYGEN_PASS
     //! Constructor implementation
     template< typename ArgsT >
     void construct(ArgsT const& args)
     {
-        construct(args[keywords::auto_newline_mode | insert_if_missing]);
+        construct
+        (
+            args[keywords::auto_newline_mode | insert_if_missing],
+            args[keywords::max_open_files | static_cast< std::size_t >(0u)],
+            args[keywords::auto_flush | false]
+        );
     }
     //! Constructor implementation
-    BOOST_LOG_API void construct(auto_newline_mode auto_newline);
+    BOOST_LOG_API void construct(auto_newline_mode auto_newline, std::size_t max_open_files, bool auto_flush);
 
     //! The method sets the file name composer
     BOOST_LOG_API void set_file_name_composer_internal(file_name_composer_type const& composer);
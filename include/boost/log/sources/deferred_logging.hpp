@@ -0,0 +1,117 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   deferred_logging.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * This header contains macros for deferred logging. Unlike the streaming macros, deferred logging
+ * statements do not format the message text. Instead, the argument values are copied into the log record
+ * in a compact binary form, along with a reference to the static description of the statement. The message
+ * text is formatted when the record is output by a sink, or later, when a binary log file is decoded.
+ */
+
+#ifndef BOOST_LOG_SOURCES_DEFERRED_LOGGING_HPP_INCLUDED_
+#define BOOST_LOG_SOURCES_DEFERRED_LOGGING_HPP_INCLUDED_
+
+#include <utility>
+#include <boost/move/utility_core.hpp>
+#include <boost/preprocessor/seq/enum.hpp>
+#include <boost/preprocessor/variadic/elem.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/default_attribute_names.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include <boost/log/utility/unique_identifier_name.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+//! The function attaches the deferred message to the record and pushes the record to the logger
+template< typename LoggerT, std::size_t N, typename... ArgsT >
+BOOST_FORCEINLINE void push_deferred_record(LoggerT& lg, record& rec, deferred_message_site const& site, const char (&)[N], ArgsT const&... args)
+{
+    attribute_value value = aux::make_deferred_message_value(site, args...);
+
+    // This may fail if the record already has Message attribute
+    std::pair< attribute_value_set::const_iterator, bool > res = rec.attribute_values().insert(default_attribute_names::message(), value);
+    if (!res.second)
+        const_cast< attribute_value& >(res.first->second).swap(value);
+
+    lg.push_record(boost::move(rec));
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#ifndef BOOST_LOG_DOXYGEN_PASS
+
+#define BOOST_LOG_DEFERRED_INTERNAL(logger, rec_var, site_var, args_var, open_record_args, ...)\
+    do\
+    {\
+        for (::boost::log::record rec_var = (logger).open_record open_record_args; !!rec_var;)\
+        {\
+            typedef decltype(::boost::log::aux::deduce_deferred_arguments(__VA_ARGS__)) args_var;\
+            static const ::boost::log::deferred_message_site site_var =\
+            {\
+                "" BOOST_PP_VARIADIC_ELEM(0, __VA_ARGS__),\
+                static_cast< unsigned int >(sizeof(BOOST_PP_VARIADIC_ELEM(0, __VA_ARGS__)) - 1u),\
+                __FILE__,\
+                __LINE__,\
+                args_var::size,\
+                args_var::types\
+            };\
+            ::boost::log::aux::push_deferred_record((logger), rec_var, site_var, __VA_ARGS__);\
+        }\
+    }\
+    while (false)
+
+#endif // BOOST_LOG_DOXYGEN_PASS
+
+/*!
+ * The macro writes a deferred record to the log. The first argument after the logger must be a string literal with
+ * the message format, the rest are the message arguments. The format string may contain placeholders <tt>%N%</tt>,
+ * where \c N is a 1-based argument index.
+ */
+#define BOOST_LOG_DEFERRED(logger, ...)\
+    BOOST_LOG_DEFERRED_INTERNAL(logger, BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_record_),\
+        BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_deferred_site_), BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_deferred_args_), (), __VA_ARGS__)
+
+/*!
+ * The macro writes a deferred record to the log and allows to pass additional named arguments to the logger
+ */
+#define BOOST_LOG_DEFERRED_WITH_PARAMS(logger, params_seq, ...)\
+    BOOST_LOG_DEFERRED_INTERNAL(logger, BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_record_),\
+        BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_deferred_site_), BOOST_LOG_UNIQUE_IDENTIFIER_NAME(_boost_log_deferred_args_), ((BOOST_PP_SEQ_ENUM(params_seq))), __VA_ARGS__)
+
+/*!
+ * The macro writes a deferred record with a specific severity level to the log
+ */
+#define BOOST_LOG_DEFERRED_SEV(logger, lvl, ...)\
+    BOOST_LOG_DEFERRED_WITH_PARAMS((logger), (::boost::log::keywords::severity = (lvl)), __VA_ARGS__)
+
+#endif // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_SOURCES_DEFERRED_LOGGING_HPP_INCLUDED_
@@ -60,13 +60,9 @@ inline void decompose_date(DateT const& d, boost::log::aux::decomposed_time_wrap
     v.day = static_cast< uint32_t >(ymd.day);
 }
 
-template< typename TimeDurationT, typename ValueT >
-inline void decompose_time_of_day(TimeDurationT const& tod, boost::log::aux::decomposed_time_wrapper< ValueT >& v)
+template< typename TimeDurationT >
+inline uint32_t to_subseconds(TimeDurationT const& dur)
 {
-    v.hours = static_cast< uint32_t >(tod.hours());
-    v.minutes = static_cast< uint32_t >(tod.minutes());
-    v.seconds = static_cast< uint32_t >(tod.seconds());
-
     typedef typename TimeDurationT::traits_type traits_type;
     enum
     {
@@ -74,8 +70,17 @@ inline void decompose_time_of_day(TimeDurationT const& tod, boost::log::aux::dec
             traits_type::ticks_per_second / boost::log::aux::decomposed_time::subseconds_per_second :
             boost::log::aux::decomposed_time::subseconds_per_second / traits_type::ticks_per_second)
     };
-    uint64_t frac = tod.fractional_seconds();
-    v.subseconds = static_cast< uint32_t >(traits_type::ticks_per_second > boost::log::aux::decomposed_time::subseconds_per_second ? frac / adjustment_ratio : frac * adjustment_ratio);
+    uint64_t frac = dur.fractional_seconds();
+    return static_cast< uint32_t >(traits_type::ticks_per_second > boost::log::aux::decomposed_time::subseconds_per_second ? frac / adjustment_ratio : frac * adjustment_ratio);
+}
+
+template< typename TimeDurationT, typename ValueT >
+inline void decompose_time_of_day(TimeDurationT const& tod, boost::log::aux::decomposed_time_wrapper< ValueT >& v)
+{
+    v.hours = static_cast< uint32_t >(tod.hours());
+    v.minutes = static_cast< uint32_t >(tod.minutes());
+    v.seconds = static_cast< uint32_t >(tod.seconds());
+    v.subseconds = (to_subseconds)(tod);
 }
 
 template< typename TimeDurationT, typename ValueT >
@@ -109,6 +114,17 @@ inline void decompose_time(TimeT const& t, boost::log::aux::decomposed_time_wrap
     (decompose_time_of_day)(t.time_of_day(), v);
 }
 
+//! Fills fractional seconds of the decomposed time and returns the sequential number of the second of the time point
+template< typename TimeT, typename ValueT >
+inline uint64_t decompose_subseconds(TimeT const& t, boost::log::aux::decomposed_time_wrapper< ValueT >& v)
+{
+    typedef typename TimeT::time_duration_type time_duration_type;
+    typedef typename time_duration_type::traits_type traits_type;
+    const time_duration_type tod = t.time_of_day();
+    v.subseconds = (to_subseconds)(tod);
+    return static_cast< uint64_t >(t.date().day_number()) * 86400u + static_cast< uint64_t >(tod.ticks() / traits_type::ticks_per_second);
+}
+
 } // namespace date_time_support
 
 template< typename TimeT, typename CharT >
@@ -163,10 +179,16 @@ struct date_time_formatter_generator_traits_impl
             else
             {
                 boost::log::aux::decomposed_time_wrapper< value_type > val(value);
-                date_time_support::decompose_time(value, val);
-                base_type::operator() (strm, val);
+                const uint64_t second = date_time_support::decompose_subseconds(value, val);
+                base_type::format_cached(strm, val, second, &formatter::decompose);
             }
         }
+
+    private:
+        static void decompose(boost::log::aux::decomposed_time_wrapper< value_type >& val)
+        {
+            date_time_support::decompose_time(val.m_time, val);
+        }
     };
 
     //! The function parses format string and constructs formatter function
@@ -238,8 +260,8 @@ struct date_time_formatter_generator_traits< local_time::local_date_time_base< T
             else
             {
                 boost::log::aux::decomposed_time_wrapper< value_type > val(value);
-                date_time_support::decompose_time(value.local_time(), val);
-                base_type::operator() (strm, val);
+                const uint64_t second = date_time_support::decompose_subseconds(value.local_time(), val);
+                base_type::format_cached(strm, val, second, &formatter::decompose);
             }
         }
 
@@ -255,6 +277,12 @@ struct date_time_formatter_generator_traits< local_time::local_date_time_base< T
             ctx.strm << ctx.value.m_time.zone_name(true);
             ctx.strm.flush();
         }
+
+    private:
+        static void decompose(boost::log::aux::decomposed_time_wrapper< value_type >& val)
+        {
+            date_time_support::decompose_time(val.m_time.local_time(), val);
+        }
     };
 
     class formatter_builder :
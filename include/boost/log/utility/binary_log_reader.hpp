@@ -0,0 +1,102 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   utility/binary_log_reader.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * The header contains a reader of the log files written by \c binary_file_backend.
+ */
+
+#ifndef BOOST_LOG_UTILITY_BINARY_LOG_READER_HPP_INCLUDED_
+#define BOOST_LOG_UTILITY_BINARY_LOG_READER_HPP_INCLUDED_
+
+#include <boost/filesystem/path.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+/*!
+ * \brief A reader of the binary log files
+ *
+ * The reader decodes log files written by \c binary_file_backend and reconstructs attribute values
+ * of the written log records. The attribute values have the same types as the values that were written,
+ * except that \c string_literal values are read as \c std::string and \c long \c double values are read
+ * with \c double precision. Deferred messages are read as \c deferred_message values, which can be formatted
+ * as usual. The decoded attribute values do not depend on the reader and can outlive it.
+ *
+ * The reader can be used to push the records to the logging core, so that they are processed by the sinks
+ * of the current process:
+ *
+ * <code>
+ * attribute_value_set values;
+ * while (reader.read(values))
+ * {
+ *     record rec = core::get()->open_record(boost::move(values));
+ *     if (rec)
+ *         core::get()->push_record(boost::move(rec));
+ *     values = attribute_value_set();
+ * }
+ * </code>
+ */
+class binary_log_reader
+{
+private:
+    //! \cond
+
+    struct implementation;
+    implementation* m_pImpl;
+
+    //! \endcond
+
+public:
+    /*!
+     * Constructor. Opens the file for reading.
+     *
+     * \param file_name The name of the file to read.
+     *
+     * <b>Throws:</b> \c system_error if the file cannot be opened.
+     */
+    BOOST_LOG_API explicit binary_log_reader(filesystem::path const& file_name);
+
+    /*!
+     * Destructor. Closes the file.
+     */
+    BOOST_LOG_API ~binary_log_reader();
+
+    /*!
+     * The method reads the next record from the file and inserts its attribute values into \a values.
+     *
+     * \param values The container of the attribute values of the record.
+     *
+     * \return \c true if a record was read, \c false if the end of file has been reached.
+     *
+     * <b>Throws:</b> \c parse_error if the file is corrupted. In this case the records of the damaged block
+     *                are skipped, and the next call to this method continues reading from the next part of
+     *                the file that can be decoded.
+     */
+    BOOST_LOG_API bool read(attribute_value_set& values);
+
+    BOOST_DELETED_FUNCTION(binary_log_reader(binary_log_reader const&))
+    BOOST_DELETED_FUNCTION(binary_log_reader& operator= (binary_log_reader const&))
+};
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_UTILITY_BINARY_LOG_READER_HPP_INCLUDED_
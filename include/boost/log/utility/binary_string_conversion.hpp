@@ -0,0 +1,85 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   utility/binary_string_conversion.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * The header contains the function for registering string conversions of attribute value types
+ * for the binary log formats.
+ */
+
+#ifndef BOOST_LOG_UTILITY_BINARY_STRING_CONVERSION_HPP_INCLUDED_
+#define BOOST_LOG_UTILITY_BINARY_STRING_CONVERSION_HPP_INCLUDED_
+
+#include <string>
+#include <boost/type_index.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+//! The function type that converts an attribute value to a string. Returns \c false if the value has a different type.
+typedef bool (*binary_string_converter)(attribute_value const& value, std::string& str);
+
+//! Registers the string conversion for the attribute value type
+BOOST_LOG_API void register_binary_string_converter(typeindex::type_index const& type, binary_string_converter converter);
+
+//! Converts the attribute value of type \c T to a string, as it would be formatted by the record stream
+template< typename T >
+bool convert_to_binary_string(attribute_value const& value, std::string& str)
+{
+    value_ref< T > ref = value.extract< T >();
+    if (!ref)
+        return false;
+
+    basic_formatting_ostream< char > strm(str);
+    strm << ref.get();
+    strm.flush();
+    return true;
+}
+
+} // namespace aux
+
+/*!
+ * The function registers a conversion of attribute values of type \c T to strings for the binary log formats.
+ *
+ * The binary sink backends, such as \c binary_file_backend and \c binary_ipc_message_queue_backend, only write
+ * attribute values of a fixed set of types. Values of other types, for example user-defined severity level
+ * enums, are skipped, unless a conversion is registered for the type. The registered conversion formats the value
+ * with <tt>operator&lt;&lt;</tt>, and the backends write the formatted value as a string. The string is read back
+ * as an \c std::string value.
+ *
+ * The function is thread-safe, registering a conversion for a type again has no effect. The conversion should
+ * be registered before the values of the type are logged, the values logged before that are skipped.
+ *
+ * \b Throws: \c std::bad_alloc if memory allocation fails.
+ */
+template< typename T >
+inline void register_binary_string_conversion()
+{
+    aux::register_binary_string_converter(typeindex::type_id< T >(), &aux::convert_to_binary_string< T >);
+}
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_UTILITY_BINARY_STRING_CONVERSION_HPP_INCLUDED_
@@ -0,0 +1,461 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   utility/deferred_message.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * The header contains the deferred log message type. A deferred message consists of a reference to a static
+ * description of the logging statement and a compact binary representation of the message arguments. Formatting
+ * of the message text is postponed until the message is output, possibly in a different thread or process.
+ */
+
+#ifndef BOOST_LOG_UTILITY_DEFERRED_MESSAGE_HPP_INCLUDED_
+#define BOOST_LOG_UTILITY_DEFERRED_MESSAGE_HPP_INCLUDED_
+
+#include <new>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <boost/cstdint.hpp>
+#include <boost/type_index.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/decay.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_function.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_pointer.hpp>
+#include <boost/utility/string_view.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/is_character_type.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/type_dispatch/type_dispatcher.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+#include <string_view>
+#endif
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace deferred_argument {
+
+/*!
+ * \brief Types of the deferred message arguments
+ *
+ * The values are stored in the deferred message site descriptions and in binary log files and must not be changed.
+ */
+enum type
+{
+    end_of_arguments = 0,   //!< The end of the argument list
+    boolean = 1,            //!< A \c bool value, stored as a single byte
+    character = 2,          //!< A narrow character, stored as a single byte
+    signed_integer = 3,     //!< A signed integer, stored as a 64-bit integer
+    unsigned_integer = 4,   //!< An unsigned integer, stored as a 64-bit integer
+    floating_point = 5,     //!< A floating point number, stored as a \c double
+    string = 6,             //!< A narrow string, stored as a 32-bit length followed by the characters
+    string_literal = 7,     //!< A narrow string literal, stored as a pointer followed by a 32-bit length
+    pointer = 8             //!< A pointer, stored as a 64-bit integer
+};
+
+} // namespace deferred_argument
+
+/*!
+ * \brief Static description of a deferred logging statement
+ *
+ * An object of this type is created for every deferred logging statement in the program and has static storage duration.
+ * The format string may contain placeholders <tt>%N%</tt>, where \c N is a 1-based argument index. The <tt>%%</tt>
+ * sequence is replaced with a single percent character.
+ */
+struct deferred_message_site
+{
+    //! Format string
+    const char* format;
+    //! Format string length
+    unsigned int format_size;
+    //! Source file name
+    const char* file;
+    //! Source line number
+    unsigned int line;
+    //! Number of arguments
+    unsigned int argument_count;
+    //! Argument types, \c argument_count elements of the \c deferred_argument::type values, followed by a zero
+    const unsigned char* argument_types;
+};
+
+/*!
+ * \brief Deferred log message
+ *
+ * The class is a lightweight reference to the statement description and the encoded argument values.
+ * Objects of this class are stored in log records as the message attribute value when deferred logging
+ * macros are used. The message text can be obtained by outputting the object into a stream.
+ */
+class deferred_message
+{
+private:
+    //! Statement description
+    deferred_message_site const* m_site;
+    //! Encoded arguments
+    const unsigned char* m_arguments;
+    //! Encoded arguments size, in bytes
+    std::size_t m_arguments_size;
+
+public:
+    /*!
+     * Initializing constructor
+     */
+    deferred_message(deferred_message_site const& site, const unsigned char* args, std::size_t args_size) BOOST_NOEXCEPT :
+        m_site(&site),
+        m_arguments(args),
+        m_arguments_size(args_size)
+    {
+    }
+
+    /*!
+     * \return The statement description
+     */
+    deferred_message_site const& site() const BOOST_NOEXCEPT { return *m_site; }
+    /*!
+     * \return Pointer to the encoded argument values
+     */
+    const unsigned char* arguments() const BOOST_NOEXCEPT { return m_arguments; }
+    /*!
+     * \return Size of the encoded argument values, in bytes
+     */
+    std::size_t arguments_size() const BOOST_NOEXCEPT { return m_arguments_size; }
+};
+
+namespace aux {
+
+//! The function formats the deferred message into the stream
+template< typename CharT >
+BOOST_LOG_API void format_deferred_message(basic_formatting_ostream< CharT >& strm, deferred_message const& msg);
+
+//! The metafunction returns the deferred argument type for the decayed C++ type of the logging statement argument, zero means the argument has to be formatted by the caller
+template< typename T >
+struct deferred_argument_type_of
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned int value =
+        is_same< T, bool >::value ? static_cast< unsigned int >(deferred_argument::boolean) :
+        (is_same< T, char >::value || is_same< T, signed char >::value || is_same< T, unsigned char >::value) ? static_cast< unsigned int >(deferred_argument::character) :
+        (is_character_type< T >::value || is_same< T, long double >::value) ? 0u :
+        (is_integral< T >::value && is_signed< T >::value) ? static_cast< unsigned int >(deferred_argument::signed_integer) :
+        is_integral< T >::value ? static_cast< unsigned int >(deferred_argument::unsigned_integer) :
+        is_floating_point< T >::value ? static_cast< unsigned int >(deferred_argument::floating_point) :
+        (is_same< T, const char* >::value || is_same< T, char* >::value || is_same< T, std::string >::value || is_same< T, boost::string_view >::value
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+            || is_same< T, std::string_view >::value
+#endif
+        ) ? static_cast< unsigned int >(deferred_argument::string) :
+        is_same< T, basic_string_literal< char > >::value ? static_cast< unsigned int >(deferred_argument::string_literal) :
+        (is_pointer< T >::value && !is_function< typename remove_pointer< T >::type >::value &&
+            !is_character_type< typename remove_cv< typename remove_pointer< T >::type >::type >::value) ? static_cast< unsigned int >(deferred_argument::pointer) :
+        0u;
+};
+
+//! The trait converts logging statement arguments into one of the canonical types that can be stored in the deferred message
+template< typename T, unsigned int Type = deferred_argument_type_of< T >::value >
+struct deferred_argument_traits
+{
+    //! The argument will be stored as a string
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::string);
+
+    //! Formats the argument into a string, as it would be formatted by the message stream
+    static std::string prepare(T const& value)
+    {
+        std::string str;
+        basic_formatting_ostream< char > strm(str);
+        strm << value;
+        strm.flush();
+        return str;
+    }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::boolean >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::boolean);
+    static bool prepare(bool value) BOOST_NOEXCEPT { return value; }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::character >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::character);
+    static char prepare(T value) BOOST_NOEXCEPT { return static_cast< char >(value); }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::signed_integer >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::signed_integer);
+    static boost::int64_t prepare(T value) BOOST_NOEXCEPT { return static_cast< boost::int64_t >(value); }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::unsigned_integer >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::unsigned_integer);
+    static boost::uint64_t prepare(T value) BOOST_NOEXCEPT { return static_cast< boost::uint64_t >(value); }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::floating_point >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::floating_point);
+    static double prepare(T value) BOOST_NOEXCEPT { return static_cast< double >(value); }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::string >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::string);
+    static boost::string_view prepare(const char* value) BOOST_NOEXCEPT { return value ? boost::string_view(value) : boost::string_view(); }
+    static boost::string_view prepare(std::string const& value) BOOST_NOEXCEPT { return boost::string_view(value.data(), value.size()); }
+    static boost::string_view prepare(boost::string_view value) BOOST_NOEXCEPT { return value; }
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+    static boost::string_view prepare(std::string_view value) BOOST_NOEXCEPT { return boost::string_view(value.data(), value.size()); }
+#endif
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::string_literal >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::string_literal);
+    static basic_string_literal< char > const& prepare(basic_string_literal< char > const& value) BOOST_NOEXCEPT { return value; }
+};
+
+template< typename T >
+struct deferred_argument_traits< T, deferred_argument::pointer >
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned char type = static_cast< unsigned char >(deferred_argument::pointer);
+    static const void* prepare(T value) BOOST_NOEXCEPT { return value; }
+};
+
+//! Returns the encoded argument size
+inline std::size_t deferred_argument_size(bool) BOOST_NOEXCEPT { return 1u; }
+inline std::size_t deferred_argument_size(char) BOOST_NOEXCEPT { return 1u; }
+inline std::size_t deferred_argument_size(boost::int64_t) BOOST_NOEXCEPT { return sizeof(boost::int64_t); }
+inline std::size_t deferred_argument_size(boost::uint64_t) BOOST_NOEXCEPT { return sizeof(boost::uint64_t); }
+inline std::size_t deferred_argument_size(double) BOOST_NOEXCEPT { return sizeof(double); }
+inline std::size_t deferred_argument_size(boost::string_view const& value) BOOST_NOEXCEPT { return sizeof(boost::uint32_t) + value.size(); }
+inline std::size_t deferred_argument_size(std::string const& value) BOOST_NOEXCEPT { return sizeof(boost::uint32_t) + value.size(); }
+inline std::size_t deferred_argument_size(basic_string_literal< char > const&) BOOST_NOEXCEPT { return sizeof(const char*) + sizeof(boost::uint32_t); }
+inline std::size_t deferred_argument_size(const void*) BOOST_NOEXCEPT { return sizeof(boost::uint64_t); }
+
+//! Encodes the argument and returns the pointer past the encoded value
+inline unsigned char* encode_deferred_argument(unsigned char* p, bool value) BOOST_NOEXCEPT
+{
+    *p = static_cast< unsigned char >(value);
+    return p + 1;
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, char value) BOOST_NOEXCEPT
+{
+    *p = static_cast< unsigned char >(value);
+    return p + 1;
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, boost::int64_t value) BOOST_NOEXCEPT
+{
+    std::memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, boost::uint64_t value) BOOST_NOEXCEPT
+{
+    std::memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, double value) BOOST_NOEXCEPT
+{
+    std::memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+inline unsigned char* encode_deferred_string(unsigned char* p, const char* str, std::size_t size) BOOST_NOEXCEPT
+{
+    const boost::uint32_t len = static_cast< boost::uint32_t >(size);
+    std::memcpy(p, &len, sizeof(len));
+    p += sizeof(len);
+    if (len > 0u)
+        std::memcpy(p, str, len);
+    return p + len;
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, boost::string_view const& value) BOOST_NOEXCEPT
+{
+    return encode_deferred_string(p, value.data(), value.size());
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, std::string const& value) BOOST_NOEXCEPT
+{
+    return encode_deferred_string(p, value.data(), value.size());
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, basic_string_literal< char > const& value) BOOST_NOEXCEPT
+{
+    const char* const str = value.c_str();
+    const boost::uint32_t len = static_cast< boost::uint32_t >(value.size());
+    std::memcpy(p, &str, sizeof(str));
+    p += sizeof(str);
+    std::memcpy(p, &len, sizeof(len));
+    return p + sizeof(len);
+}
+
+inline unsigned char* encode_deferred_argument(unsigned char* p, const void* value) BOOST_NOEXCEPT
+{
+    const boost::uint64_t n = static_cast< boost::uint64_t >(reinterpret_cast< std::size_t >(value));
+    std::memcpy(p, &n, sizeof(n));
+    return p + sizeof(n);
+}
+
+/*!
+ * \brief Deferred message attribute value implementation
+ *
+ * The encoded arguments are stored in the same memory block, immediately after the object.
+ */
+class deferred_message_value :
+    public attribute_value::impl
+{
+private:
+    //! The message
+    const deferred_message m_message;
+
+public:
+    //! Tag type for the allocation function
+    struct allocation_tag {};
+
+public:
+    //! Initializing constructor
+    deferred_message_value(deferred_message_site const& site, std::size_t args_size) BOOST_NOEXCEPT :
+        m_message(site, reinterpret_cast< const unsigned char* >(this + 1), args_size)
+    {
+    }
+
+    //! Returns the pointer to the storage for the encoded arguments
+    unsigned char* arguments() BOOST_NOEXCEPT { return reinterpret_cast< unsigned char* >(this + 1); }
+
+    bool dispatch(type_dispatcher& dispatcher) BOOST_OVERRIDE
+    {
+        type_dispatcher::callback< deferred_message > callback = dispatcher.get_callback< deferred_message >();
+        if (callback)
+        {
+            callback(m_message);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    typeindex::type_index get_type() const BOOST_OVERRIDE { return typeindex::type_id< deferred_message >(); }
+
+    //! Allocates memory for the object and the encoded arguments
+    static void* operator new (std::size_t size, allocation_tag, std::size_t args_size)
+    {
+        return ::operator new(size + args_size);
+    }
+    //! Frees memory if the constructor throws
+    static void operator delete (void* p, allocation_tag, std::size_t) BOOST_NOEXCEPT
+    {
+        ::operator delete(p);
+    }
+    //! Frees memory
+    static void operator delete (void* p) BOOST_NOEXCEPT
+    {
+        ::operator delete(p);
+    }
+};
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+//! Argument types list of a deferred logging statement
+template< typename... ArgsT >
+struct deferred_argument_list
+{
+    static BOOST_CONSTEXPR_OR_CONST unsigned int size = sizeof...(ArgsT);
+    static const unsigned char types[sizeof...(ArgsT) + 1u];
+};
+
+template< typename... ArgsT >
+const unsigned char deferred_argument_list< ArgsT... >::types[sizeof...(ArgsT) + 1u] = { deferred_argument_traits< ArgsT >::type..., static_cast< unsigned char >(deferred_argument::end_of_arguments) };
+
+//! The function is used to deduce the argument types of a deferred logging statement. Only used in unevaluated contexts.
+template< std::size_t N, typename... ArgsT >
+deferred_argument_list< typename remove_cv< typename decay< ArgsT >::type >::type... > deduce_deferred_arguments(const char (&format)[N], ArgsT const&... args);
+
+template< typename... PreparedArgsT >
+inline attribute_value encode_deferred_arguments(deferred_message_site const& site, PreparedArgsT const&... args)
+{
+    std::size_t args_size = 0u;
+    const int sizes[] = { 0, (args_size += deferred_argument_size(args), 0)... };
+    (void)sizes;
+
+    deferred_message_value* p = new (deferred_message_value::allocation_tag(), args_size) deferred_message_value(site, args_size);
+
+    unsigned char* out = p->arguments();
+    const int encoded[] = { 0, (out = encode_deferred_argument(out, args), 0)... };
+    (void)encoded;
+    (void)out;
+
+    return attribute_value(p);
+}
+
+//! Creates the message attribute value for a deferred logging statement
+template< typename... ArgsT >
+BOOST_FORCEINLINE attribute_value make_deferred_message_value(deferred_message_site const& site, ArgsT const&... args)
+{
+    return aux::encode_deferred_arguments(site, deferred_argument_traits< typename remove_cv< typename decay< ArgsT >::type >::type >::prepare(args)...);
+}
+
+#endif // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+} // namespace aux
+
+/*!
+ * The operator formats the deferred message into the stream
+ */
+template< typename CharT >
+inline basic_formatting_ostream< CharT >& operator<< (basic_formatting_ostream< CharT >& strm, deferred_message const& msg)
+{
+    aux::format_deferred_message(strm, msg);
+    return strm;
+}
+
+/*!
+ * The operator formats the deferred message into the stream
+ */
+template< typename CharT, typename TraitsT >
+inline std::basic_ostream< CharT, TraitsT >& operator<< (std::basic_ostream< CharT, TraitsT >& strm, deferred_message const& msg)
+{
+    std::basic_string< CharT > str;
+    basic_formatting_ostream< CharT > fstrm(str);
+    aux::format_deferred_message(fstrm, msg);
+    fstrm.flush();
+    strm << str;
+    return strm;
+}
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_UTILITY_DEFERRED_MESSAGE_HPP_INCLUDED_
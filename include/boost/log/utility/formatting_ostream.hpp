@@ -34,6 +34,22 @@
 #include <boost/log/detail/code_conversion.hpp>
 #include <boost/log/utility/string_literal_fwd.hpp>
 #include <boost/log/utility/formatting_ostream_fwd.hpp>
+
+#if defined(BOOST_LOG_USE_STD_CHARCONV) && ((defined(__cplusplus) && __cplusplus >= 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#define BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+// Floating point std::to_chars is only available in newer standard libraries
+#define BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_FP_TO_CHARS
+#endif
+#endif
+#endif
+
 #include <boost/log/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -477,8 +493,7 @@ public:
 
     basic_formatting_ostream& operator<< (bool value)
     {
-        m_stream << value;
-        return *this;
+        return this->bool_write(value);
     }
     basic_formatting_ostream& operator<< (signed char value)
     {
@@ -492,61 +507,55 @@ public:
     }
     basic_formatting_ostream& operator<< (short value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (unsigned short value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (int value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (unsigned int value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (long value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (unsigned long value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
 #if !defined(BOOST_NO_LONG_LONG)
     basic_formatting_ostream& operator<< (long long value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
     basic_formatting_ostream& operator<< (unsigned long long value)
     {
-        m_stream << value;
-        return *this;
+        return this->integer_write(value);
     }
 #endif
 
     basic_formatting_ostream& operator<< (float value)
     {
-        m_stream << value;
-        return *this;
+        return this->floating_point_write(static_cast< double >(value));
     }
     basic_formatting_ostream& operator<< (double value)
     {
-        m_stream << value;
-        return *this;
+        return this->floating_point_write(value);
     }
     basic_formatting_ostream& operator<< (long double value)
     {
-        m_stream << value;
-        return *this;
+        return this->floating_point_write(value);
+    }
+
+    basic_formatting_ostream& operator<< (const void* value)
+    {
+        return this->pointer_write(value);
     }
 
     basic_formatting_ostream& operator<< (std::basic_streambuf< char_type, traits_type >* buf)
@@ -726,6 +735,110 @@ protected:
     }
 
 private:
+    basic_formatting_ostream& bool_write(bool value)
+    {
+#if defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS)
+        if (is_classic_numeric_output(ostream_type::internal))
+        {
+            if ((m_stream.flags() & ostream_type::boolalpha) != 0)
+            {
+                if (value)
+                    return this->ascii_write("true", 4);
+                else
+                    return this->ascii_write("false", 5);
+            }
+
+            return this->integer_write(static_cast< int >(value));
+        }
+#endif
+
+        m_stream << value;
+        return *this;
+    }
+
+    template< typename T >
+    basic_formatting_ostream& integer_write(T value)
+    {
+#if defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS)
+        if (is_classic_numeric_output(ostream_type::oct | ostream_type::hex | ostream_type::showpos | ostream_type::internal))
+        {
+            char buf[24];
+            std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), value);
+            return this->ascii_write(buf, res.ptr - buf);
+        }
+#endif
+
+        m_stream << value;
+        return *this;
+    }
+
+    template< typename T >
+    basic_formatting_ostream& floating_point_write(T value)
+    {
+#if defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_FP_TO_CHARS)
+        // Only the general format is supported, which corresponds to the printf %g specifier used by std::num_put.
+        // Special values are formatted by the stream as their representation is implementation-specific.
+        const std::streamsize precision = m_stream.precision();
+        if (precision >= 0 && (std::isfinite)(value) &&
+            is_classic_numeric_output(ostream_type::floatfield | ostream_type::showpoint | ostream_type::showpos | ostream_type::uppercase | ostream_type::internal))
+        {
+            char buf[64];
+            std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, static_cast< int >(precision));
+            if (BOOST_LIKELY(res.ec == std::errc()))
+                return this->ascii_write(buf, res.ptr - buf);
+        }
+#endif
+
+        m_stream << value;
+        return *this;
+    }
+
+    basic_formatting_ostream& pointer_write(const void* value)
+    {
+#if defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS) && (defined(__GLIBCXX__) || defined(_LIBCPP_VERSION))
+        // Non-null pointers are formatted as hex numbers with the 0x prefix by libstdc++ and libc++. Null pointers are formatted
+        // differently depending on the standard library and the underlying C library.
+        if (value != NULL && is_classic_numeric_output(ostream_type::internal))
+        {
+            char buf[2u + sizeof(void*) * 2u];
+            buf[0] = '0';
+            buf[1] = 'x';
+            std::to_chars_result res = std::to_chars(buf + 2, buf + sizeof(buf), reinterpret_cast< boost::uintptr_t >(value), 16);
+            return this->ascii_write(buf, res.ptr - buf);
+        }
+#endif
+
+        m_stream << value;
+        return *this;
+    }
+
+#if defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS)
+    //! Checks whether numbers can be formatted bypassing \c std::num_put. The output must be the same as produced by \c std::num_put.
+    bool is_classic_numeric_output(fmtflags incompatible_flags) const
+    {
+        return (m_stream.flags() & incompatible_flags) == 0 && m_stream.getloc() == std::locale::classic();
+    }
+
+    //! Writes a string of ASCII characters, the width and alignment of the stream are applied
+    basic_formatting_ostream& ascii_write(const char* p, std::ptrdiff_t size)
+    {
+        return ascii_write(p, size, boost::integral_constant< bool, sizeof(char_type) == 1u >());
+    }
+
+    basic_formatting_ostream& ascii_write(const char* p, std::ptrdiff_t size, boost::true_type)
+    {
+        return this->formatted_write(reinterpret_cast< const char_type* >(p), static_cast< std::streamsize >(size));
+    }
+
+    basic_formatting_ostream& ascii_write(const char* p, std::ptrdiff_t size, boost::false_type)
+    {
+        char_type buf[64];
+        for (std::ptrdiff_t i = 0; i < size; ++i)
+            buf[i] = static_cast< char_type >(p[i]);
+        return this->formatted_write(buf, static_cast< std::streamsize >(size));
+    }
+#endif // defined(BOOST_LOG_AUX_FORMATTING_OSTREAM_USE_TO_CHARS)
+
     basic_formatting_ostream& formatted_write(const char_type* p, std::streamsize size)
     {
         sentry guard(*this);
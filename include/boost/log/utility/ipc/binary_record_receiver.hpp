@@ -0,0 +1,253 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   utility/ipc/binary_record_receiver.hpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * The header contains implementation of a receiver of log records sent by \c binary_ipc_message_queue_backend.
+ */
+
+#ifndef BOOST_LOG_UTILITY_IPC_BINARY_RECORD_RECEIVER_HPP_INCLUDED_
+#define BOOST_LOG_UTILITY_IPC_BINARY_RECORD_RECEIVER_HPP_INCLUDED_
+
+#include <cstddef>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/move/core.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/preprocessor/control/if.hpp>
+#include <boost/preprocessor/comparison/equal.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/parameter_tools.hpp>
+#include <boost/log/detail/binary_record_codec.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace ipc {
+
+#ifndef BOOST_LOG_DOXYGEN_PASS
+
+#define BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_1(z, n, data)\
+    template< typename T0 >\
+    explicit binary_record_receiver(T0 const& arg0, typename boost::log::aux::enable_if_named_parameters< T0, boost::log::aux::sfinae_dummy >::type = boost::log::aux::sfinae_dummy()) :\
+        m_queue(arg0) {}
+
+#define BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_N(z, n, data)\
+    template< BOOST_PP_ENUM_PARAMS_Z(z, n, typename T) >\
+    explicit binary_record_receiver(BOOST_PP_ENUM_BINARY_PARAMS_Z(z, n, T, const& arg)) :\
+        m_queue(BOOST_PP_ENUM_PARAMS_Z(z, n, arg)) {}
+
+#define BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL(z, n, data)\
+    BOOST_PP_IF(BOOST_PP_EQUAL(n, 1), BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_1, BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_N)(z, n, data)
+
+#endif // BOOST_LOG_DOXYGEN_PASS
+
+/*!
+ * \brief A receiver of log records sent by \c binary_ipc_message_queue_backend
+ *
+ * The receiver takes messages from an interprocess message queue, reconstructs log records from
+ * the attribute values contained in the messages and pushes the records to the logging core of the
+ * current process. The received attribute values take precedence over the thread-specific and global
+ * attributes of the receiving process. The records are filtered and processed by sinks of the current
+ * process as usual. The received attribute values have the same types as the values that were sent,
+ * except that \c string_literal values are received as \c std::string and \c long \c double values
+ * are received with \c double precision.
+ *
+ * The queue type must support receiving messages in batches, like \c reliable_message_queue does.
+ * Methods of this class are not thread-safe, unless otherwise specified.
+ */
+template< typename QueueT >
+class binary_record_receiver
+{
+public:
+    //! Interprocess message queue type
+    typedef QueueT queue_type;
+    //! Message size type
+    typedef typename queue_type::size_type size_type;
+    //! Result codes for various operations
+    typedef typename queue_type::operation_result operation_result;
+
+    //! The default maximum number of records received at once
+    BOOST_STATIC_CONSTANT(uint32_t, default_batch_size = 64u);
+
+private:
+    //! The receive handler that decodes the received messages
+    class batch_decoder
+    {
+    private:
+        std::vector< attribute_value_set >& m_batch;
+        boost::exception_ptr& m_error;
+
+    public:
+        batch_decoder(std::vector< attribute_value_set >& batch, boost::exception_ptr& error) : m_batch(batch), m_error(error)
+        {
+        }
+
+        void operator() (const void* data, size_type size) const
+        {
+            m_batch.push_back(attribute_value_set());
+            try
+            {
+                boost::log::aux::decode_binary_record(data, size, m_batch.back());
+            }
+            catch (...)
+            {
+                // Let the queue release the malformed message, the error is reported after the decoded records are processed
+                m_batch.pop_back();
+                if (!m_error)
+                    m_error = boost::current_exception();
+            }
+        }
+    };
+
+private:
+    //! Interprocess queue
+    queue_type m_queue;
+
+public:
+    /*!
+     * Default constructor. The method constructs the receiver using the default-constructed
+     * interprocess message queue. The queue may need additional setup in order to be able
+     * to receive messages.
+     */
+    binary_record_receiver() BOOST_NOEXCEPT
+    {
+    }
+
+    /*!
+     * Initializing constructor. The method constructs the receiver using the provided
+     * interprocess message queue. The constructor moves from the provided queue.
+     */
+    explicit binary_record_receiver(BOOST_RV_REF(queue_type) queue) BOOST_NOEXCEPT :
+        m_queue(static_cast< BOOST_RV_REF(queue_type) >(queue))
+    {
+    }
+
+    /*!
+     * Constructor that passes arbitrary named parameters to the interprocess queue constructor.
+     * Refer to the queue documentation for the list of supported parameters.
+     */
+#ifndef BOOST_LOG_DOXYGEN_PASS
+    BOOST_LOG_PARAMETRIZED_CONSTRUCTORS_GEN(BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL, ~)
+#else
+    template< typename... Args >
+    explicit binary_record_receiver(Args&&... args);
+#endif
+
+    /*!
+     * The method returns a reference to the managed \c queue_type object.
+     *
+     * \return A reference to the managed \c queue_type object.
+     */
+    queue_type& message_queue() BOOST_NOEXCEPT { return m_queue; }
+
+    /*!
+     * The method returns a constant reference to the managed \c queue_type object.
+     *
+     * \return A constant reference to the managed \c queue_type object.
+     */
+    queue_type const& message_queue() const BOOST_NOEXCEPT { return m_queue; }
+
+    /*!
+     * Tests whether the object is associated with any message queue.
+     *
+     * \return \c true if the object is associated with a message queue, and \c false otherwise.
+     */
+    bool is_open() const BOOST_NOEXCEPT { return m_queue.is_open(); }
+
+    /*!
+     * The method receives up to \a max_records records from the queue and pushes them to the logging core.
+     * If the queue is empty, the method blocks until a record is received or the blocking is interrupted
+     * with <tt>message_queue().stop_local()</tt>.
+     *
+     * \pre <tt>is_open() == true</tt>, <tt>max_records > 0</tt>
+     *
+     * \param max_records The maximum number of records to receive.
+     *
+     * \return The result of the receive operation on the queue.
+     *
+     * <b>Throws:</b> \c parse_error if a malformed message is received. The malformed message is removed
+     *                from the queue and other received records are pushed to the core before the exception
+     *                is thrown.
+     */
+    operation_result receive(uint32_t max_records = default_batch_size)
+    {
+        std::vector< attribute_value_set > batch;
+        boost::exception_ptr error;
+        const operation_result res = m_queue.receive_batch(batch_decoder(batch, error), max_records);
+        push_records(batch, error);
+        return res;
+    }
+
+    /*!
+     * The method performs an attempt to receive up to \a max_records records from the queue and push them to
+     * the logging core. The method is non-blocking, and always returns immediately.
+     *
+     * \pre <tt>is_open() == true</tt>, <tt>max_records > 0</tt>
+     *
+     * \param max_records The maximum number of records to receive.
+     *
+     * \return \c true if at least one message was received, and \c false otherwise.
+     *
+     * <b>Throws:</b> \c parse_error if a malformed message is received. The malformed message is removed
+     *                from the queue and other received records are pushed to the core before the exception
+     *                is thrown.
+     */
+    bool try_receive(uint32_t max_records = default_batch_size)
+    {
+        std::vector< attribute_value_set > batch;
+        boost::exception_ptr error;
+        const bool res = m_queue.try_receive_batch(batch_decoder(batch, error), max_records);
+        push_records(batch, error);
+        return res;
+    }
+
+private:
+    //! Pushes the decoded records to the core. The records are processed after the queue is released so that the senders are not blocked.
+    static void push_records(std::vector< attribute_value_set >& batch, boost::exception_ptr const& error)
+    {
+        if (!batch.empty())
+        {
+            core_ptr core = core::get();
+            for (std::vector< attribute_value_set >::iterator it = batch.begin(), end = batch.end(); it != end; ++it)
+            {
+                record rec = core->open_record(boost::move(*it));
+                if (rec)
+                    core->push_record(boost::move(rec));
+            }
+        }
+
+        if (BOOST_UNLIKELY(!!error))
+            boost::rethrow_exception(error);
+    }
+};
+
+#undef BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_1
+#undef BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL_N
+#undef BOOST_LOG_IPC_RECEIVER_CTOR_FORWARD_INTERNAL
+
+} // namespace ipc
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_UTILITY_IPC_BINARY_RECORD_RECEIVER_HPP_INCLUDED_
@@ -27,6 +27,7 @@
 #include <boost/log/keywords/block_size.hpp>
 #include <boost/log/keywords/overflow_policy.hpp>
 #include <boost/log/keywords/permissions.hpp>
+#include <boost/log/keywords/queue_mode.hpp>
 #include <boost/log/utility/open_mode.hpp>
 #include <boost/log/utility/permissions.hpp>
 #include <boost/log/utility/ipc/object_name.hpp>
@@ -86,6 +87,10 @@ struct enable_if_byte< std::byte, R > { typedef R type; };
  *
  * If the queue is empty and the reader attempts to dequeue a message, it will block until a message is enqueued by a writer.
  *
+ * Besides sending a message from a user-provided buffer, a writer can reserve storage for a message directly in the queue
+ * with \c try_reserve, compose the message in place and then publish it with \c commit. Similarly, the reader can process
+ * multiple messages in place with \c receive_batch and release them all at once.
+ *
  * A blocked reader or writer can be unblocked by calling \c stop_local. After this method is called, all threads blocked on
  * this particular object are released and return \c operation_result::aborted. The other instances of the queue (in the current
  * or other processes) are unaffected. In order to restore the normal functioning of the queue instance after the \c stop_local
@@ -94,6 +99,18 @@ struct enable_if_byte< std::byte, R > { typedef R type; };
  * The queue does not guarantee any particular order of received messages from different writer threads. Messages sent by a
  * particular writer thread will be received in the order of sending.
  *
+ * By default, the queue protects its internal state with an interprocess mutex. Alternatively, the queue can be created in
+ * one of the lock-free modes, where writers and the reader synchronize through atomic operations on the queue positions and
+ * only enter the kernel to block when the queue is full or empty. The single producer mode supports exactly one writer
+ * and one reader, and sending and receiving in this mode are wait-free. The multi-producer mode supports any number
+ * of writers and one reader; concurrent writers reserve space in the queue in the order of arrival and publish their messages
+ * in the same order. The queue mode is specified at the queue creation and cannot be changed afterwards. Lock-free modes
+ * require 64-bit lock-free atomic operations and are only supported on POSIX systems; on other systems the queue
+ * always operates in locking mode. Unlike the locking mode, in the multi-producer mode a writer process that terminates
+ * in the middle of sending a message will block other writers: the messages sent after the terminated writer reserved its
+ * space are never published, and the writers that sent them wait for it until released by \c stop_local, in which case
+ * they return \c operation_result::aborted. The queue cannot be used for writing after that and has to be recreated.
+ *
  * Methods of this class are not thread-safe, unless otherwise specified.
  */
 class reliable_message_queue
@@ -118,9 +135,55 @@ public:
         throw_on_overflow
     };
 
+    //! Interprocess queue synchronization modes
+    enum queue_mode
+    {
+        //! Any number of writers and one reader, synchronized with an interprocess mutex
+        locking_mode,
+        //! One writer and one reader, wait-free
+        single_producer_mode,
+        //! Any number of writers and one reader, lock-free
+        multi_producer_mode
+    };
+
     //! Queue message size type
     typedef uint32_t size_type;
 
+    /*!
+     * \brief Storage for a message that is reserved in the queue but is not yet sent
+     *
+     * The reservation is filled by \c try_reserve and is published by \c commit or abandoned by \c cancel.
+     */
+    class reservation
+    {
+#if !defined(BOOST_LOG_DOXYGEN_PASS)
+        friend class reliable_message_queue;
+
+    private:
+        void* m_data;
+        size_type m_size;
+        uint64_t m_pos;
+        uint32_t m_block_count;
+#endif // !defined(BOOST_LOG_DOXYGEN_PASS)
+
+    public:
+        /*!
+         * Default constructor. Creates an empty reservation.
+         */
+        BOOST_CONSTEXPR reservation() BOOST_NOEXCEPT : m_data(NULL), m_size(0u), m_pos(0u), m_block_count(0u)
+        {
+        }
+
+        /*!
+         * \return Pointer to the reserved message storage in the queue, or \c NULL if the reservation is empty.
+         */
+        void* data() const BOOST_NOEXCEPT { return m_data; }
+        /*!
+         * \return Size of the reserved message storage, in bytes.
+         */
+        size_type size() const BOOST_NOEXCEPT { return m_size; }
+    };
+
 #if !defined(BOOST_LOG_DOXYGEN_PASS)
 
     BOOST_MOVABLE_BUT_NOT_COPYABLE(reliable_message_queue)
@@ -162,6 +225,7 @@ public:
      * \param block_size Size in bytes of allocation block. Must be a power of 2.
      * \param oflow_policy Queue behavior policy in case of overflow.
      * \param perms Access permissions for the associated message queue.
+     * \param mode Queue synchronization mode.
      */
     reliable_message_queue
     (
@@ -170,11 +234,12 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy = block_on_overflow,
-        permissions const& perms = permissions()
+        permissions const& perms = permissions(),
+        queue_mode mode = locking_mode
     ) :
         m_impl(NULL)
     {
-        this->create(name, capacity, block_size, oflow_policy, perms);
+        this->create(name, capacity, block_size, oflow_policy, perms, mode);
     }
 
     /*!
@@ -191,6 +256,7 @@ public:
      * \param block_size Size in bytes of allocation block. Must be a power of 2.
      * \param oflow_policy Queue behavior policy in case of overflow.
      * \param perms Access permissions for the associated message queue.
+     * \param mode Queue synchronization mode.
      */
     reliable_message_queue
     (
@@ -199,11 +265,12 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy = block_on_overflow,
-        permissions const& perms = permissions()
+        permissions const& perms = permissions(),
+        queue_mode mode = locking_mode
     ) :
         m_impl(NULL)
     {
-        this->open_or_create(name, capacity, block_size, oflow_policy, perms);
+        this->open_or_create(name, capacity, block_size, oflow_policy, perms, mode);
     }
 
     /*!
@@ -245,6 +312,7 @@ public:
      * * block_size - Size in bytes of allocation block. Must be a power of 2. Used only if the queue is created.
      * * overflow_policy - Queue behavior policy in case of overflow, see \c overflow_policy.
      * * permissions - Access permissions for the associated message queue.
+     * * queue_mode - Queue synchronization mode, see \c queue_mode. Used only if the queue is created.
      *
      * \post <tt>is_open() == true</tt>
      */
@@ -323,6 +391,7 @@ public:
      * \param block_size Size in bytes of allocation block. Must be a power of 2.
      * \param oflow_policy Queue behavior policy in case of overflow.
      * \param perms Access permissions for the associated message queue.
+     * \param mode Queue synchronization mode.
      */
     BOOST_LOG_API void create
     (
@@ -330,7 +399,8 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy = block_on_overflow,
-        permissions const& perms = permissions()
+        permissions const& perms = permissions(),
+        queue_mode mode = locking_mode
     );
 
     /*!
@@ -348,6 +418,7 @@ public:
      * \param block_size Size in bytes of allocation block. Must be a power of 2.
      * \param oflow_policy Queue behavior policy in case of overflow.
      * \param perms Access permissions for the associated message queue.
+     * \param mode Queue synchronization mode.
      */
     BOOST_LOG_API void open_or_create
     (
@@ -355,7 +426,8 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy = block_on_overflow,
-        permissions const& perms = permissions()
+        permissions const& perms = permissions(),
+        queue_mode mode = locking_mode
     );
 
     /*!
@@ -392,6 +464,7 @@ public:
     /*!
      * This method empties the associated message queue. Concurrent calls to this method, <tt>send()</tt>,
      * <tt>try_send()</tt>, <tt>receive()</tt>, <tt>try_receive()</tt>, and <tt>stop_local()</tt> are allowed.
+     * In lock-free modes, the method is considered a receiving operation and must only be called by the reader.
      *
      * \pre <tt>is_open() == true</tt>
      */
@@ -431,6 +504,17 @@ public:
      */
     BOOST_LOG_API size_type block_size() const;
 
+    /*!
+     * The method returns the synchronization mode of the associated message queue. Note that the returned
+     * value may be different from the corresponding value passed to the constructor or <tt>open_or_create()</tt>,
+     * for the message queue may not have been created by this object.
+     *
+     * \pre <tt>is_open() == true</tt>
+     *
+     * \return Synchronization mode of the associated message queue.
+     */
+    BOOST_LOG_API queue_mode mode() const;
+
     /*!
      * The method wakes up all threads that are blocked in calls to <tt>send()</tt> or
      * <tt>receive()</tt>. Those calls would then return <tt>operation_result::aborted</tt>.
@@ -500,6 +584,10 @@ public:
      * \retval operation_result::no_space if \c overflow_policy::fail_on_overflow is in effect and the queue is full
      * \retval operation_result::aborted if the call was interrupted by <tt>stop_local()</tt>
      *
+     * \note In multi-producer mode, the method also waits for the writers that reserved space in the queue earlier
+     *       to publish their messages. If the call is interrupted by <tt>stop_local()</tt> during this wait, the message
+     *       is not sent, and the space reserved for it is released after the preceding messages are published.
+     *
      * <b>Throws:</b> <tt>std::logic_error</tt> in case if the message size exceeds the queue
      *                capacity, <tt>system_error</tt> in case if a native OS method fails.
      */
@@ -529,6 +617,71 @@ public:
      */
     BOOST_LOG_API bool try_send(void const* message_data, size_type message_size);
 
+    /*!
+     * The method performs an attempt to reserve storage for a message in the associated message queue.
+     * The method is non-blocking, and always returns immediately. If the reservation succeeds, the
+     * caller is expected to write the message contents into the reserved storage and then call
+     * <tt>commit()</tt> to send the message. The reserved storage is contiguous, which may require
+     * the queue to skip the free blocks at the end of the queue storage. Until the reservation is
+     * committed, the message is not visible to the reader. If the message does not fit in the storage
+     * after the skipped blocks, it can only be placed at the beginning of the storage, and the reservation
+     * only succeeds when the reader has released enough space there.
+     *
+     * Every successful call to this method must be followed by a call to <tt>commit()</tt> or <tt>cancel()</tt>
+     * in the same thread. In locking mode, the queue remains locked until then, and in multi-producer mode, messages
+     * sent by other writers after this call will not be received until then. Therefore the message should be
+     * composed as quickly as possible.
+     *
+     * Concurrent calls to <tt>send()</tt>, <tt>try_send()</tt>, <tt>try_reserve()</tt>, <tt>commit()</tt>, <tt>cancel()</tt>,
+     * <tt>receive()</tt>, <tt>try_receive()</tt>, <tt>stop_local()</tt>, and <tt>clear()</tt> are allowed.
+     *
+     * \pre <tt>is_open() == true</tt>
+     *
+     * \param message_size Size of the message data in bytes. If the size is larger than the
+     *                     maximum size allowed by the associated message queue, an
+     *                     <tt>std::logic_error</tt> exception is thrown.
+     * \param res Receives the reserved storage.
+     *
+     * \return \c true if the storage is successfully reserved, and \c false otherwise (e.g.,
+     *         when the queue is full).
+     *
+     * <b>Throws:</b> <tt>std::logic_error</tt> in case if the message size exceeds the queue
+     *                capacity, <tt>system_error</tt> in case if a native OS method fails.
+     */
+    BOOST_LOG_API bool try_reserve(size_type message_size, reservation& res);
+
+    /*!
+     * The method sends the message that was composed in the storage reserved by <tt>try_reserve()</tt>.
+     * After the call the reservation is empty.
+     *
+     * \pre <tt>is_open() == true</tt>, \a res was filled by a successful <tt>try_reserve()</tt> call on this object in the current thread.
+     *
+     * In multi-producer mode, the method waits for the writers that reserved space in the queue earlier
+     * to publish their messages. The wait can be interrupted by calling <tt>stop_local()</tt>, in which case
+     * the message is not sent, and the space reserved for it is released after the preceding messages are published.
+     *
+     * \param res The reservation to send.
+     *
+     * \retval operation_result::succeeded if the operation is successful
+     * \retval operation_result::aborted if the call was interrupted by <tt>stop_local()</tt>
+     */
+    BOOST_LOG_API operation_result commit(reservation& res);
+
+    /*!
+     * The method abandons the storage reserved by <tt>try_reserve()</tt> without sending a message.
+     * After the call the reservation is empty.
+     *
+     * In locking mode, the method unlocks the queue. In the lock-free modes, the reserved storage is
+     * published as a skipped block, which the reader releases without receiving a message. In multi-producer
+     * mode, the method waits for the writers that reserved space in the queue earlier to publish their
+     * messages, like <tt>commit()</tt> does.
+     *
+     * \pre <tt>is_open() == true</tt>, \a res was filled by a successful <tt>try_reserve()</tt> call on this object in the current thread.
+     *
+     * \param res The reservation to abandon.
+     */
+    BOOST_LOG_API void cancel(reservation& res);
+
     /*!
      * The method takes a message from the associated message queue. When the object is in
      * running state and the queue is empty, the method blocks. The blocking is interrupted
@@ -692,6 +845,56 @@ public:
         return do_try_receive(&reliable_message_queue::container_receive_handler< ContainerT >, &container);
     }
 
+    /*!
+     * The method takes up to \a max_messages messages from the associated message queue and passes them to the handler
+     * without copying. The handler is called with two arguments: a pointer to the message data and the message size,
+     * in bytes, for every message in the order of receiving. The message data is only valid until the handler returns.
+     * All the messages are released at once when the method returns, or when the handler throws an exception,
+     * in which case all the messages passed to the handler before are released.
+     * Messages sent with <tt>send()</tt> or <tt>try_send()</tt> that wrap around the end of the queue storage
+     * are copied to a temporary buffer before being passed to the handler.
+     *
+     * When the object is in running state and the queue is empty, the method blocks. The blocking is interrupted
+     * when <tt>stop_local()</tt> is called, in which case the method returns \c operation_result::aborted.
+     * When the object is already in the stopped state and the queue is empty, the method
+     * does not block but returns immediately with return value \c operation_result::aborted.
+     *
+     * In locking mode, the queue remains locked while the handler is being called. Concurrent calls to <tt>send()</tt>,
+     * <tt>try_send()</tt>, <tt>receive()</tt>, <tt>try_receive()</tt>, <tt>stop_local()</tt>, and <tt>clear()</tt> are allowed.
+     *
+     * \pre <tt>is_open() == true</tt>, <tt>max_messages > 0</tt>
+     *
+     * \param handler The function object that will be called for every received message.
+     * \param max_messages The maximum number of messages to receive.
+     *
+     * \retval operation_result::succeeded if the operation is successful
+     * \retval operation_result::aborted if the call was interrupted by <tt>stop_local()</tt>
+     */
+    template< typename HandlerT >
+    operation_result receive_batch(HandlerT handler, uint32_t max_messages)
+    {
+        return do_receive_batch(&reliable_message_queue::batch_receive_handler< HandlerT >, &handler, max_messages);
+    }
+
+    /*!
+     * The method performs an attempt to take up to \a max_messages messages from the associated message queue and pass
+     * them to the handler without copying. The method is non-blocking, and always returns immediately. Otherwise
+     * the method behaves the same way as <tt>receive_batch()</tt>.
+     *
+     * \pre <tt>is_open() == true</tt>, <tt>max_messages > 0</tt>
+     *
+     * \param handler The function object that will be called for every received message.
+     * \param max_messages The maximum number of messages to receive.
+     *
+     * \return \c true if at least one message is successfully received, and \c false otherwise (e.g.,
+     *         when the queue is empty).
+     */
+    template< typename HandlerT >
+    bool try_receive_batch(HandlerT handler, uint32_t max_messages)
+    {
+        return do_try_receive_batch(&reliable_message_queue::batch_receive_handler< HandlerT >, &handler, max_messages);
+    }
+
     /*!
      * The method frees system-wide resources, associated with the interprocess queue with the supplied name.
      * The queue referred to by the specified name must not be opened in any process at the point of this call.
@@ -727,14 +930,14 @@ private:
     template< typename ArgsT >
     void construct_dispatch(open_mode::create_only_tag, ArgsT const& args)
     {
-        this->create(args[keywords::name], args[keywords::capacity], args[keywords::block_size], args[keywords::overflow_policy | block_on_overflow], args[keywords::permissions | permissions()]);
+        this->create(args[keywords::name], args[keywords::capacity], args[keywords::block_size], args[keywords::overflow_policy | block_on_overflow], args[keywords::permissions | permissions()], args[keywords::queue_mode | locking_mode]);
     }
 
     //! Implementation of the constructor with named arguments
     template< typename ArgsT >
     void construct_dispatch(open_mode::open_or_create_tag, ArgsT const& args)
     {
-        this->open_or_create(args[keywords::name], args[keywords::capacity], args[keywords::block_size], args[keywords::overflow_policy | block_on_overflow], args[keywords::permissions | permissions()]);
+        this->open_or_create(args[keywords::name], args[keywords::capacity], args[keywords::block_size], args[keywords::overflow_policy | block_on_overflow], args[keywords::permissions | permissions()], args[keywords::queue_mode | locking_mode]);
     }
 
     //! Implementation of the constructor with named arguments
@@ -751,9 +954,19 @@ private:
     BOOST_LOG_API operation_result do_receive(receive_handler handler, void* state);
     //! Attempts to receives the message from the queue and calls the handler to place the data in the user's storage
     BOOST_LOG_API bool do_try_receive(receive_handler handler, void* state);
+    //! Receives multiple messages from the queue and calls the handler for each of them
+    BOOST_LOG_API operation_result do_receive_batch(receive_handler handler, void* state, uint32_t max_messages);
+    //! Attempts to receive multiple messages from the queue and calls the handler for each of them
+    BOOST_LOG_API bool do_try_receive_batch(receive_handler handler, void* state, uint32_t max_messages);
 
     //! Fixed buffer receive handler
     static BOOST_LOG_API void fixed_buffer_receive_handler(void* state, const void* data, size_type size);
+    //! Receive handler for batched receiving
+    template< typename HandlerT >
+    static void batch_receive_handler(void* state, const void* data, size_type size)
+    {
+        (*static_cast< HandlerT* >(state))(data, size);
+    }
     //! Receive handler for a container
     template< typename ContainerT >
     static void container_receive_handler(void* state, const void* data, size_type size)
@@ -0,0 +1,516 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_file_backend.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <ios>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/sinks/binary_file_backend.hpp>
+#include <boost/log/detail/process_id.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/thread_id.hpp>
+#endif
+#include <boost/log/exceptions.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include "binary_log_file_format.hpp"
+#include "binary_value_encoder.hpp"
+#include "crc32c.hpp"
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace sinks {
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+namespace file_format = boost::log::aux::binary_log_file;
+
+} // namespace
+
+//! Sink implementation data
+struct binary_file_backend::implementation
+{
+    //! Attribute value writer for binary_value_encoder
+    class value_writer
+    {
+    private:
+        implementation& m_impl;
+        std::string& m_buffer;
+        uint32_t m_name_id;
+
+    public:
+        explicit value_writer(implementation& impl) : m_impl(impl), m_buffer(impl.m_record), m_name_id(0u)
+        {
+        }
+
+        void set_name_id(uint32_t id) BOOST_NOEXCEPT
+        {
+            m_name_id = id;
+        }
+
+        void operator() (bool value) const { write_header(file_format::bool_tag); m_buffer.push_back(static_cast< char >(value)); }
+        void operator() (char value) const { write_header(file_format::char_tag); m_buffer.push_back(value); }
+        void operator() (signed char value) const { write_header(file_format::signed_char_tag); m_buffer.push_back(static_cast< char >(value)); }
+        void operator() (unsigned char value) const { write_header(file_format::unsigned_char_tag); m_buffer.push_back(static_cast< char >(value)); }
+        void operator() (short value) const { write_signed(file_format::short_tag, value); }
+        void operator() (unsigned short value) const { write_unsigned(file_format::unsigned_short_tag, value); }
+        void operator() (int value) const { write_signed(file_format::int_tag, value); }
+        void operator() (unsigned int value) const { write_unsigned(file_format::unsigned_int_tag, value); }
+        void operator() (long value) const { write_signed(file_format::long_tag, value); }
+        void operator() (unsigned long value) const { write_unsigned(file_format::unsigned_long_tag, value); }
+        void operator() (long long value) const { write_signed(file_format::long_long_tag, value); }
+        void operator() (unsigned long long value) const { write_unsigned(file_format::unsigned_long_long_tag, value); }
+        void operator() (float value) const { write_header(file_format::float_tag); file_format::write_float(m_buffer, value); }
+        void operator() (double value) const { write_header(file_format::double_tag); file_format::write_double(m_buffer, value); }
+        void operator() (long double value) const { write_header(file_format::long_double_tag); file_format::write_double(m_buffer, static_cast< double >(value)); }
+        void operator() (std::string const& value) const { write_header(file_format::string_tag); file_format::write_string(m_buffer, value.data(), value.size()); }
+        void operator() (basic_string_literal< char > const& value) const { write_header(file_format::string_tag); file_format::write_string(m_buffer, value.c_str(), value.size()); }
+        void operator() (trivial::severity_level value) const { write_header(file_format::severity_level_tag); m_buffer.push_back(static_cast< char >(value)); }
+
+        void operator() (posix_time::ptime const& value) const
+        {
+            if (BOOST_LIKELY(!value.is_special()))
+            {
+                write_header(file_format::ptime_tag);
+                const posix_time::time_duration since_epoch = value - posix_time::ptime(gregorian::date(1970, 1, 1));
+                file_format::write_fixed< uint64_t >(m_buffer, static_cast< uint64_t >(since_epoch.total_microseconds()));
+            }
+            else
+            {
+                write_header(file_format::special_ptime_tag);
+                m_buffer.push_back(static_cast< char >(value.is_not_a_date_time() ? 0 : (value.is_pos_infinity() ? 1 : 2)));
+            }
+        }
+
+        void operator() (boost::log::aux::process::id const& value) const { write_unsigned(file_format::process_id_tag, value.native_id()); }
+#if !defined(BOOST_LOG_NO_THREADS)
+        void operator() (boost::log::aux::thread::id const& value) const { write_unsigned(file_format::thread_id_tag, value.native_id()); }
+#endif
+
+        void operator() (deferred_message const& value) const
+        {
+            const uint32_t site_id = m_impl.get_site_id(value.site());
+            write_header(file_format::deferred_message_tag);
+            file_format::write_varint(m_buffer, site_id);
+
+            // Reserve space for the encoded arguments size, assuming it fits in one byte, which is the typical case
+            const std::string::size_type size_pos = m_buffer.size();
+            m_buffer.push_back('\0');
+            encode_arguments(value);
+            const std::size_t args_size = m_buffer.size() - size_pos - 1u;
+            if (BOOST_LIKELY(args_size < 0x80u))
+            {
+                m_buffer[size_pos] = static_cast< char >(args_size);
+            }
+            else
+            {
+                std::string size;
+                file_format::write_varint(size, args_size);
+                m_buffer.replace(size_pos, 1u, size);
+            }
+        }
+
+    private:
+        void write_header(file_format::value_tag tag) const
+        {
+            file_format::write_varint(m_buffer, m_name_id);
+            m_buffer.push_back(static_cast< char >(tag));
+        }
+
+        template< typename T >
+        void write_signed(file_format::value_tag tag, T value) const
+        {
+            write_header(tag);
+            file_format::write_varint(m_buffer, file_format::zigzag_encode(static_cast< int64_t >(value)));
+        }
+
+        template< typename T >
+        void write_unsigned(file_format::value_tag tag, T value) const
+        {
+            write_header(tag);
+            file_format::write_varint(m_buffer, static_cast< uint64_t >(value));
+        }
+
+        //! Converts the deferred message arguments from the in-memory representation to the file format
+        void encode_arguments(deferred_message const& msg) const
+        {
+            deferred_message_site const& site = msg.site();
+            const unsigned char* p = msg.arguments();
+            for (unsigned int i = 0u; i < site.argument_count; ++i)
+            {
+                switch (site.argument_types[i])
+                {
+                case deferred_argument::boolean:
+                case deferred_argument::character:
+                    m_buffer.push_back(static_cast< char >(*p));
+                    ++p;
+                    break;
+
+                case deferred_argument::signed_integer:
+                    {
+                        int64_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        file_format::write_varint(m_buffer, file_format::zigzag_encode(value));
+                        p += sizeof(value);
+                    }
+                    break;
+
+                case deferred_argument::unsigned_integer:
+                case deferred_argument::pointer:
+                    {
+                        uint64_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        file_format::write_varint(m_buffer, value);
+                        p += sizeof(value);
+                    }
+                    break;
+
+                case deferred_argument::floating_point:
+                    {
+                        double value;
+                        std::memcpy(&value, p, sizeof(value));
+                        file_format::write_double(m_buffer, value);
+                        p += sizeof(value);
+                    }
+                    break;
+
+                case deferred_argument::string:
+                    {
+                        uint32_t size;
+                        std::memcpy(&size, p, sizeof(size));
+                        p += sizeof(size);
+                        file_format::write_string(m_buffer, reinterpret_cast< const char* >(p), size);
+                        p += size;
+                    }
+                    break;
+
+                case deferred_argument::string_literal:
+                    {
+                        const char* str;
+                        std::memcpy(&str, p, sizeof(str));
+                        p += sizeof(str);
+                        uint32_t size;
+                        std::memcpy(&size, p, sizeof(size));
+                        p += sizeof(size);
+                        file_format::write_string(m_buffer, str, size);
+                    }
+                    break;
+
+                default:
+                    BOOST_LOG_THROW_DESCR(invalid_type, "Deferred message contains an argument of unknown type");
+                }
+            }
+        }
+    };
+
+    //! File name
+    filesystem::path m_file_name;
+    //! File open mode
+    std::ios_base::openmode m_open_mode;
+    //! The file
+    filesystem::ofstream m_file;
+    //! Block size
+    std::size_t m_block_size;
+    //! Auto-flush flag
+    bool m_auto_flush;
+    //! Names of the attribute values to write
+    std::vector< attribute_name > m_attribute_names;
+
+    //! The block being composed, including the block header
+    std::string m_block;
+    //! The record being encoded
+    std::string m_record;
+
+    //! Attribute name identifiers in the current block, indexed by attribute name identifiers. Zero means the name is not defined yet.
+    std::vector< uint32_t > m_name_ids;
+    //! Number of defined attribute names in the current block
+    uint32_t m_name_count;
+    //! Deferred message site identifiers in the current block
+    std::unordered_map< deferred_message_site const*, uint32_t > m_site_ids;
+
+    implementation(filesystem::path const& file_name, std::ios_base::openmode mode, std::size_t block_size, bool auto_flush) :
+        m_file_name(file_name),
+        m_open_mode(mode),
+        m_block_size(block_size),
+        m_auto_flush(auto_flush),
+        m_name_count(0u)
+    {
+        m_block.resize(file_format::block_header_size);
+    }
+
+    //! Returns the identifier of the attribute name, writes the name definition to the block if needed
+    uint32_t get_name_id(attribute_name const& name)
+    {
+        const attribute_name::id_type id = name.id();
+        if (BOOST_UNLIKELY(id >= m_name_ids.size()))
+            m_name_ids.resize(id + 1u, 0u);
+
+        uint32_t& name_id = m_name_ids[id];
+        if (BOOST_UNLIKELY(name_id == 0u))
+        {
+            name_id = ++m_name_count;
+            std::string const& str = name.string();
+            m_block.push_back(static_cast< char >(file_format::name_entry_tag));
+            file_format::write_varint(m_block, name_id);
+            file_format::write_string(m_block, str.data(), str.size());
+        }
+
+        return name_id;
+    }
+
+    //! Returns the identifier of the deferred message site, writes the site definition to the block if needed
+    uint32_t get_site_id(deferred_message_site const& site)
+    {
+        std::pair< std::unordered_map< deferred_message_site const*, uint32_t >::iterator, bool > res =
+            m_site_ids.insert(std::make_pair(&site, static_cast< uint32_t >(m_site_ids.size() + 1u)));
+        if (res.second)
+        {
+            m_block.push_back(static_cast< char >(file_format::site_entry_tag));
+            file_format::write_varint(m_block, res.first->second);
+            file_format::write_string(m_block, site.format, site.format_size);
+            file_format::write_string(m_block, site.file, std::strlen(site.file));
+            file_format::write_varint(m_block, site.line);
+            file_format::write_varint(m_block, site.argument_count);
+            for (unsigned int i = 0u; i < site.argument_count; ++i)
+            {
+                // String literals are only valid in the writing process, they are stored as strings
+                unsigned char type = site.argument_types[i];
+                if (type == deferred_argument::string_literal)
+                    type = deferred_argument::string;
+                m_block.push_back(static_cast< char >(type));
+            }
+        }
+
+        return res.first->second;
+    }
+
+    //! Encodes the record and appends it to the block, along with the definitions it refers to
+    void append_record(attribute_value_set const& values)
+    {
+        // Definitions are written directly to the block, the record is composed separately and appended after them.
+        // If encoding fails, the definitions are left in the block, which is harmless.
+        m_record.clear();
+
+        value_writer writer(*this);
+        boost::log::aux::binary_value_encoder< value_writer > encoder(writer);
+        uint32_t count = 0u;
+
+        if (m_attribute_names.empty())
+        {
+            for (attribute_value_set::const_iterator it = values.begin(), end = values.end(); it != end; ++it)
+            {
+                writer.set_name_id(get_name_id(it->first));
+                if (encoder.encode(it->second))
+                    ++count;
+            }
+        }
+        else
+        {
+            for (std::vector< attribute_name >::const_iterator it = m_attribute_names.begin(), end = m_attribute_names.end(); it != end; ++it)
+            {
+                attribute_value_set::const_iterator value = values.find(*it);
+                if (value != values.end())
+                {
+                    writer.set_name_id(get_name_id(*it));
+                    if (encoder.encode(value->second))
+                        ++count;
+                }
+            }
+        }
+
+        m_block.push_back(static_cast< char >(file_format::record_entry_tag));
+        file_format::write_varint(m_block, count);
+        m_block.append(m_record);
+    }
+
+    //! Writes the composed block to the file
+    void write_block()
+    {
+        const std::size_t payload_size = m_block.size() - file_format::block_header_size;
+        if (payload_size == 0u)
+            return;
+
+        BOOST_ASSERT(payload_size <= file_format::max_block_size);
+
+        if (!m_file.is_open())
+            open_file();
+
+        std::string header;
+        file_format::write_fixed< uint32_t >(header, static_cast< uint32_t >(payload_size));
+        file_format::write_fixed< uint32_t >(header, boost::log::aux::crc32c(m_block.data() + file_format::block_header_size, payload_size));
+        m_block.replace(0u, file_format::block_header_size, header);
+
+        m_file.write(m_block.data(), static_cast< std::streamsize >(m_block.size()));
+        discard_block();
+
+        if (BOOST_UNLIKELY(!m_file.good()))
+        {
+            // Start a new segment on the next write, since the file may contain an incomplete block now
+            m_file.close();
+            m_file.clear();
+            BOOST_THROW_EXCEPTION(filesystem::filesystem_error(
+                "Failed to write to the binary log file",
+                m_file_name,
+                system::error_code(system::errc::io_error, system::generic_category())));
+        }
+    }
+
+    //! Discards the composed block and the definitions it contains
+    void discard_block()
+    {
+        m_block.resize(file_format::block_header_size);
+        std::fill(m_name_ids.begin(), m_name_ids.end(), 0u);
+        m_name_count = 0u;
+        m_site_ids.clear();
+    }
+
+    //! Opens the file and writes the segment header
+    void open_file()
+    {
+        filesystem::path parent = m_file_name.parent_path();
+        if (!parent.empty())
+            filesystem::create_directories(parent);
+
+        m_file.open(m_file_name, m_open_mode | std::ios_base::out | std::ios_base::binary);
+        if (BOOST_UNLIKELY(!m_file.is_open()))
+        {
+            BOOST_THROW_EXCEPTION(filesystem::filesystem_error(
+                "Failed to open file for writing",
+                m_file_name,
+                system::error_code(system::errc::io_error, system::generic_category())));
+        }
+
+        // Don't truncate the file if it is reopened after an error
+        m_open_mode = (m_open_mode & ~std::ios_base::trunc) | std::ios_base::app;
+
+        char header[file_format::segment_header_size] = {};
+        std::memcpy(header, file_format::signature, sizeof(file_format::signature));
+        header[sizeof(file_format::signature)] = static_cast< char >(file_format::version);
+        m_file.write(header, sizeof(header));
+    }
+};
+
+BOOST_LOG_API void binary_file_backend::construct(filesystem::path const& file_name, std::ios_base::openmode mode, std::size_t block_size, bool auto_flush)
+{
+    if (BOOST_UNLIKELY(file_name.empty()))
+        BOOST_LOG_THROW_DESCR(invalid_value, "Binary log file name is not specified");
+
+    m_pImpl = new implementation(filesystem::absolute(file_name), mode, block_size, auto_flush);
+}
+
+BOOST_LOG_API binary_file_backend::~binary_file_backend()
+{
+    try
+    {
+        m_pImpl->write_block();
+    }
+    catch (...)
+    {
+    }
+
+    delete m_pImpl;
+}
+
+BOOST_LOG_API void binary_file_backend::add_attribute(attribute_name const& name)
+{
+    m_pImpl->m_attribute_names.push_back(name);
+}
+
+BOOST_LOG_API void binary_file_backend::clear_attributes()
+{
+    m_pImpl->m_attribute_names.clear();
+}
+
+BOOST_LOG_API void binary_file_backend::set_block_size(std::size_t size)
+{
+    m_pImpl->m_block_size = size;
+}
+
+BOOST_LOG_API void binary_file_backend::auto_flush(bool enable)
+{
+    m_pImpl->m_auto_flush = enable;
+}
+
+BOOST_LOG_API filesystem::path binary_file_backend::get_file_name() const
+{
+    return m_pImpl->m_file_name;
+}
+
+BOOST_LOG_API void binary_file_backend::consume(record_view const& rec)
+{
+    implementation* const impl = m_pImpl;
+    attribute_value_set const& values = rec.attribute_values();
+
+    const std::size_t pending_size = impl->m_block.size();
+    impl->append_record(values);
+    if (BOOST_UNLIKELY(impl->m_block.size() - file_format::block_header_size > file_format::max_block_size))
+    {
+        if (pending_size > file_format::block_header_size)
+        {
+            // Write the pending records in a separate block and start a new block with the record. The record has to be encoded again,
+            // since it may refer to the definitions in the pending block.
+            impl->m_block.resize(pending_size);
+            impl->write_block();
+            impl->append_record(values);
+        }
+
+        if (BOOST_UNLIKELY(impl->m_block.size() - file_format::block_header_size > file_format::max_block_size))
+        {
+            impl->discard_block();
+            BOOST_LOG_THROW_DESCR(limitation_error, "Log record is too large to be written to a binary log file");
+        }
+    }
+
+    if (impl->m_auto_flush)
+    {
+        impl->write_block();
+        impl->m_file.flush();
+    }
+    else if (impl->m_block.size() >= impl->m_block_size)
+    {
+        impl->write_block();
+    }
+}
+
+BOOST_LOG_API void binary_file_backend::flush()
+{
+    m_pImpl->write_block();
+    if (m_pImpl->m_file.is_open())
+        m_pImpl->m_file.flush();
+}
+
+} // namespace sinks
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
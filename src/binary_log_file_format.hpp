@@ -0,0 +1,193 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_log_file_format.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_BINARY_LOG_FILE_FORMAT_HPP_INCLUDED_
+#define BOOST_LOG_BINARY_LOG_FILE_FORMAT_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <boost/cstdint.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+namespace binary_log_file {
+
+/*
+ * The binary log file format. All fixed size integers and floating point numbers are stored in little endian byte order,
+ * varints are unsigned LEB128 numbers, signed integers are zigzag-encoded before being stored as varints.
+ *
+ * file := segment+
+ * segment := segment_header block*
+ * segment_header := signature version reserved
+ * signature := 'B' 'L' 'O' 'G' 'F' 'I' 'L' 'E'
+ * version := uint8, currently 1
+ * reserved := uint8[3], zeros
+ * block := payload_size checksum payload
+ * payload_size := uint32
+ * checksum := uint32, CRC-32C of the payload
+ * payload := entry*
+ *
+ * entry := name_definition | site_definition | record
+ * name_definition := name_entry_tag name_id string
+ * site_definition := site_entry_tag site_id format file line argument_count argument_type*
+ * record := record_entry_tag value_count value*
+ * value := name_id value_tag value_data
+ * string := varint size, followed by size chars
+ *
+ * Attribute names and deferred message sites are defined once per block, before the first record that references them.
+ * Identifiers are assigned sequentially, starting from 1, and are only valid within the block. This makes every block
+ * self-contained, so that a damaged block can be skipped without affecting the subsequent blocks. A new segment is started
+ * every time the file is opened for writing. Since the payload size is limited by max_block_size, a segment signature
+ * can never be mistaken for a block header.
+ *
+ * The value data encoding is defined by the value tag. Deferred message arguments are stored in the order of the
+ * argument types in the site definition. The argument encoding is the same as for values, with the following exceptions:
+ * booleans and characters are stored as a single byte, signed and unsigned integers are stored as varints, floating
+ * point numbers are stored as doubles, string literals are stored as strings and pointers are stored as varints.
+ */
+
+//! Segment signature
+BOOST_CONSTEXPR_OR_CONST char signature[8u] = { 'B', 'L', 'O', 'G', 'F', 'I', 'L', 'E' };
+//! Segment header size
+BOOST_CONSTEXPR_OR_CONST std::size_t segment_header_size = 12u;
+//! Block header size
+BOOST_CONSTEXPR_OR_CONST std::size_t block_header_size = 8u;
+//! File format version
+BOOST_CONSTEXPR_OR_CONST uint8_t version = 1u;
+//! Maximum block payload size
+BOOST_CONSTEXPR_OR_CONST uint32_t max_block_size = 0x10000000u;
+
+//! Entry tags
+enum entry_tag
+{
+    name_entry_tag = 1,
+    site_entry_tag = 2,
+    record_entry_tag = 3
+};
+
+//! Value type tags
+enum value_tag
+{
+    bool_tag = 1,
+    char_tag,
+    signed_char_tag,
+    unsigned_char_tag,
+    short_tag,
+    unsigned_short_tag,
+    int_tag,
+    unsigned_int_tag,
+    long_tag,
+    unsigned_long_tag,
+    long_long_tag,
+    unsigned_long_long_tag,
+    float_tag,
+    double_tag,
+    long_double_tag,
+    string_tag,
+    severity_level_tag,     //!< trivial::severity_level, uint8
+    ptime_tag,              //!< posix_time::ptime, int64 microseconds since 1970-01-01 00:00:00
+    special_ptime_tag,      //!< posix_time::ptime special value, uint8: 0 - not_a_date_time, 1 - pos_infin, 2 - neg_infin
+    process_id_tag,
+    thread_id_tag,
+    deferred_message_tag    //!< deferred_message: site_id, varint size of the encoded arguments, encoded arguments
+};
+
+//! Appends a varint to the buffer
+inline void write_varint(std::string& buffer, uint64_t value)
+{
+    char buf[10u];
+    std::size_t size = 0u;
+    while (value >= 0x80u)
+    {
+        buf[size++] = static_cast< char >(static_cast< unsigned char >(value) | 0x80u);
+        value >>= 7u;
+    }
+    buf[size++] = static_cast< char >(value);
+    buffer.append(buf, size);
+}
+
+//! Zigzag-encodes a signed integer
+inline uint64_t zigzag_encode(int64_t value) BOOST_NOEXCEPT
+{
+    return (static_cast< uint64_t >(value) << 1u) ^ static_cast< uint64_t >(value >> 63);
+}
+
+//! Decodes a zigzag-encoded signed integer
+inline int64_t zigzag_decode(uint64_t value) BOOST_NOEXCEPT
+{
+    return static_cast< int64_t >((value >> 1u) ^ (0u - (value & 1u)));
+}
+
+//! Appends a fixed size little endian integer to the buffer
+template< typename T >
+inline void write_fixed(std::string& buffer, T value)
+{
+    char buf[sizeof(T)];
+    for (std::size_t i = 0u; i < sizeof(T); ++i)
+        buf[i] = static_cast< char >(static_cast< unsigned char >(value >> (i * 8u)));
+    buffer.append(buf, sizeof(T));
+}
+
+//! Reads a fixed size little endian integer
+template< typename T >
+inline T read_fixed(const unsigned char* p) BOOST_NOEXCEPT
+{
+    T value = 0;
+    for (std::size_t i = 0u; i < sizeof(T); ++i)
+        value |= static_cast< T >(static_cast< T >(p[i]) << (i * 8u));
+    return value;
+}
+
+//! Appends a double to the buffer
+inline void write_double(std::string& buffer, double value)
+{
+    uint64_t n;
+    std::memcpy(&n, &value, sizeof(n));
+    write_fixed< uint64_t >(buffer, n);
+}
+
+//! Appends a float to the buffer
+inline void write_float(std::string& buffer, float value)
+{
+    uint32_t n;
+    std::memcpy(&n, &value, sizeof(n));
+    write_fixed< uint32_t >(buffer, n);
+}
+
+//! Appends a string to the buffer
+inline void write_string(std::string& buffer, const char* str, std::size_t size)
+{
+    write_varint(buffer, size);
+    buffer.append(str, size);
+}
+
+} // namespace binary_log_file
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_BINARY_LOG_FILE_FORMAT_HPP_INCLUDED_
@@ -0,0 +1,590 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_log_reader.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <ios>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/utility/binary_log_reader.hpp>
+#include <boost/log/detail/process_id.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/thread_id.hpp>
+#endif
+#include <boost/log/exceptions.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/attribute_value_impl.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include "binary_log_file_format.hpp"
+#include "crc32c.hpp"
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+namespace file_format = boost::log::aux::binary_log_file;
+
+//! Description of a deferred logging statement read from the file
+struct decoded_message_site
+{
+    std::string format;
+    std::string file;
+    std::vector< unsigned char > argument_types;
+    deferred_message_site site;
+};
+
+//! Deferred message attribute value read from the file
+class decoded_message_value :
+    public attribute_value::impl
+{
+private:
+    //! The statement description
+    const shared_ptr< const decoded_message_site > m_site;
+    //! Encoded arguments
+    const std::vector< unsigned char > m_arguments;
+    //! The message
+    const deferred_message m_message;
+
+public:
+    decoded_message_value(shared_ptr< const decoded_message_site > const& site, std::vector< unsigned char >& args) :
+        m_site(site),
+        m_arguments(boost::move(args)),
+        m_message(site->site, m_arguments.empty() ? static_cast< const unsigned char* >(NULL) : &m_arguments[0], m_arguments.size())
+    {
+    }
+
+    bool dispatch(type_dispatcher& dispatcher) BOOST_OVERRIDE
+    {
+        type_dispatcher::callback< deferred_message > callback = dispatcher.get_callback< deferred_message >();
+        if (callback)
+        {
+            callback(m_message);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    typeindex::type_index get_type() const BOOST_OVERRIDE { return typeindex::type_id< deferred_message >(); }
+};
+
+//! Bounds-checked reader of the block payload
+class payload_reader
+{
+private:
+    const unsigned char* m_p;
+    const unsigned char* const m_end;
+
+public:
+    payload_reader(const unsigned char* p, const unsigned char* end) BOOST_NOEXCEPT : m_p(p), m_end(end)
+    {
+    }
+
+    bool empty() const BOOST_NOEXCEPT { return m_p == m_end; }
+    const unsigned char* position() const BOOST_NOEXCEPT { return m_p; }
+
+    unsigned char read_byte()
+    {
+        check_size(1u);
+        return *m_p++;
+    }
+
+    uint64_t read_varint()
+    {
+        uint64_t value = 0u;
+        for (unsigned int shift = 0u; shift < 64u; shift += 7u)
+        {
+            const unsigned char byte = read_byte();
+            value |= static_cast< uint64_t >(byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0u)
+                return value;
+        }
+
+        BOOST_LOG_THROW_DESCR(parse_error, "Invalid variable length integer in the binary log file");
+    }
+
+    uint32_t read_varint32()
+    {
+        const uint64_t value = read_varint();
+        if (BOOST_UNLIKELY(value > 0xFFFFFFFFu))
+            BOOST_LOG_THROW_DESCR(parse_error, "Integer value is out of range in the binary log file");
+        return static_cast< uint32_t >(value);
+    }
+
+    template< typename T >
+    T read_fixed()
+    {
+        check_size(sizeof(T));
+        const T value = file_format::read_fixed< T >(m_p);
+        m_p += sizeof(T);
+        return value;
+    }
+
+    double read_double()
+    {
+        const uint64_t n = read_fixed< uint64_t >();
+        double value;
+        std::memcpy(&value, &n, sizeof(value));
+        return value;
+    }
+
+    float read_float()
+    {
+        const uint32_t n = read_fixed< uint32_t >();
+        float value;
+        std::memcpy(&value, &n, sizeof(value));
+        return value;
+    }
+
+    std::pair< const char*, std::size_t > read_string()
+    {
+        const uint64_t size = read_varint();
+        check_size(size);
+        const char* const str = reinterpret_cast< const char* >(m_p);
+        m_p += static_cast< std::size_t >(size);
+        return std::pair< const char*, std::size_t >(str, static_cast< std::size_t >(size));
+    }
+
+private:
+    void check_size(uint64_t size) const
+    {
+        if (BOOST_UNLIKELY(size > static_cast< std::size_t >(m_end - m_p)))
+            BOOST_LOG_THROW_DESCR(parse_error, "Unexpected end of block in the binary log file");
+    }
+};
+
+//! Appends a value to the encoded deferred message arguments
+template< typename T >
+inline void append_argument(std::vector< unsigned char >& args, T value)
+{
+    const std::size_t pos = args.size();
+    args.resize(pos + sizeof(T));
+    std::memcpy(&args[pos], &value, sizeof(T));
+}
+
+} // namespace
+
+//! Reader implementation data
+struct binary_log_reader::implementation
+{
+    //! The file
+    filesystem::ifstream m_file;
+    //! Indicates that the segment header has been read
+    bool m_in_segment;
+    //! The current block payload
+    std::vector< unsigned char > m_payload;
+    //! The current position in the payload
+    std::size_t m_position;
+    //! Attribute names defined in the current block
+    std::vector< attribute_name > m_names;
+    //! Deferred message sites defined in the current block
+    std::vector< shared_ptr< const decoded_message_site > > m_sites;
+
+    implementation() : m_in_segment(false), m_position(0u)
+    {
+    }
+
+    //! Reads the next block from the file. Returns \c false if the end of file is reached.
+    bool read_block()
+    {
+        m_payload.clear();
+        m_position = 0u;
+        m_names.clear();
+        m_sites.clear();
+
+        unsigned char header[file_format::segment_header_size];
+        while (true)
+        {
+            if (!m_in_segment)
+            {
+                if (!read_bytes(header, file_format::segment_header_size))
+                    return false;
+                if (BOOST_UNLIKELY(std::memcmp(header, file_format::signature, sizeof(file_format::signature)) != 0))
+                {
+                    resync();
+                    BOOST_LOG_THROW_DESCR(parse_error, "Invalid segment header in the binary log file");
+                }
+                check_version(header[sizeof(file_format::signature)]);
+                m_in_segment = true;
+            }
+
+            if (!read_bytes(header, file_format::block_header_size))
+                return false;
+
+            // A new segment may start at the block boundary if the file was appended to
+            if (std::memcmp(header, file_format::signature, sizeof(file_format::signature)) == 0)
+            {
+                if (!read_bytes(header + sizeof(file_format::signature), file_format::segment_header_size - sizeof(file_format::signature)))
+                    return false;
+                check_version(header[sizeof(file_format::signature)]);
+                continue;
+            }
+
+            break;
+        }
+
+        const uint32_t payload_size = file_format::read_fixed< uint32_t >(header);
+        if (BOOST_UNLIKELY(payload_size > file_format::max_block_size))
+        {
+            resync();
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid block size in the binary log file");
+        }
+
+        m_payload.resize(payload_size);
+        if (payload_size > 0u && !read_bytes(&m_payload[0], payload_size))
+            return false;
+
+        const uint32_t checksum = file_format::read_fixed< uint32_t >(header + 4u);
+        if (BOOST_UNLIKELY(boost::log::aux::crc32c(m_payload.empty() ? NULL : &m_payload[0], m_payload.size()) != checksum))
+        {
+            // The block is skipped, the next one is self-contained
+            m_payload.clear();
+            BOOST_LOG_THROW_DESCR(parse_error, "Checksum mismatch in the binary log file");
+        }
+
+        return true;
+    }
+
+    //! Reads data from the file. Returns \c false if no data is available, throws if the data is truncated.
+    bool read_bytes(unsigned char* p, std::size_t size)
+    {
+        m_file.read(reinterpret_cast< char* >(p), static_cast< std::streamsize >(size));
+        const std::size_t read_size = static_cast< std::size_t >(m_file.gcount());
+        if (BOOST_LIKELY(read_size == size))
+            return true;
+        if (read_size == 0u)
+            return false;
+
+        BOOST_LOG_THROW_DESCR(parse_error, "The binary log file is truncated");
+    }
+
+    //! Checks the file format version
+    void check_version(unsigned char version)
+    {
+        if (BOOST_UNLIKELY(version != file_format::version))
+        {
+            m_in_segment = false;
+            resync();
+            BOOST_LOG_THROW_DESCR(parse_error, "Unsupported binary log file format version");
+        }
+    }
+
+    //! Positions the file at the beginning of the next segment, if there is one
+    void resync()
+    {
+        m_in_segment = false;
+
+        std::streambuf* const buf = m_file.rdbuf();
+        std::size_t matched = 0u;
+        while (true)
+        {
+            const std::char_traits< char >::int_type c = buf->sbumpc();
+            if (std::char_traits< char >::eq_int_type(c, std::char_traits< char >::eof()))
+            {
+                m_file.setstate(std::ios_base::eofbit);
+                return;
+            }
+
+            // The first character of the signature does not appear anywhere else in the signature
+            const char ch = std::char_traits< char >::to_char_type(c);
+            if (ch == file_format::signature[matched])
+            {
+                if (++matched == sizeof(file_format::signature))
+                    break;
+            }
+            else
+            {
+                matched = ch == file_format::signature[0] ? 1u : 0u;
+            }
+        }
+
+        m_file.seekg(-static_cast< std::streamoff >(sizeof(file_format::signature)), std::ios_base::cur);
+    }
+
+    //! Decodes the next record in the block
+    bool read_record(attribute_value_set& values)
+    {
+        payload_reader reader(&m_payload[0] + m_position, &m_payload[0] + m_payload.size());
+        while (!reader.empty())
+        {
+            const unsigned char tag = reader.read_byte();
+            switch (tag)
+            {
+            case file_format::name_entry_tag:
+                {
+                    const uint32_t id = reader.read_varint32();
+                    if (BOOST_UNLIKELY(id != m_names.size() + 1u))
+                        BOOST_LOG_THROW_DESCR(parse_error, "Invalid attribute name identifier in the binary log file");
+                    const std::pair< const char*, std::size_t > name = reader.read_string();
+                    m_names.push_back(attribute_name(std::string(name.first, name.second)));
+                }
+                break;
+
+            case file_format::site_entry_tag:
+                read_site(reader);
+                break;
+
+            case file_format::record_entry_tag:
+                {
+                    const uint32_t count = reader.read_varint32();
+                    for (uint32_t i = 0u; i < count; ++i)
+                    {
+                        const uint32_t id = reader.read_varint32();
+                        if (BOOST_UNLIKELY(id == 0u || id > m_names.size()))
+                            BOOST_LOG_THROW_DESCR(parse_error, "Undefined attribute name identifier in the binary log file");
+                        attribute_value value = read_value(reader);
+                        if (!!value)
+                            values.insert(m_names[id - 1u], value);
+                    }
+                    m_position = reader.position() - &m_payload[0];
+                }
+                return true;
+
+            default:
+                BOOST_LOG_THROW_DESCR(parse_error, "Invalid entry in the binary log file");
+            }
+        }
+
+        m_position = m_payload.size();
+        return false;
+    }
+
+    //! Decodes a deferred message site definition
+    void read_site(payload_reader& reader)
+    {
+        const uint32_t id = reader.read_varint32();
+        if (BOOST_UNLIKELY(id != m_sites.size() + 1u))
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid deferred message site identifier in the binary log file");
+
+        shared_ptr< decoded_message_site > site = boost::make_shared< decoded_message_site >();
+        std::pair< const char*, std::size_t > str = reader.read_string();
+        site->format.assign(str.first, str.second);
+        str = reader.read_string();
+        site->file.assign(str.first, str.second);
+        site->site.line = reader.read_varint32();
+        site->site.argument_count = reader.read_varint32();
+        site->argument_types.reserve(site->site.argument_count + 1u);
+        for (unsigned int i = 0u; i < site->site.argument_count; ++i)
+        {
+            const unsigned char type = reader.read_byte();
+            if (BOOST_UNLIKELY(type < deferred_argument::boolean || type > deferred_argument::pointer || type == deferred_argument::string_literal))
+                BOOST_LOG_THROW_DESCR(parse_error, "Invalid deferred message argument type in the binary log file");
+            site->argument_types.push_back(type);
+        }
+        site->argument_types.push_back(static_cast< unsigned char >(deferred_argument::end_of_arguments));
+
+        site->site.format = site->format.c_str();
+        site->site.format_size = static_cast< unsigned int >(site->format.size());
+        site->site.file = site->file.c_str();
+        site->site.argument_types = &site->argument_types[0];
+
+        m_sites.push_back(site);
+    }
+
+    //! Decodes an attribute value. Returns an empty value if the value type is not supported in this process.
+    attribute_value read_value(payload_reader& reader)
+    {
+        const unsigned char tag = reader.read_byte();
+        switch (tag)
+        {
+        case file_format::bool_tag:
+            return attributes::make_attribute_value(reader.read_byte() != 0u);
+        case file_format::char_tag:
+            return attributes::make_attribute_value(static_cast< char >(reader.read_byte()));
+        case file_format::signed_char_tag:
+            return attributes::make_attribute_value(static_cast< signed char >(reader.read_byte()));
+        case file_format::unsigned_char_tag:
+            return attributes::make_attribute_value(reader.read_byte());
+        case file_format::short_tag:
+            return attributes::make_attribute_value(static_cast< short >(file_format::zigzag_decode(reader.read_varint())));
+        case file_format::unsigned_short_tag:
+            return attributes::make_attribute_value(static_cast< unsigned short >(reader.read_varint()));
+        case file_format::int_tag:
+            return attributes::make_attribute_value(static_cast< int >(file_format::zigzag_decode(reader.read_varint())));
+        case file_format::unsigned_int_tag:
+            return attributes::make_attribute_value(static_cast< unsigned int >(reader.read_varint()));
+        case file_format::long_tag:
+            return attributes::make_attribute_value(static_cast< long >(file_format::zigzag_decode(reader.read_varint())));
+        case file_format::unsigned_long_tag:
+            return attributes::make_attribute_value(static_cast< unsigned long >(reader.read_varint()));
+        case file_format::long_long_tag:
+            return attributes::make_attribute_value(static_cast< long long >(file_format::zigzag_decode(reader.read_varint())));
+        case file_format::unsigned_long_long_tag:
+            return attributes::make_attribute_value(static_cast< unsigned long long >(reader.read_varint()));
+        case file_format::float_tag:
+            return attributes::make_attribute_value(reader.read_float());
+        case file_format::double_tag:
+            return attributes::make_attribute_value(reader.read_double());
+        case file_format::long_double_tag:
+            return attributes::make_attribute_value(static_cast< long double >(reader.read_double()));
+
+        case file_format::string_tag:
+            {
+                const std::pair< const char*, std::size_t > str = reader.read_string();
+                return attributes::make_attribute_value(std::string(str.first, str.second));
+            }
+
+        case file_format::severity_level_tag:
+            return attributes::make_attribute_value(static_cast< trivial::severity_level >(reader.read_byte()));
+
+        case file_format::ptime_tag:
+            {
+                const int64_t since_epoch = static_cast< int64_t >(reader.read_fixed< uint64_t >());
+                return attributes::make_attribute_value(posix_time::ptime(gregorian::date(1970, 1, 1)) + posix_time::microseconds(since_epoch));
+            }
+
+        case file_format::special_ptime_tag:
+            {
+                const unsigned char value = reader.read_byte();
+                return attributes::make_attribute_value(posix_time::ptime(
+                    value == 0u ? date_time::not_a_date_time : (value == 1u ? date_time::pos_infin : date_time::neg_infin)));
+            }
+
+        case file_format::process_id_tag:
+            return attributes::make_attribute_value(aux::process::id(static_cast< aux::process::native_type >(reader.read_varint())));
+
+        case file_format::thread_id_tag:
+            {
+                const uint64_t id = reader.read_varint();
+#if !defined(BOOST_LOG_NO_THREADS)
+                return attributes::make_attribute_value(aux::thread::id(static_cast< aux::thread::native_type >(id)));
+#else
+                (void)id;
+                return attribute_value();
+#endif
+            }
+
+        case file_format::deferred_message_tag:
+            return read_deferred_message(reader);
+
+        default:
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid attribute value type in the binary log file");
+        }
+    }
+
+    //! Decodes a deferred message and converts its arguments to the in-memory representation
+    attribute_value read_deferred_message(payload_reader& reader)
+    {
+        const uint32_t id = reader.read_varint32();
+        if (BOOST_UNLIKELY(id == 0u || id > m_sites.size()))
+            BOOST_LOG_THROW_DESCR(parse_error, "Undefined deferred message site identifier in the binary log file");
+        shared_ptr< const decoded_message_site > const& site = m_sites[id - 1u];
+
+        const std::pair< const char*, std::size_t > encoded = reader.read_string();
+        const unsigned char* const encoded_begin = reinterpret_cast< const unsigned char* >(encoded.first);
+        payload_reader args_reader(encoded_begin, encoded_begin + encoded.second);
+
+        std::vector< unsigned char > args;
+        args.reserve(encoded.second * 2u);
+        for (unsigned int i = 0u; i < site->site.argument_count; ++i)
+        {
+            switch (site->argument_types[i])
+            {
+            case deferred_argument::boolean:
+            case deferred_argument::character:
+                args.push_back(args_reader.read_byte());
+                break;
+
+            case deferred_argument::signed_integer:
+                append_argument(args, file_format::zigzag_decode(args_reader.read_varint()));
+                break;
+
+            case deferred_argument::unsigned_integer:
+            case deferred_argument::pointer:
+                append_argument(args, args_reader.read_varint());
+                break;
+
+            case deferred_argument::floating_point:
+                append_argument(args, args_reader.read_double());
+                break;
+
+            default: // deferred_argument::string
+                {
+                    const std::pair< const char*, std::size_t > str = args_reader.read_string();
+                    append_argument(args, static_cast< uint32_t >(str.second));
+                    args.insert(args.end(), reinterpret_cast< const unsigned char* >(str.first), reinterpret_cast< const unsigned char* >(str.first) + str.second);
+                }
+                break;
+            }
+        }
+
+        if (BOOST_UNLIKELY(!args_reader.empty()))
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid deferred message arguments in the binary log file");
+
+        return attribute_value(new decoded_message_value(site, args));
+    }
+};
+
+BOOST_LOG_API binary_log_reader::binary_log_reader(filesystem::path const& file_name) :
+    m_pImpl(new implementation())
+{
+    m_pImpl->m_file.open(file_name, std::ios_base::in | std::ios_base::binary);
+    if (BOOST_UNLIKELY(!m_pImpl->m_file.is_open()))
+    {
+        delete m_pImpl;
+        BOOST_LOG_THROW_DESCR_PARAMS(system_error, "Failed to open the binary log file", (system::error_code(system::errc::no_such_file_or_directory, system::generic_category())));
+    }
+}
+
+BOOST_LOG_API binary_log_reader::~binary_log_reader()
+{
+    delete m_pImpl;
+}
+
+BOOST_LOG_API bool binary_log_reader::read(attribute_value_set& values)
+{
+    implementation* const impl = m_pImpl;
+    while (true)
+    {
+        if (impl->m_position < impl->m_payload.size())
+        {
+            try
+            {
+                if (impl->read_record(values))
+                    return true;
+            }
+            catch (...)
+            {
+                // Skip the rest of the damaged block
+                impl->m_payload.clear();
+                impl->m_position = 0u;
+                throw;
+            }
+        }
+
+        if (!impl->read_block())
+            return false;
+    }
+}
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
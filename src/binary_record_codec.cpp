@@ -0,0 +1,407 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_record_codec.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/detail/binary_record_codec.hpp>
+#include <boost/log/detail/process_id.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/thread_id.hpp>
+#endif
+#include <boost/log/exceptions.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/attribute_value_impl.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include "binary_value_encoder.hpp"
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+namespace {
+
+/*
+ * The binary record format (all integers are in the native byte order, as the format is intended for communication between processes on the same host):
+ *
+ * record := signature version entry_count entry*
+ * signature := 'B' 'L'
+ * version := uint16, currently 1
+ * entry_count := uint32
+ * entry := value_tag name_size name value
+ * value_tag := uint8, one of the value_tag constants below
+ * name_size := uint16
+ * name := name_size chars of the attribute name
+ *
+ * The value encoding is defined by the value tag. Integers and floating point numbers are stored with a fixed size that does not
+ * depend on the platform ABI. Strings are stored as uint32 size followed by the string characters.
+ *
+ * Some types are not preserved exactly. String literals are stored as strings and decoded as std::string, as the decoding process
+ * does not have the literal storage. long double values are stored as double, since the long double format depends on the
+ * platform ABI, and are decoded as long double with double precision. Deferred messages and values of the types with a registered
+ * string conversion are stored as strings.
+ */
+
+//! Binary record format version
+BOOST_CONSTEXPR_OR_CONST uint16_t binary_record_version = 1u;
+
+//! Value type tags
+enum value_tag
+{
+    bool_tag = 1,
+    char_tag,
+    signed_char_tag,
+    unsigned_char_tag,
+    short_tag,
+    unsigned_short_tag,
+    int_tag,
+    unsigned_int_tag,
+    long_tag,
+    unsigned_long_tag,
+    long_long_tag,
+    unsigned_long_long_tag,
+    float_tag,
+    double_tag,
+    long_double_tag,
+    string_tag,
+    severity_level_tag,
+    ptime_tag,
+    process_id_tag,
+    thread_id_tag
+};
+
+//! Time point kinds
+enum ptime_kind
+{
+    normal_ptime = 0,
+    not_a_date_time_ptime,
+    pos_infin_ptime,
+    neg_infin_ptime
+};
+
+//! The function appends a value of a fixed size type to the buffer
+template< typename T >
+inline void write_raw(std::string& buffer, T value)
+{
+    buffer.append(reinterpret_cast< const char* >(&value), sizeof(value));
+}
+
+//! The function overwrites a value of a fixed size type in the buffer
+template< typename T >
+inline void overwrite_raw(std::string& buffer, std::string::size_type pos, T value)
+{
+    std::memcpy(&buffer[pos], &value, sizeof(value));
+}
+
+//! Attribute value writer for binary_value_encoder
+class value_writer
+{
+private:
+    std::string& m_buffer;
+    std::string const* m_name;
+
+public:
+    explicit value_writer(std::string& buffer) : m_buffer(buffer), m_name(NULL)
+    {
+    }
+
+    void set_name(std::string const& name)
+    {
+        m_name = &name;
+    }
+
+    void operator() (bool value) const { write_header(bool_tag); write_raw< uint8_t >(m_buffer, value); }
+    void operator() (char value) const { write_header(char_tag); write_raw< char >(m_buffer, value); }
+    void operator() (signed char value) const { write_header(signed_char_tag); write_raw< int8_t >(m_buffer, value); }
+    void operator() (unsigned char value) const { write_header(unsigned_char_tag); write_raw< uint8_t >(m_buffer, value); }
+    void operator() (short value) const { write_header(short_tag); write_raw< int16_t >(m_buffer, value); }
+    void operator() (unsigned short value) const { write_header(unsigned_short_tag); write_raw< uint16_t >(m_buffer, value); }
+    void operator() (int value) const { write_header(int_tag); write_raw< int32_t >(m_buffer, value); }
+    void operator() (unsigned int value) const { write_header(unsigned_int_tag); write_raw< uint32_t >(m_buffer, value); }
+    void operator() (long value) const { write_header(long_tag); write_raw< int64_t >(m_buffer, value); }
+    void operator() (unsigned long value) const { write_header(unsigned_long_tag); write_raw< uint64_t >(m_buffer, value); }
+    void operator() (long long value) const { write_header(long_long_tag); write_raw< int64_t >(m_buffer, value); }
+    void operator() (unsigned long long value) const { write_header(unsigned_long_long_tag); write_raw< uint64_t >(m_buffer, value); }
+    void operator() (float value) const { write_header(float_tag); write_raw< float >(m_buffer, value); }
+    void operator() (double value) const { write_header(double_tag); write_raw< double >(m_buffer, value); }
+    void operator() (long double value) const { write_header(long_double_tag); write_raw< double >(m_buffer, static_cast< double >(value)); }
+    void operator() (std::string const& value) const { write_string(value.data(), value.size()); }
+    void operator() (basic_string_literal< char > const& value) const { write_string(value.c_str(), value.size()); }
+    void operator() (trivial::severity_level value) const { write_header(severity_level_tag); write_raw< int32_t >(m_buffer, value); }
+
+    void operator() (posix_time::ptime const& value) const
+    {
+        write_header(ptime_tag);
+        if (BOOST_LIKELY(!value.is_special()))
+        {
+            write_raw< uint8_t >(m_buffer, normal_ptime);
+            write_raw< int64_t >(m_buffer, (value - posix_time::ptime(gregorian::date(1970, 1, 1))).total_microseconds());
+        }
+        else
+        {
+            write_raw< uint8_t >(m_buffer, value.is_not_a_date_time() ? not_a_date_time_ptime : (value.is_pos_infinity() ? pos_infin_ptime : neg_infin_ptime));
+            write_raw< int64_t >(m_buffer, 0);
+        }
+    }
+
+    void operator() (process::id const& value) const { write_header(process_id_tag); write_raw< uint64_t >(m_buffer, value.native_id()); }
+#if !defined(BOOST_LOG_NO_THREADS)
+    void operator() (thread::id const& value) const { write_header(thread_id_tag); write_raw< uint64_t >(m_buffer, value.native_id()); }
+#endif
+
+    void operator() (deferred_message const& value) const
+    {
+        // The message site is only valid in the sending process, so the message is sent formatted
+        std::string str;
+        basic_formatting_ostream< char > strm(str);
+        strm << value;
+        strm.flush();
+        write_string(str.data(), str.size());
+    }
+
+private:
+    void write_header(value_tag tag) const
+    {
+        if (BOOST_UNLIKELY(m_name->size() > 0xFFFFu))
+            BOOST_LOG_THROW_DESCR(limitation_error, "Attribute name is too long to be stored in a binary log record");
+
+        write_raw< uint8_t >(m_buffer, static_cast< uint8_t >(tag));
+        write_raw< uint16_t >(m_buffer, static_cast< uint16_t >(m_name->size()));
+        m_buffer.append(*m_name);
+    }
+
+    void write_string(const char* str, std::size_t size) const
+    {
+        if (BOOST_UNLIKELY(size > 0xFFFFFFFFu))
+            BOOST_LOG_THROW_DESCR(limitation_error, "String attribute value is too long to be stored in a binary log record");
+
+        write_header(string_tag);
+        write_raw< uint32_t >(m_buffer, static_cast< uint32_t >(size));
+        m_buffer.append(str, size);
+    }
+};
+
+//! Binary record reader
+class record_reader
+{
+private:
+    const unsigned char* m_p;
+    const unsigned char* const m_end;
+
+public:
+    record_reader(const void* data, std::size_t size) :
+        m_p(static_cast< const unsigned char* >(data)),
+        m_end(static_cast< const unsigned char* >(data) + size)
+    {
+    }
+
+    template< typename T >
+    T read_raw()
+    {
+        T value;
+        std::memcpy(&value, read_bytes(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    const char* read_bytes(std::size_t size)
+    {
+        if (BOOST_UNLIKELY(static_cast< std::size_t >(m_end - m_p) < size))
+            BOOST_LOG_THROW_DESCR(parse_error, "Binary log record is truncated");
+
+        const unsigned char* p = m_p;
+        m_p += size;
+        return reinterpret_cast< const char* >(p);
+    }
+
+    bool is_at_end() const BOOST_NOEXCEPT
+    {
+        return m_p == m_end;
+    }
+};
+
+//! Decodes a time point
+inline posix_time::ptime read_ptime(record_reader& reader)
+{
+    const uint8_t kind = reader.read_raw< uint8_t >();
+    const int64_t microseconds = reader.read_raw< int64_t >();
+    switch (kind)
+    {
+    case normal_ptime:
+        return posix_time::ptime(gregorian::date(1970, 1, 1)) + posix_time::microseconds(microseconds);
+    case not_a_date_time_ptime:
+        return posix_time::ptime(posix_time::not_a_date_time);
+    case pos_infin_ptime:
+        return posix_time::ptime(posix_time::pos_infin);
+    case neg_infin_ptime:
+        return posix_time::ptime(posix_time::neg_infin);
+    default:
+        BOOST_LOG_THROW_DESCR(parse_error, "Binary log record contains an invalid time point");
+    }
+}
+
+} // namespace
+
+BOOST_LOG_API void encode_binary_record(attribute_value_set const& values, std::vector< attribute_name > const& names, std::string& buffer)
+{
+    buffer.push_back('B');
+    buffer.push_back('L');
+    write_raw< uint16_t >(buffer, binary_record_version);
+    const std::string::size_type count_pos = buffer.size();
+    write_raw< uint32_t >(buffer, 0u);
+
+    value_writer writer(buffer);
+    binary_value_encoder< value_writer > encoder(writer);
+    uint32_t count = 0u;
+
+    if (names.empty())
+    {
+        for (attribute_value_set::const_iterator it = values.begin(), end = values.end(); it != end; ++it)
+        {
+            writer.set_name(it->first.string());
+            if (encoder.encode(it->second))
+                ++count;
+        }
+    }
+    else
+    {
+        for (std::vector< attribute_name >::const_iterator it = names.begin(), end = names.end(); it != end; ++it)
+        {
+            attribute_value_set::const_iterator value = values.find(*it);
+            if (value != values.end())
+            {
+                writer.set_name(it->string());
+                if (encoder.encode(value->second))
+                    ++count;
+            }
+        }
+    }
+
+    overwrite_raw< uint32_t >(buffer, count_pos, count);
+}
+
+BOOST_LOG_API void decode_binary_record(const void* data, std::size_t size, attribute_value_set& values)
+{
+    record_reader reader(data, size);
+
+    const char* signature = reader.read_bytes(2u);
+    if (BOOST_UNLIKELY(signature[0] != 'B' || signature[1] != 'L'))
+        BOOST_LOG_THROW_DESCR(parse_error, "Invalid binary log record signature");
+    if (BOOST_UNLIKELY(reader.read_raw< uint16_t >() != binary_record_version))
+        BOOST_LOG_THROW_DESCR(parse_error, "Unsupported binary log record version");
+
+    for (uint32_t count = reader.read_raw< uint32_t >(); count > 0u; --count)
+    {
+        const uint8_t tag = reader.read_raw< uint8_t >();
+        const uint16_t name_size = reader.read_raw< uint16_t >();
+        const char* name_data = reader.read_bytes(name_size);
+        const attribute_name name(std::string(name_data, name_size));
+
+        attribute_value value;
+        switch (tag)
+        {
+        case bool_tag:
+            value = attributes::make_attribute_value(reader.read_raw< uint8_t >() != 0u);
+            break;
+        case char_tag:
+            value = attributes::make_attribute_value(reader.read_raw< char >());
+            break;
+        case signed_char_tag:
+            value = attributes::make_attribute_value(static_cast< signed char >(reader.read_raw< int8_t >()));
+            break;
+        case unsigned_char_tag:
+            value = attributes::make_attribute_value(static_cast< unsigned char >(reader.read_raw< uint8_t >()));
+            break;
+        case short_tag:
+            value = attributes::make_attribute_value(static_cast< short >(reader.read_raw< int16_t >()));
+            break;
+        case unsigned_short_tag:
+            value = attributes::make_attribute_value(static_cast< unsigned short >(reader.read_raw< uint16_t >()));
+            break;
+        case int_tag:
+            value = attributes::make_attribute_value(static_cast< int >(reader.read_raw< int32_t >()));
+            break;
+        case unsigned_int_tag:
+            value = attributes::make_attribute_value(static_cast< unsigned int >(reader.read_raw< uint32_t >()));
+            break;
+        case long_tag:
+            value = attributes::make_attribute_value(static_cast< long >(reader.read_raw< int64_t >()));
+            break;
+        case unsigned_long_tag:
+            value = attributes::make_attribute_value(static_cast< unsigned long >(reader.read_raw< uint64_t >()));
+            break;
+        case long_long_tag:
+            value = attributes::make_attribute_value(static_cast< long long >(reader.read_raw< int64_t >()));
+            break;
+        case unsigned_long_long_tag:
+            value = attributes::make_attribute_value(static_cast< unsigned long long >(reader.read_raw< uint64_t >()));
+            break;
+        case float_tag:
+            value = attributes::make_attribute_value(reader.read_raw< float >());
+            break;
+        case double_tag:
+            value = attributes::make_attribute_value(reader.read_raw< double >());
+            break;
+        case long_double_tag:
+            value = attributes::make_attribute_value(static_cast< long double >(reader.read_raw< double >()));
+            break;
+        case string_tag:
+            {
+                const uint32_t string_size = reader.read_raw< uint32_t >();
+                const char* string_data = reader.read_bytes(string_size);
+                value = attributes::make_attribute_value(std::string(string_data, string_size));
+            }
+            break;
+        case severity_level_tag:
+            value = attributes::make_attribute_value(static_cast< trivial::severity_level >(reader.read_raw< int32_t >()));
+            break;
+        case ptime_tag:
+            value = attributes::make_attribute_value(read_ptime(reader));
+            break;
+        case process_id_tag:
+            value = attributes::make_attribute_value(process::id(static_cast< process::id::native_type >(reader.read_raw< uint64_t >())));
+            break;
+#if !defined(BOOST_LOG_NO_THREADS)
+        case thread_id_tag:
+            value = attributes::make_attribute_value(thread::id(static_cast< thread::id::native_type >(reader.read_raw< uint64_t >())));
+            break;
+#endif
+        default:
+            BOOST_LOG_THROW_DESCR(parse_error, "Binary log record contains an attribute value of unsupported type");
+        }
+
+        values.insert(name, value);
+    }
+
+    if (BOOST_UNLIKELY(!reader.is_at_end()))
+        BOOST_LOG_THROW_DESCR(parse_error, "Binary log record contains trailing data");
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
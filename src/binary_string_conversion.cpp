@@ -0,0 +1,86 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_string_conversion.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <map>
+#include <string>
+#include <boost/type_index.hpp>
+#include <boost/log/detail/singleton.hpp>
+#include <boost/log/utility/binary_string_conversion.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/locks.hpp>
+#include <boost/log/detail/light_rw_mutex.hpp>
+#endif
+#include "binary_value_encoder.hpp"
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+//! The repository of the string conversions registered for the binary formats
+class binary_string_converters :
+    public lazy_singleton< binary_string_converters >
+{
+private:
+    typedef std::map< typeindex::type_index, binary_string_converter > converter_map;
+
+#if !defined(BOOST_LOG_NO_THREADS)
+    typedef light_rw_mutex mutex_type;
+    mutable mutex_type m_Mutex;
+#endif
+    converter_map m_Converters;
+
+public:
+    //! Registers the conversion, if there is none for the type
+    void add(typeindex::type_index const& type, binary_string_converter converter)
+    {
+        BOOST_LOG_EXPR_IF_MT(exclusive_lock_guard< mutex_type > _(m_Mutex);)
+        m_Converters.insert(converter_map::value_type(type, converter));
+    }
+
+    //! Returns the conversion for the type or \c NULL
+    binary_string_converter find(typeindex::type_index const& type) const
+    {
+        BOOST_LOG_EXPR_IF_MT(shared_lock_guard< mutex_type > _(m_Mutex);)
+        converter_map::const_iterator it = m_Converters.find(type);
+        return it != m_Converters.end() ? it->second : NULL;
+    }
+};
+
+} // namespace
+
+BOOST_LOG_API void register_binary_string_converter(typeindex::type_index const& type, binary_string_converter converter)
+{
+    binary_string_converters::get().add(type, converter);
+}
+
+bool convert_to_registered_binary_string(attribute_value const& value, std::string& str)
+{
+    const binary_string_converter converter = binary_string_converters::get().find(value.get_type());
+    return converter != NULL && converter(value, str);
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
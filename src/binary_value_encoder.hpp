@@ -0,0 +1,121 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   binary_value_encoder.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_BINARY_VALUE_ENCODER_HPP_INCLUDED_
+#define BOOST_LOG_BINARY_VALUE_ENCODER_HPP_INCLUDED_
+
+#include <string>
+#include <boost/mpl/vector/vector30.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/seq/enum.hpp>
+#include <boost/preprocessor/seq/size.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/process_id.hpp>
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/detail/thread_id.hpp>
+#endif
+#include <boost/log/trivial.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/utility/type_dispatch/static_type_dispatcher.hpp>
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+#if !defined(BOOST_LOG_NO_THREADS)
+#define BOOST_LOG_AUX_BINARY_VALUE_THREAD_ID_TYPES() (boost::log::aux::thread::id)
+#else
+#define BOOST_LOG_AUX_BINARY_VALUE_THREAD_ID_TYPES()
+#endif
+
+//! Boost.Preprocessor sequence of attribute value types supported by the binary formats
+#define BOOST_LOG_AUX_BINARY_VALUE_TYPES()\
+    (bool)(char)(signed char)(unsigned char)(short)(unsigned short)(int)(unsigned int)(long)(unsigned long)(long long)(unsigned long long)\
+    (float)(double)(long double)(std::string)(boost::log::basic_string_literal< char >)(boost::log::trivial::severity_level)\
+    (boost::posix_time::ptime)(boost::log::aux::process::id)(boost::log::deferred_message)BOOST_LOG_AUX_BINARY_VALUE_THREAD_ID_TYPES()
+
+typedef BOOST_PP_CAT(mpl::vector, BOOST_PP_SEQ_SIZE(BOOST_LOG_AUX_BINARY_VALUE_TYPES()))<
+    BOOST_PP_SEQ_ENUM(BOOST_LOG_AUX_BINARY_VALUE_TYPES())
+> binary_value_types;
+
+/*!
+ * Converts the attribute value to a string, if a conversion is registered for its type with \c register_binary_string_conversion.
+ * Returns \c false if there is no conversion for the value type.
+ */
+bool convert_to_registered_binary_string(attribute_value const& value, std::string& str);
+
+/*!
+ * \brief Attribute value encoder for the binary formats
+ *
+ * The encoder is shared by the binary formats, which differ in the value encoding. The encoder dispatches the attribute values
+ * of the supported types to the writer, which must accept the values of all types in \c binary_value_types. The values of other
+ * types are passed to the writer as strings, if a string conversion is registered for the type.
+ */
+template< typename WriterT >
+class binary_value_encoder
+{
+public:
+    typedef void result_type;
+
+private:
+    WriterT& m_writer;
+    static_type_dispatcher< binary_value_types > m_dispatcher;
+    //! Buffer for the values converted to strings
+    std::string m_string;
+
+public:
+    explicit binary_value_encoder(WriterT& writer) : m_writer(writer), m_dispatcher(*this)
+    {
+    }
+
+    //! Writes the attribute value. Returns \c false if the value type is not supported, in which case nothing is written.
+    bool encode(attribute_value const& value)
+    {
+        if (value.dispatch(m_dispatcher))
+            return true;
+
+        m_string.clear();
+        if (!convert_to_registered_binary_string(value, m_string))
+            return false;
+
+        m_writer(m_string);
+        return true;
+    }
+
+    template< typename T >
+    void operator() (T const& value) const
+    {
+        m_writer(value);
+    }
+
+    BOOST_DELETED_FUNCTION(binary_value_encoder(binary_value_encoder const&))
+    BOOST_DELETED_FUNCTION(binary_value_encoder& operator= (binary_value_encoder const&))
+};
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_BINARY_VALUE_ENCODER_HPP_INCLUDED_
@@ -0,0 +1,99 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   char_decorator.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <cstring>
+#include <boost/cstdint.hpp>
+#include <boost/log/expressions/formatters/char_decorator.hpp>
+#if defined(BOOST_LOG_USE_SSE42) || defined(BOOST_LOG_USE_AVX2)
+#include "x86_cpu_features.hpp"
+#endif
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+#if defined(BOOST_LOG_USE_SSE42)
+extern find_any_char_t find_any_char_sse42;
+#endif
+#if defined(BOOST_LOG_USE_AVX2)
+extern find_any_char_t find_any_char_avx2;
+#endif
+
+const char* find_any_char_generic(const char* begin, const char* end, const char* chars, std::size_t count)
+{
+    if (count == 1u)
+    {
+        const void* p = std::memchr(begin, static_cast< unsigned char >(chars[0]), static_cast< std::size_t >(end - begin));
+        return p ? static_cast< const char* >(p) : end;
+    }
+
+    // Build a bit set of the characters to look for
+    uint32_t char_set[8u] = {};
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        const unsigned int c = static_cast< unsigned char >(chars[i]);
+        char_set[c >> 5u] |= 1u << (c & 31u);
+    }
+
+    for (; begin != end; ++begin)
+    {
+        const unsigned int c = static_cast< unsigned char >(*begin);
+        if ((char_set[c >> 5u] & (1u << (c & 31u))) != 0u)
+            break;
+    }
+
+    return begin;
+}
+
+BOOST_LOG_API find_any_char_t* find_any_char = &find_any_char_generic;
+
+#if defined(BOOST_LOG_USE_SSE42) || defined(BOOST_LOG_USE_AVX2)
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+struct function_pointer_initializer
+{
+    function_pointer_initializer()
+    {
+        const x86_cpu_features features;
+#if defined(BOOST_LOG_USE_SSE42)
+        if (features.sse42)
+            find_any_char = &find_any_char_sse42;
+#endif
+#if defined(BOOST_LOG_USE_AVX2)
+        if (features.avx2)
+            find_any_char = &find_any_char_avx2;
+#endif
+    }
+};
+
+static function_pointer_initializer g_function_pointer_initializer;
+
+} // namespace
+
+#endif // defined(BOOST_LOG_USE_SSE42) || defined(BOOST_LOG_USE_AVX2)
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -0,0 +1,139 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   char_decorator_avx2.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+// NOTE: You should generally avoid including headers as much as possible here, because this file
+//       is compiled with special compiler options, and any included header may result in generation of
+//       unintended code with these options and violation of ODR.
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+extern const char* find_any_char_generic(const char* begin, const char* end, const char* chars, std::size_t count);
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+//! Returns the index of the least significant set bit in a non-zero mask
+BOOST_FORCEINLINE unsigned int find_first_set(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return static_cast< unsigned int >(__builtin_ctz(mask));
+#else
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast< unsigned int >(index);
+#endif
+}
+
+} // namespace
+
+const char* find_any_char_avx2(const char* begin, const char* end, const char* chars, std::size_t count)
+{
+    // The tail is processed with pcmpestri, which only supports up to 16 characters in the set
+    if (count == 0u || count > 16u)
+        return find_any_char_generic(begin, end, chars, count);
+
+    if ((end - begin) >= 32)
+    {
+        __m256i mm_set[16u];
+        for (std::size_t i = 0u; i < count; ++i)
+            mm_set[i] = _mm256_set1_epi8(chars[i]);
+
+        while (true)
+        {
+            const __m256i mm_chars = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(begin));
+            __m256i mm_mask = _mm256_cmpeq_epi8(mm_chars, mm_set[0]);
+            for (std::size_t i = 1u; i < count; ++i)
+                mm_mask = _mm256_or_si256(mm_mask, _mm256_cmpeq_epi8(mm_chars, mm_set[i]));
+
+            const unsigned int mask = static_cast< unsigned int >(_mm256_movemask_epi8(mm_mask));
+            if (mask != 0u)
+            {
+                _mm256_zeroupper();
+                return begin + find_first_set(mask);
+            }
+
+            begin += 32;
+            const std::ptrdiff_t size = end - begin;
+            if (size < 32)
+            {
+                if (size == 0)
+                    break;
+
+                // Process the tail with a load that overlaps the already processed characters. Since the overlapped characters
+                // were not matched, the first match, if found, is in the tail.
+                begin = end - 32;
+            }
+        }
+
+        _mm256_zeroupper();
+        return end;
+    }
+
+    char buf[16u] = {};
+    for (std::size_t i = 0u; i < count; ++i)
+        buf[i] = chars[i];
+    const __m128i mm_set = _mm_loadu_si128(reinterpret_cast< const __m128i* >(buf));
+    const int set_size = static_cast< int >(count);
+
+    if ((end - begin) >= 16)
+    {
+        const __m128i mm_chars = _mm_loadu_si128(reinterpret_cast< const __m128i* >(begin));
+        const int pos = _mm_cmpestri(mm_set, set_size, mm_chars, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+        if (pos < 16)
+            return begin + pos;
+
+        begin += 16;
+        if (begin != end)
+        {
+            // See the comment above about the overlapping load
+            begin = end - 16;
+            const __m128i mm_tail = _mm_loadu_si128(reinterpret_cast< const __m128i* >(begin));
+            const int tail_pos = _mm_cmpestri(mm_set, set_size, mm_tail, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+            if (tail_pos < 16)
+                return begin + tail_pos;
+        }
+    }
+    else if (begin != end)
+    {
+        // Process short strings in a local buffer to avoid reading past the end of the string
+        const int size = static_cast< int >(end - begin);
+        for (int i = 0; i < size; ++i)
+            buf[i] = begin[i];
+        const __m128i mm_chars = _mm_loadu_si128(reinterpret_cast< const __m128i* >(buf));
+        const int pos = _mm_cmpestri(mm_set, set_size, mm_chars, size, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+        if (pos < size)
+            return begin + pos;
+    }
+
+    return end;
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
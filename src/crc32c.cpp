@@ -0,0 +1,112 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   crc32c.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include "crc32c.hpp"
+#if defined(BOOST_LOG_USE_SSE42)
+#include "x86_cpu_features.hpp"
+#endif
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+#if defined(BOOST_LOG_USE_SSE42)
+extern crc32c_update_t crc32c_update_sse42;
+#endif
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+//! Reflected CRC-32C polynomial
+BOOST_CONSTEXPR_OR_CONST uint32_t crc32c_polynomial = 0x82F63B78u;
+
+//! Lookup tables for the slicing-by-4 algorithm
+struct crc32c_tables
+{
+    uint32_t table[4u][256u];
+
+    crc32c_tables()
+    {
+        for (uint32_t i = 0u; i < 256u; ++i)
+        {
+            uint32_t crc = i;
+            for (unsigned int j = 0u; j < 8u; ++j)
+                crc = (crc >> 1u) ^ (crc32c_polynomial & (0u - (crc & 1u)));
+            table[0][i] = crc;
+        }
+
+        for (uint32_t i = 0u; i < 256u; ++i)
+        {
+            for (unsigned int j = 1u; j < 4u; ++j)
+                table[j][i] = (table[j - 1u][i] >> 8u) ^ table[0][table[j - 1u][i] & 0xFFu];
+        }
+    }
+};
+
+static const crc32c_tables g_crc32c_tables;
+
+} // namespace
+
+uint32_t crc32c_update_generic(uint32_t crc, const void* data, std::size_t size)
+{
+    const unsigned char* p = static_cast< const unsigned char* >(data);
+    const uint32_t (&table)[4u][256u] = g_crc32c_tables.table;
+
+    for (; size >= 4u; size -= 4u, p += 4u)
+    {
+        crc ^= static_cast< uint32_t >(p[0]) | (static_cast< uint32_t >(p[1]) << 8u) | (static_cast< uint32_t >(p[2]) << 16u) | (static_cast< uint32_t >(p[3]) << 24u);
+        crc = table[3][crc & 0xFFu] ^ table[2][(crc >> 8u) & 0xFFu] ^ table[1][(crc >> 16u) & 0xFFu] ^ table[0][crc >> 24u];
+    }
+
+    for (; size > 0u; --size, ++p)
+        crc = (crc >> 8u) ^ table[0][(crc ^ *p) & 0xFFu];
+
+    return crc;
+}
+
+crc32c_update_t* crc32c_update = &crc32c_update_generic;
+
+#if defined(BOOST_LOG_USE_SSE42)
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+struct crc32c_function_pointer_initializer
+{
+    crc32c_function_pointer_initializer()
+    {
+        const x86_cpu_features features;
+        if (features.sse42)
+            crc32c_update = &crc32c_update_sse42;
+    }
+};
+
+static crc32c_function_pointer_initializer g_crc32c_function_pointer_initializer;
+
+} // namespace
+
+#endif // defined(BOOST_LOG_USE_SSE42)
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -0,0 +1,50 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   crc32c.hpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#ifndef BOOST_LOG_CRC32C_HPP_INCLUDED_
+#define BOOST_LOG_CRC32C_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/log/detail/config.hpp>
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+//! The function type that updates CRC-32C (Castagnoli) checksum \a crc with \a size bytes pointed to by \a data
+typedef uint32_t crc32c_update_t(uint32_t crc, const void* data, std::size_t size);
+
+//! Pointer to the CRC-32C implementation, selected according to the CPU capabilities
+extern crc32c_update_t* crc32c_update;
+
+//! Computes CRC-32C checksum of the data
+inline uint32_t crc32c(const void* data, std::size_t size)
+{
+    return ~crc32c_update(~static_cast< uint32_t >(0u), data, size);
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
+
+#endif // BOOST_LOG_CRC32C_HPP_INCLUDED_
@@ -0,0 +1,66 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   crc32c_sse42.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+// NOTE: You should generally avoid including headers as much as possible here, because this file
+//       is compiled with special compiler options, and any included header may result in generation of
+//       unintended code with these options and violation of ODR.
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <cstring>
+#include <boost/cstdint.hpp>
+#include <nmmintrin.h>
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+uint32_t crc32c_update_sse42(uint32_t crc, const void* data, std::size_t size)
+{
+    const unsigned char* p = static_cast< const unsigned char* >(data);
+
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+    for (; size >= 8u; size -= 8u, p += 8u)
+    {
+        uint64_t n;
+        std::memcpy(&n, p, sizeof(n));
+        crc64 = _mm_crc32_u64(crc64, n);
+    }
+    crc = static_cast< uint32_t >(crc64);
+#endif
+
+    for (; size >= 4u; size -= 4u, p += 4u)
+    {
+        uint32_t n;
+        std::memcpy(&n, p, sizeof(n));
+        crc = _mm_crc32_u32(crc, n);
+    }
+
+    for (; size > 0u; --size, ++p)
+        crc = _mm_crc32_u8(crc, *p);
+
+    return crc;
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -14,6 +14,7 @@
  */
 
 #include <boost/log/detail/config.hpp>
+#include <string>
 #include <cstdio>
 #include <boost/optional/optional.hpp>
 #if !defined(BOOST_LOG_NO_THREADS)
@@ -21,6 +22,8 @@
 #include <boost/log/detail/thread_id.hpp>
 #endif
 #include <boost/log/detail/default_attribute_names.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/deferred_message.hpp>
 #include <boost/date_time/microsec_time_clock.hpp>
 #include <boost/date_time/time_resolution_traits.hpp>
 #include <boost/date_time/gregorian/gregorian_types.hpp>
@@ -182,6 +185,20 @@ struct message_printer
 
 #endif
 
+    result_type operator() (deferred_message const& msg) const
+    {
+#ifdef BOOST_LOG_USE_CHAR
+        std::string str;
+        basic_formatting_ostream< char > strm(str);
+#else
+        std::wstring str;
+        basic_formatting_ostream< wchar_t > strm(str);
+#endif
+        strm << msg;
+        strm.flush();
+        (*this)(str);
+    }
+
 private:
     const boost::log::trivial::severity_level m_level;
 };
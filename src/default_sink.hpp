@@ -17,12 +17,14 @@
 #define BOOST_LOG_DEFAULT_SINK_HPP_INCLUDED_
 
 #include <boost/log/detail/config.hpp>
+#include <boost/mpl/push_back.hpp>
 #include <boost/log/sinks/sink.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
 #include <boost/log/attributes/value_extraction.hpp>
 #include <boost/log/attributes/value_visitation.hpp>
 #include <boost/log/attributes/fallback_policy.hpp>
 #include <boost/log/expressions/message.hpp>
+#include <boost/log/utility/deferred_message.hpp>
 #include <boost/log/trivial.hpp>
 #if !defined(BOOST_LOG_NO_THREADS)
 #include <mutex>
@@ -52,7 +54,9 @@ private:
 #endif
     attribute_name const m_severity_name, m_message_name;
     value_extractor< boost::log::trivial::severity_level, fallback_to_default< boost::log::trivial::severity_level > > const m_severity_extractor;
-    value_visitor_invoker< expressions::tag::message::value_type > m_message_visitor;
+    //! Message types, including the deferred messages
+    typedef mpl::push_back< expressions::tag::message::value_type, deferred_message >::type message_types;
+    value_visitor_invoker< message_types > m_message_visitor;
 
 public:
     default_sink();
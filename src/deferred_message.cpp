@@ -0,0 +1,257 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   deferred_message.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/expressions/formatter.hpp>
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+namespace {
+
+//! Number of arguments for which the argument positions are stored on the stack
+BOOST_CONSTEXPR_OR_CONST unsigned int small_argument_count = 16u;
+
+//! Returns the size of the encoded argument
+inline std::size_t encoded_argument_size(unsigned char type, const unsigned char* p)
+{
+    switch (type)
+    {
+    case deferred_argument::boolean:
+    case deferred_argument::character:
+        return 1u;
+    case deferred_argument::signed_integer:
+    case deferred_argument::unsigned_integer:
+    case deferred_argument::pointer:
+        return sizeof(boost::uint64_t);
+    case deferred_argument::floating_point:
+        return sizeof(double);
+    case deferred_argument::string:
+        {
+            boost::uint32_t len;
+            std::memcpy(&len, p, sizeof(len));
+            return sizeof(len) + len;
+        }
+    case deferred_argument::string_literal:
+        return sizeof(const char*) + sizeof(boost::uint32_t);
+    default:
+        return 0u;
+    }
+}
+
+//! Outputs the encoded argument
+template< typename CharT >
+void output_argument(basic_formatting_ostream< CharT >& strm, unsigned char type, const unsigned char* p)
+{
+    switch (type)
+    {
+    case deferred_argument::boolean:
+        strm << (*p != 0u);
+        break;
+
+    case deferred_argument::character:
+        strm.write(reinterpret_cast< const char* >(p), 1);
+        break;
+
+    case deferred_argument::signed_integer:
+        {
+            boost::int64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            strm << static_cast< long long >(value);
+        }
+        break;
+
+    case deferred_argument::unsigned_integer:
+        {
+            boost::uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            strm << static_cast< unsigned long long >(value);
+        }
+        break;
+
+    case deferred_argument::floating_point:
+        {
+            double value;
+            std::memcpy(&value, p, sizeof(value));
+            strm << value;
+        }
+        break;
+
+    case deferred_argument::string:
+        {
+            boost::uint32_t len;
+            std::memcpy(&len, p, sizeof(len));
+            strm.write(reinterpret_cast< const char* >(p + sizeof(len)), static_cast< std::streamsize >(len));
+        }
+        break;
+
+    case deferred_argument::string_literal:
+        {
+            const char* str;
+            std::memcpy(&str, p, sizeof(str));
+            boost::uint32_t len;
+            std::memcpy(&len, p + sizeof(str), sizeof(len));
+            strm.write(str, static_cast< std::streamsize >(len));
+        }
+        break;
+
+    case deferred_argument::pointer:
+        {
+            boost::uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            strm << reinterpret_cast< const void* >(static_cast< std::size_t >(value));
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+} // namespace
+
+//! The function formats the deferred message into the stream
+template< typename CharT >
+BOOST_LOG_API void format_deferred_message(basic_formatting_ostream< CharT >& strm, deferred_message const& msg)
+{
+    deferred_message_site const& site = msg.site();
+    const unsigned int arg_count = site.argument_count;
+
+    // Find the positions of the encoded arguments
+    const unsigned char* small_args[small_argument_count];
+    std::vector< const unsigned char* > large_args;
+    const unsigned char** args = small_args;
+    if (arg_count > small_argument_count)
+    {
+        large_args.resize(arg_count);
+        args = &large_args[0];
+    }
+
+    const unsigned char* p = msg.arguments();
+    const unsigned char* const args_end = p + msg.arguments_size();
+    for (unsigned int i = 0u; i < arg_count; ++i)
+    {
+        args[i] = p;
+        p += encoded_argument_size(site.argument_types[i], p);
+        if (BOOST_UNLIKELY(p > args_end))
+        {
+            // The encoded arguments are corrupted, output the format string as is
+            strm.write(site.format, static_cast< std::streamsize >(site.format_size));
+            return;
+        }
+    }
+
+    // Output the message text, substituting the placeholders
+    const char* it = site.format;
+    const char* const end = it + site.format_size;
+    while (it != end)
+    {
+        const char* percent = static_cast< const char* >(std::memchr(it, '%', static_cast< std::size_t >(end - it)));
+        if (!percent)
+        {
+            strm.write(it, static_cast< std::streamsize >(end - it));
+            break;
+        }
+
+        strm.write(it, static_cast< std::streamsize >(percent - it));
+        it = percent + 1;
+
+        unsigned int index = 0u;
+        const char* digit = it;
+        while (digit != end && *digit >= '0' && *digit <= '9' && index <= arg_count)
+        {
+            index = index * 10u + static_cast< unsigned int >(*digit - '0');
+            ++digit;
+        }
+
+        if (digit != end && *digit == '%')
+        {
+            if (digit == it)
+            {
+                // "%%" is an escaped percent character
+                strm.write(percent, 1);
+                it = digit + 1;
+                continue;
+            }
+
+            if (index > 0u && index <= arg_count)
+            {
+                output_argument(strm, site.argument_types[index - 1u], args[index - 1u]);
+                it = digit + 1;
+                continue;
+            }
+        }
+
+        // Not a placeholder, output the percent character as is
+        strm.write(percent, 1);
+    }
+}
+
+namespace {
+
+//! Attribute value visitor that formats deferred messages
+template< typename CharT >
+struct deferred_message_visitor
+{
+    typedef void result_type;
+
+    explicit deferred_message_visitor(basic_formatting_ostream< CharT >& strm) BOOST_NOEXCEPT : m_strm(strm)
+    {
+    }
+
+    result_type operator() (deferred_message const& msg) const
+    {
+        format_deferred_message(m_strm, msg);
+    }
+
+private:
+    basic_formatting_ostream< CharT >& m_strm;
+};
+
+} // namespace
+
+//! The function formats the attribute value if it is a deferred message
+template< typename CharT >
+BOOST_LOG_API bool format_deferred_message(basic_formatting_ostream< CharT >& strm, attribute_value const& value)
+{
+    return !!boost::log::visit< deferred_message >(value, deferred_message_visitor< CharT >(strm));
+}
+
+#if defined(BOOST_LOG_USE_CHAR)
+template BOOST_LOG_API bool format_deferred_message< char >(basic_formatting_ostream< char >& strm, attribute_value const& value);
+template BOOST_LOG_API void format_deferred_message< char >(basic_formatting_ostream< char >& strm, deferred_message const& msg);
+#endif
+#if defined(BOOST_LOG_USE_WCHAR_T)
+template BOOST_LOG_API bool format_deferred_message< wchar_t >(basic_formatting_ostream< wchar_t >& strm, attribute_value const& value);
+template BOOST_LOG_API void format_deferred_message< wchar_t >(basic_formatting_ostream< wchar_t >& strm, deferred_message const& msg);
+#endif
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
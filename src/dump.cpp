@@ -17,9 +17,8 @@
 #include <ostream>
 #include <boost/cstdint.hpp>
 #include <boost/log/utility/manipulators/dump.hpp>
-#if defined(_MSC_VER) && (defined(BOOST_LOG_USE_SSSE3) || defined(BOOST_LOG_USE_AVX2))
-#include <intrin.h> // __cpuid
-#include <immintrin.h> // _xgetbv
+#if defined(BOOST_LOG_USE_SSSE3) || defined(BOOST_LOG_USE_AVX2)
+#include "x86_cpu_features.hpp"
 #endif
 #include <boost/log/detail/header.hpp>
 
@@ -132,119 +131,22 @@ struct function_pointer_initializer
 {
     function_pointer_initializer()
     {
-        // First, let's check for the max supported cpuid function
-        uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
-        cpuid(eax, ebx, ecx, edx);
-
-        const uint32_t max_cpuid_function = eax;
-        const uint32_t cpu_vendor[3u] = { ebx, edx, ecx };
-        if (max_cpuid_function >= 1)
+        const x86_cpu_features features;
+        if (features.ssse3)
         {
-            eax = 1;
-            ebx = ecx = edx = 0;
-            cpuid(eax, ebx, ecx, edx);
-
-            // Check for SSSE3 support
-            if (ecx & (1u << 9))
-            {
-                const uint32_t family = ((eax >> 8) & 0x0000000F) + ((eax >> 20) & 0x000000FF);
-                const uint32_t model = ((eax >> 4) & 0x0000000F) | ((eax >> 12) & 0x000000F0);
-
-                // Check if the CPU has slow pshufb. Some old Intel Atoms prior to Silvermont.
-                if (cpu_vendor[0] == 0x756e6547 && cpu_vendor[1] == 0x49656e69 && cpu_vendor[2] == 0x6c65746e &&
-                    family == 6 && (model == 28 || model == 38 || model == 39 || model == 53 || model == 54))
-                {
-                    enable_ssse3_slow_pshufb();
-                }
-                else
-                {
-                    enable_ssse3();
-                }
-            }
+            if (features.slow_pshufb)
+                enable_ssse3_slow_pshufb();
+            else
+                enable_ssse3();
+        }
 
 #if defined(BOOST_LOG_USE_AVX2)
-            if (max_cpuid_function >= 7)
-            {
-                // To check for AVX2 availability we also need to verify that OS supports it
-                // Check that OSXSAVE is supported by CPU
-                if (ecx & (1u << 27))
-                {
-                    // Check that it is used by the OS
-                    bool mmstate = false;
-#if defined(__GNUC__)
-                    // Get the XFEATURE_ENABLED_MASK register
-                    __asm__ __volatile__
-                    (
-                        "xgetbv\n\t"
-                            : "=a" (eax), "=d" (edx)
-                            : "c" (0)
-                    );
-                    mmstate = (eax & 6u) == 6u;
-#elif defined(_MSC_VER)
-                    mmstate = (_xgetbv(_XCR_XFEATURE_ENABLED_MASK) & 6u) == 6u;
-#endif
-
-                    if (mmstate)
-                    {
-                        // Finally, check for AVX2 support in CPU
-                        eax = 7;
-                        ebx = ecx = edx = 0;
-                        cpuid(eax, ebx, ecx, edx);
-
-                        if (ebx & (1u << 5))
-                            enable_avx2();
-                    }
-                }
-            }
+        if (features.avx2)
+            enable_avx2();
 #endif // defined(BOOST_LOG_USE_AVX2)
-        }
     }
 
 private:
-    static void cpuid(uint32_t& eax, uint32_t& ebx, uint32_t& ecx, uint32_t& edx)
-    {
-#if defined(__GNUC__)
-#if (defined(__i386__) || defined(__VXWORKS__)) && (defined(__PIC__) || defined(__PIE__)) && !(defined(__clang__) || (defined(BOOST_GCC) && BOOST_GCC >= 50100))
-        // Unless the compiler can do it automatically, we have to backup ebx in 32-bit PIC/PIE code because it is reserved by the ABI.
-        // For VxWorks ebx is reserved on 64-bit as well.
-#if defined(__x86_64__)
-        uint64_t rbx = ebx;
-        __asm__ __volatile__
-        (
-            "xchgq %%rbx, %0\n\t"
-            "cpuid\n\t"
-            "xchgq %%rbx, %0\n\t"
-                : "+DS" (rbx), "+a" (eax), "+c" (ecx), "+d" (edx)
-        );
-        ebx = static_cast< uint32_t >(rbx);
-#else // defined(__x86_64__)
-        __asm__ __volatile__
-        (
-            "xchgl %%ebx, %0\n\t"
-            "cpuid\n\t"
-            "xchgl %%ebx, %0\n\t"
-                : "+DS" (ebx), "+a" (eax), "+c" (ecx), "+d" (edx)
-        );
-#endif // defined(__x86_64__)
-#else
-        __asm__ __volatile__
-        (
-            "cpuid\n\t"
-                : "+a" (eax), "+b" (ebx), "+c" (ecx), "+d" (edx)
-        );
-#endif
-#elif defined(_MSC_VER)
-        int regs[4] = {};
-        __cpuid(regs, eax);
-        eax = regs[0];
-        ebx = regs[1];
-        ecx = regs[2];
-        edx = regs[3];
-#else
-#error Boost.Log: Unexpected compiler
-#endif
-    }
-
     static void enable_ssse3_slow_pshufb()
     {
         dump_data_char = &dump_data_char_ssse3_slow_pshufb;
@@ -14,10 +14,13 @@
  */
 
 #include <boost/log/detail/config.hpp>
-#include <map>
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 #include <boost/limits.hpp>
 #include <boost/type_index.hpp>
+#include <boost/atomic/atomic.hpp>
 #include <boost/core/snprintf.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/detail/singleton.hpp>
@@ -41,15 +44,120 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
 struct loggers_repository :
     public log::aux::lazy_singleton< loggers_repository >
 {
-    //! Repository map type
-    typedef std::map< typeindex::type_index, shared_ptr< logger_holder_base > > loggers_map_t;
+    //! Registered logger holder
+    struct entry
+    {
+        //! Hash value of the tag type
+        const std::size_t m_Hash;
+        //! Tag type
+        const typeindex::type_index m_Key;
+        //! Logger holder
+        const shared_ptr< logger_holder_base > m_Holder;
+
+        entry(std::size_t hash, typeindex::type_index key, shared_ptr< logger_holder_base > const& holder) :
+            m_Hash(hash), m_Key(key), m_Holder(holder)
+        {
+        }
+    };
+
+    /*!
+     * Hash table of the registered logger holders. Once the table is published, its buckets can only change
+     * from empty to filled, so the table can be read without locking. When the table becomes too full,
+     * a larger table is published instead. The previous tables and the entries are kept until the repository
+     * is destroyed because they may still be accessed by the threads that are looking up loggers.
+     */
+    struct table
+    {
+        //! Table size mask, the table size is a power of two
+        const std::size_t m_Mask;
+        //! Number of filled buckets
+        std::size_t m_Count;
+        //! Buckets
+        std::unique_ptr< boost::atomic< entry* >[] > m_Buckets;
+
+        explicit table(std::size_t size) : m_Mask(size - 1u), m_Count(0u), m_Buckets(new boost::atomic< entry* >[size])
+        {
+            for (std::size_t i = 0u; i < size; ++i)
+                m_Buckets[i].store(NULL, boost::memory_order_relaxed);
+        }
+
+        //! Looks up a logger holder
+        entry* find(std::size_t hash, typeindex::type_index key) const
+        {
+            for (std::size_t pos = hash & m_Mask; true; pos = (pos + 1u) & m_Mask)
+            {
+                entry* const e = m_Buckets[pos].load(boost::memory_order_acquire);
+                if (!e)
+                    return NULL;
+                if (e->m_Hash == hash && e->m_Key == key)
+                    return e;
+            }
+        }
+
+        //! Adds a logger holder. Must be called with the repository mutex locked.
+        void insert(entry* e)
+        {
+            std::size_t pos = e->m_Hash & m_Mask;
+            while (m_Buckets[pos].load(boost::memory_order_relaxed) != NULL)
+                pos = (pos + 1u) & m_Mask;
+
+            m_Buckets[pos].store(e, boost::memory_order_release);
+            ++m_Count;
+        }
+    };
 
 #if !defined(BOOST_LOG_NO_THREADS)
-    //! Synchronization primitive
+    //! Synchronization primitive for adding loggers
     mutable std::mutex m_Mutex;
 #endif
-    //! Map of logger holders
-    loggers_map_t m_Loggers;
+    //! The current hash table of logger holders
+    boost::atomic< table* > m_Table;
+    //! All hash tables, including the current one
+    std::vector< std::unique_ptr< table > > m_Tables;
+    //! All logger holders
+    std::vector< std::unique_ptr< entry > > m_Entries;
+
+    loggers_repository()
+    {
+        m_Tables.push_back(std::unique_ptr< table >(new table(16u)));
+        m_Table.store(m_Tables.back().get(), boost::memory_order_release);
+    }
+
+    //! Looks up a logger holder, can be called concurrently with adding loggers
+    entry* find(std::size_t hash, typeindex::type_index key) const
+    {
+        return m_Table.load(boost::memory_order_acquire)->find(hash, key);
+    }
+
+    //! Adds a logger holder. Must be called with the mutex locked.
+    entry* insert(std::size_t hash, typeindex::type_index key, shared_ptr< logger_holder_base > const& holder)
+    {
+        m_Entries.reserve(m_Entries.size() + 1u);
+        std::unique_ptr< entry > new_entry(new entry(hash, key, holder));
+        entry* const e = new_entry.get();
+
+        table* tab = m_Table.load(boost::memory_order_relaxed);
+        // Keep the load factor not greater than 1/2
+        if ((tab->m_Count + 1u) * 2u > tab->m_Mask + 1u)
+        {
+            m_Tables.reserve(m_Tables.size() + 1u);
+            std::unique_ptr< table > new_table(new table((tab->m_Mask + 1u) * 2u));
+            for (std::size_t i = 0u, n = m_Entries.size(); i < n; ++i)
+                new_table->insert(m_Entries[i].get());
+            new_table->insert(e);
+
+            tab = new_table.get();
+            m_Tables.push_back(std::move(new_table));
+            m_Table.store(tab, boost::memory_order_release);
+        }
+        else
+        {
+            tab->insert(e);
+        }
+
+        m_Entries.push_back(std::move(new_entry));
+        return e;
+    }
 };
 
 } // namespace
@@ -57,23 +165,23 @@ struct loggers_repository :
 //! Finds or creates the logger and returns its holder
 BOOST_LOG_API shared_ptr< logger_holder_base > global_storage::get_or_init(typeindex::type_index key, initializer_t initializer)
 {
-    typedef loggers_repository::loggers_map_t loggers_map_t;
     loggers_repository& repo = loggers_repository::get();
+    const std::size_t hash = key.hash_code();
+
+    // Most of the time the logger is already registered by another module, so look it up without locking first
+    loggers_repository::entry* e = repo.find(hash, key);
+    if (BOOST_LIKELY(e != NULL))
+        return e->m_Holder;
 
     BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(repo.m_Mutex);)
-    loggers_map_t::iterator it = repo.m_Loggers.find(key);
-    if (it != repo.m_Loggers.end())
-    {
-        // There is an instance
-        return it->second;
-    }
-    else
+    e = repo.find(hash, key);
+    if (!e)
     {
         // We have to create a logger instance
-        shared_ptr< logger_holder_base > inst = initializer();
-        repo.m_Loggers[key] = inst;
-        return inst;
+        e = repo.insert(hash, key, initializer());
     }
+
+    return e->m_Holder;
 }
 
 //! Throws the \c odr_violation exception
@@ -0,0 +1,115 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   json_escape.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <cstddef>
+#include <cstring>
+#if !defined(BOOST_NO_CXX17_HDR_CHARCONV)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define BOOST_LOG_HAS_FLOATING_POINT_TO_CHARS
+#endif
+#endif
+#if !defined(BOOST_LOG_HAS_FLOATING_POINT_TO_CHARS)
+#include <string>
+#include <locale>
+#include <sstream>
+#endif
+#include <boost/assert.hpp>
+#include <boost/log/expressions/formatters/json.hpp>
+#if defined(BOOST_LOG_USE_SSSE3) || defined(BOOST_LOG_USE_AVX2)
+#include "x86_cpu_features.hpp"
+#endif
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+#if defined(BOOST_LOG_USE_SSSE3)
+extern find_json_escape_char_t find_json_escape_char_ssse3;
+#endif
+#if defined(BOOST_LOG_USE_AVX2)
+extern find_json_escape_char_t find_json_escape_char_avx2;
+#endif
+
+const char* find_json_escape_char_generic(const char* begin, const char* end)
+{
+    for (; begin != end; ++begin)
+    {
+        const unsigned char c = static_cast< unsigned char >(*begin);
+        if (c < 0x20u || c == static_cast< unsigned char >('"') || c == static_cast< unsigned char >('\\'))
+            break;
+    }
+
+    return begin;
+}
+
+BOOST_LOG_API find_json_escape_char_t* find_json_escape_char = &find_json_escape_char_generic;
+
+BOOST_LOG_API std::size_t format_json_floating_point(char* buf, long double value, int precision)
+{
+#if defined(BOOST_LOG_HAS_FLOATING_POINT_TO_CHARS)
+    const std::to_chars_result res = std::to_chars(buf, buf + json_floating_point_buffer_size, value, std::chars_format::general, precision);
+    BOOST_ASSERT(res.ec == std::errc());
+    return static_cast< std::size_t >(res.ptr - buf);
+#else
+    // Use the classic locale to always have a dot as the decimal separator and no digit grouping
+    std::ostringstream strm;
+    strm.imbue(std::locale::classic());
+    strm.precision(precision);
+    strm << value;
+    const std::string str = strm.str();
+    BOOST_ASSERT(str.size() <= json_floating_point_buffer_size);
+    std::memcpy(buf, str.data(), str.size());
+    return str.size();
+#endif
+}
+
+#if defined(BOOST_LOG_USE_SSSE3) || defined(BOOST_LOG_USE_AVX2)
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+struct function_pointer_initializer
+{
+    function_pointer_initializer()
+    {
+        const x86_cpu_features features;
+#if defined(BOOST_LOG_USE_SSSE3)
+        if (features.ssse3)
+            find_json_escape_char = &find_json_escape_char_ssse3;
+#endif
+#if defined(BOOST_LOG_USE_AVX2)
+        if (features.avx2)
+            find_json_escape_char = &find_json_escape_char_avx2;
+#endif
+    }
+};
+
+static function_pointer_initializer g_function_pointer_initializer;
+
+} // namespace
+
+#endif // defined(BOOST_LOG_USE_SSSE3) || defined(BOOST_LOG_USE_AVX2)
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -0,0 +1,106 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   json_escape_avx2.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+// NOTE: You should generally avoid including headers as much as possible here, because this file
+//       is compiled with special compiler options, and any included header may result in generation of
+//       unintended code with these options and violation of ODR.
+#include <boost/log/detail/config.hpp>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+extern const char* find_json_escape_char_generic(const char* begin, const char* end);
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+//! Returns the index of the least significant set bit in a non-zero mask
+BOOST_FORCEINLINE unsigned int find_first_set(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return static_cast< unsigned int >(__builtin_ctz(mask));
+#else
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast< unsigned int >(index);
+#endif
+}
+
+} // namespace
+
+const char* find_json_escape_char_avx2(const char* begin, const char* end)
+{
+    if ((end - begin) >= 32)
+    {
+        const __m256i mm_quote = _mm256_set1_epi8('"');
+        const __m256i mm_backslash = _mm256_set1_epi8('\\');
+        const __m256i mm_max_control = _mm256_set1_epi8(0x1F);
+
+        do
+        {
+            const __m256i mm_chars = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(begin));
+
+            // Control characters are those that are not greater than 0x1F when compared as unsigned
+            __m256i mm_mask = _mm256_cmpeq_epi8(_mm256_max_epu8(mm_chars, mm_max_control), mm_max_control);
+            mm_mask = _mm256_or_si256(mm_mask, _mm256_cmpeq_epi8(mm_chars, mm_quote));
+            mm_mask = _mm256_or_si256(mm_mask, _mm256_cmpeq_epi8(mm_chars, mm_backslash));
+
+            const unsigned int mask = static_cast< unsigned int >(_mm256_movemask_epi8(mm_mask));
+            if (mask != 0u)
+            {
+                _mm256_zeroupper();
+                return begin + find_first_set(mask);
+            }
+
+            begin += 32;
+        }
+        while ((end - begin) >= 32);
+
+        _mm256_zeroupper();
+    }
+
+    if ((end - begin) >= 16)
+    {
+        const __m128i mm_chars = _mm_loadu_si128(reinterpret_cast< const __m128i* >(begin));
+        const __m128i mm_max_control = _mm_set1_epi8(0x1F);
+
+        __m128i mm_mask = _mm_cmpeq_epi8(_mm_max_epu8(mm_chars, mm_max_control), mm_max_control);
+        mm_mask = _mm_or_si128(mm_mask, _mm_cmpeq_epi8(mm_chars, _mm_set1_epi8('"')));
+        mm_mask = _mm_or_si128(mm_mask, _mm_cmpeq_epi8(mm_chars, _mm_set1_epi8('\\')));
+
+        const unsigned int mask = static_cast< unsigned int >(_mm_movemask_epi8(mm_mask));
+        if (mask != 0u)
+            return begin + find_first_set(mask);
+
+        begin += 16;
+    }
+
+    return find_json_escape_char_generic(begin, end);
+}
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -0,0 +1,72 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   json_value.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header is the Boost.Log library implementation, see the library documentation
+ *         at http://www.boost.org/doc/libs/release/libs/log/doc/html/index.html.
+ */
+
+#include <boost/log/detail/config.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/expressions/formatters/json.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include "default_value_visitor.hpp"
+#include <boost/log/detail/header.hpp>
+
+namespace boost {
+
+BOOST_LOG_OPEN_NAMESPACE
+
+namespace aux {
+
+namespace {
+
+//! Writer of the values that are not represented with native JSON types, formats the values the same way as the default formatter
+struct json_default_output
+{
+    typedef void result_type;
+
+    template< typename CharT, typename T >
+    result_type operator() (basic_formatting_ostream< CharT >& strm, T const& value) const
+    {
+        default_value_visitor< CharT > visitor(strm);
+        visitor(value);
+    }
+};
+
+} // namespace
+
+template< typename CharT >
+BOOST_LOG_API void put_json_default_value(basic_formatting_ostream< CharT >& strm, attribute_value const& value)
+{
+    const json_default_output fallback = {};
+    expressions::aux::json_value_writer< CharT, json_default_output > writer(strm, fallback);
+    if (!boost::log::visit< default_formatter_value_types >(value, writer))
+    {
+        // The value type is not supported
+        strm.write("null", 4);
+    }
+}
+
+#if defined(BOOST_LOG_USE_CHAR)
+template BOOST_LOG_API void put_json_default_value< char >(basic_formatting_ostream< char >& strm, attribute_value const& value);
+#endif
+#if defined(BOOST_LOG_USE_WCHAR_T)
+template BOOST_LOG_API void put_json_default_value< wchar_t >(basic_formatting_ostream< wchar_t >& strm, attribute_value const& value);
+#endif
+
+} // namespace aux
+
+BOOST_LOG_CLOSE_NAMESPACE // namespace log
+
+} // namespace boost
+
+#include <boost/log/detail/footer.hpp>
@@ -17,8 +17,10 @@
 #include <memory>
 #include <utility>
 #include <algorithm>
+#include <boost/cstdint.hpp>
 #include <boost/type_index.hpp>
-#include <boost/optional/optional.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/log/attributes/attribute.hpp>
 #include <boost/log/attributes/attribute_value.hpp>
 #include <boost/log/attributes/named_scope.hpp>
@@ -49,7 +51,31 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         //! Const reference type
         typedef base_type::const_reference const_reference;
 
+    private:
+        //! The counter of modifications of the list
+        uint64_t m_Version;
+        //! The version of the list the snapshot was made of
+        uint64_t m_SnapshotVersion;
+        //! The thread-independent copy of the list, shared between the detached attribute values
+        shared_ptr< const base_type > m_Snapshot;
+
     public:
+        writeable_named_scope_list() : m_Version(0u), m_SnapshotVersion(0u)
+        {
+        }
+
+        //! The method returns a thread-independent copy of the list. The copy is only made if the list has changed since the previous call.
+        shared_ptr< const base_type > const& get_snapshot()
+        {
+            if (!m_Snapshot || m_SnapshotVersion != m_Version)
+            {
+                m_Snapshot = boost::make_shared< base_type >(static_cast< base_type const& >(*this));
+                m_SnapshotVersion = m_Version;
+            }
+
+            return m_Snapshot;
+        }
+
         //! The method pushes the scope to the back of the list
         BOOST_FORCEINLINE void push_back(const_reference entry) BOOST_NOEXCEPT
         {
@@ -62,6 +88,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
                     static_cast< const aux::named_scope_list_node* >(&entry));
 
             ++this->m_Size;
+            ++m_Version;
         }
         //! The method removes the top scope entry from the list
         BOOST_FORCEINLINE void pop_back() BOOST_NOEXCEPT
@@ -70,6 +97,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
             top->_m_pPrev->_m_pNext = top->_m_pNext;
             top->_m_pNext->_m_pPrev = top->_m_pPrev;
             --this->m_Size;
+            ++m_Version;
         }
     };
 
@@ -81,13 +109,15 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         typedef named_scope_list scope_stack;
 
         //! Pointer to the actual scope value
-        scope_stack* m_pValue;
+        scope_stack const* m_pValue;
+        //! Pointer to the thread-specific scope stack, if the value is not detached yet
+        writeable_named_scope_list* m_pThreadScopes;
         //! A thread-independent value
-        optional< scope_stack > m_DetachedValue;
+        shared_ptr< const scope_stack > m_DetachedValue;
 
     public:
         //! Constructor
-        explicit named_scope_value(scope_stack* p) : m_pValue(p) {}
+        explicit named_scope_value(writeable_named_scope_list* p) : m_pValue(p), m_pThreadScopes(p) {}
 
         //! The method dispatches the value to the given object. It returns true if the
         //! object was capable to consume the real attribute value type and false otherwise.
@@ -113,10 +143,12 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         //! in case of asynchronous logging). The value should ensure it properly owns all thread-specific data.
         intrusive_ptr< attribute_value::impl > detach_from_thread() BOOST_OVERRIDE
         {
-            if (!m_DetachedValue)
+            if (m_pThreadScopes)
             {
-                m_DetachedValue = *m_pValue;
-                m_pValue = m_DetachedValue.get_ptr();
+                // Records made within the same scope share the snapshot of the scope stack
+                m_DetachedValue = m_pThreadScopes->get_snapshot();
+                m_pValue = m_DetachedValue.get();
+                m_pThreadScopes = NULL;
             }
 
             return this;
@@ -23,11 +23,14 @@
 #include <boost/cstdint.hpp>
 #include <boost/move/core.hpp>
 #include <boost/move/utility_core.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/spirit/include/karma_uint.hpp>
 #include <boost/spirit/include/karma_generate.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/expressions/formatters/named_scope.hpp>
 #include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/detail/direct_mapped_cache.hpp>
 #include <boost/log/detail/header.hpp>
 
 namespace karma = boost::spirit::karma;
@@ -469,6 +472,111 @@ bool parse_function_name(const char*& begin, const char*& end, bool include_scop
     return false;
 }
 
+//! The cache of the results of parsing string literals in named scope entries
+/*!
+ * Scope names and file names of named scope entries are string literals with static storage duration,
+ * so the results of parsing them can be looked up by the literal address. The results are stored in
+ * a \c direct_mapped_cache, so that lookups never block. The literals that collide with an already
+ * cached literal are parsed every time.
+ */
+class literal_parse_cache
+{
+public:
+    //! The value that marks the literal that could not be parsed
+    static BOOST_CONSTEXPR_OR_CONST uint64_t not_parsed = ~static_cast< uint64_t >(0u);
+
+private:
+    //! Maximum number of cached literals
+    enum { capacity = 1024u };
+
+    //! Cached result
+    struct entry
+    {
+        //! Hash value of the literal address
+        std::size_t hash;
+        //! Literal
+        const char* literal;
+        //! Literal size
+        std::size_t size;
+        //! Parsing result
+        uint64_t result;
+
+        //! Frees the entry
+        static void destroy(entry* p) BOOST_NOEXCEPT
+        {
+            delete p;
+        }
+    };
+
+private:
+    boost::log::aux::direct_mapped_cache< entry > m_table;
+
+public:
+    literal_parse_cache() : m_table(capacity, capacity)
+    {
+    }
+
+    //! Looks up the result for the literal, returns \c true if the result is found
+    bool find(const char* literal, std::size_t size, uint64_t& result) const
+    {
+        entry const* const p = m_table.find(hash_literal(literal));
+        if (p != NULL && p->literal == literal && p->size == size)
+        {
+            result = p->result;
+            return true;
+        }
+
+        return false;
+    }
+
+    //! Stores the result for the literal, unless the cache is full or another literal is cached in its place
+    void store(const char* literal, std::size_t size, uint64_t result)
+    {
+        const std::size_t hash = hash_literal(literal);
+        if (!m_table.is_insertable(hash))
+            return;
+
+        entry* const p = new entry();
+        p->hash = hash;
+        p->literal = literal;
+        p->size = size;
+        p->result = result;
+        m_table.insert(p);
+    }
+
+    //! Packs a range within the literal into a cached result
+    static uint64_t make_result(std::size_t begin, std::size_t end) BOOST_NOEXCEPT
+    {
+        return (static_cast< uint64_t >(begin) << 32u) | static_cast< uint64_t >(end);
+    }
+    //! Returns the beginning of the range packed in the cached result
+    static std::size_t result_begin(uint64_t result) BOOST_NOEXCEPT
+    {
+        return static_cast< std::size_t >(result >> 32u);
+    }
+    //! Returns the end of the range packed in the cached result
+    static std::size_t result_end(uint64_t result) BOOST_NOEXCEPT
+    {
+        return static_cast< std::size_t >(result & 0xFFFFFFFFu);
+    }
+    //! Checks if the literal is small enough for the range to be packed in the cached result
+    static bool is_cacheable(std::size_t size) BOOST_NOEXCEPT
+    {
+        return size < 0xFFFFFFFFu;
+    }
+
+private:
+    //! Computes the hash value of the literal address
+    static std::size_t hash_literal(const char* literal) BOOST_NOEXCEPT
+    {
+        const uintptr_t addr = reinterpret_cast< uintptr_t >(literal);
+        return static_cast< std::size_t >((addr >> 3u) ^ (addr >> 13u));
+    }
+
+    BOOST_DELETED_FUNCTION(literal_parse_cache(literal_parse_cache const&))
+    BOOST_DELETED_FUNCTION(literal_parse_cache& operator= (literal_parse_cache const&))
+};
+
 template< typename CharT >
 class named_scope_formatter
 {
@@ -511,7 +619,7 @@ public:
     {
         typedef void result_type;
 
-        explicit function_name(bool include_scope) : m_include_scope(include_scope)
+        explicit function_name(bool include_scope) : m_include_scope(include_scope), m_cache(boost::make_shared< literal_parse_cache >())
         {
         }
 
@@ -519,11 +627,24 @@ public:
         {
             if (value.type == attributes::named_scope_entry::function)
             {
-                const char* begin = value.scope_name.c_str();
-                const char* end = begin + value.scope_name.size();
-                if (parse_function_name(begin, end, m_include_scope))
+                const char* const str = value.scope_name.c_str();
+                const std::size_t size = value.scope_name.size();
+                uint64_t result;
+                if (!m_cache->find(str, size, result))
                 {
-                    strm.write(begin, end - begin);
+                    const char* begin = str;
+                    const char* end = str + size;
+                    result = literal_parse_cache::not_parsed;
+                    if (parse_function_name(begin, end, m_include_scope))
+                        result = literal_parse_cache::make_result(begin - str, end - str);
+                    if (literal_parse_cache::is_cacheable(size))
+                        m_cache->store(str, size, result);
+                }
+
+                if (result != literal_parse_cache::not_parsed)
+                {
+                    const std::size_t begin = literal_parse_cache::result_begin(result);
+                    strm.write(str + begin, literal_parse_cache::result_end(result) - begin);
                     return;
                 }
             }
@@ -533,6 +654,8 @@ public:
 
     private:
         const bool m_include_scope;
+        //! Parsed function names, shared between copies of the formatter
+        boost::shared_ptr< literal_parse_cache > m_cache;
     };
 
     struct full_file_name
@@ -549,21 +672,42 @@ public:
     {
         typedef void result_type;
 
+        file_name() : m_cache(boost::make_shared< literal_parse_cache >())
+        {
+        }
+
         result_type operator() (stream_type& strm, value_type const& value) const
         {
-            std::size_t n = value.file_name.size(), i = n;
-            for (; i > 0; --i)
+            const char* const str = value.file_name.c_str();
+            const std::size_t n = value.file_name.size();
+            uint64_t result;
+            std::size_t i;
+            if (m_cache->find(str, n, result))
+            {
+                i = literal_parse_cache::result_begin(result);
+            }
+            else
             {
-                const char c = value.file_name[i - 1];
+                for (i = n; i > 0; --i)
+                {
+                    const char c = str[i - 1];
 #if defined(BOOST_WINDOWS)
-                if (c == '\\')
-                    break;
+                    if (c == '\\')
+                        break;
 #endif
-                if (c == '/')
-                    break;
+                    if (c == '/')
+                        break;
+                }
+
+                if (literal_parse_cache::is_cacheable(n))
+                    m_cache->store(str, n, literal_parse_cache::make_result(i, n));
             }
-            strm.write(value.file_name.c_str() + i, n - i);
+            strm.write(str + i, n - i);
         }
+
+    private:
+        //! Positions of file names in the full paths, shared between copies of the formatter
+        boost::shared_ptr< literal_parse_cache > m_cache;
     };
 
     struct line_number
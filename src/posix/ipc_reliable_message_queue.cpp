@@ -24,6 +24,7 @@
 #include <ctime>
 #include <new>
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <algorithm>
 #include <unistd.h>
@@ -40,6 +41,7 @@
 #include <boost/atomic/atomic.hpp>
 #include <boost/atomic/ipc_atomic.hpp>
 #include <boost/atomic/capabilities.hpp>
+#include <boost/atomic/fences.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/utility/ipc/reliable_message_queue.hpp>
@@ -74,8 +76,15 @@ private:
         // Element data alignment, in bytes
         enum { data_alignment = 32u };
 
+        //! Element size value that marks the unused blocks at the end of the queue storage. The element follows at the beginning of the storage.
+        static BOOST_CONSTEXPR_OR_CONST size_type padding_size = 0xFFFFFFFFu;
+        //! Element size value that marks the blocks of a cancelled reservation in one of the lock-free modes. The blocks are skipped by the reader.
+        static BOOST_CONSTEXPR_OR_CONST size_type cancelled_size = 0xFFFFFFFEu;
+
         //! Size of the element data, in bytes
         size_type m_size;
+        //! The number of blocks of a cancelled reservation, including the padding blocks
+        uint32_t m_cancelled_block_count;
 
         //! Returns the block header overhead, in bytes
         static BOOST_CONSTEXPR size_type get_header_overhead() BOOST_NOEXCEPT
@@ -94,7 +103,7 @@ private:
     struct header
     {
         // Increment this constant whenever you change the binary layout of the queue (apart from this header structure)
-        enum { abi_version = 0 };
+        enum { abi_version = 2 };
 
         // !!! Whenever you add/remove members in this structure, also modify get_abi_tag() function accordingly !!!
 
@@ -108,6 +117,8 @@ private:
         const uint32_t m_capacity;
         //! Size of an allocation block, in bytes.
         const size_type m_block_size;
+        //! Queue synchronization mode.
+        const uint32_t m_mode;
         //! Mutex for protecting queue data structures.
         boost::log::ipc::aux::interprocess_mutex m_mutex;
         //! Condition variable used to block readers when the queue is empty.
@@ -120,14 +131,51 @@ private:
         uint32_t m_put_pos;
         //! The current reading position (allocation block index).
         uint32_t m_get_pos;
-
-        header(uint32_t capacity, size_type block_size) :
+        //! The number of writers blocked on \c m_nonfull_queue.
+        uint32_t m_waiting_writers;
+
+        //! Padding to place the lock-free writer state in a separate cache line.
+        unsigned char m_lf_put_padding[BOOST_LOG_CPU_CACHE_LINE_SIZE];
+        //! The number of allocation blocks published by writers since the queue creation. Used in lock-free modes.
+        boost::ipc_atomic< uint64_t > m_lf_put_count;
+        //! The number of allocation blocks reserved by writers since the queue creation. Used in multi-producer mode.
+        boost::ipc_atomic< uint64_t > m_lf_reserve_count;
+        //! Non-zero if the reader may be blocked waiting for the queue to become non-empty. Used in lock-free modes.
+        boost::ipc_atomic< uint32_t > m_lf_reader_waiting;
+        //! Event counter that is incremented to wake up blocked readers. Used in lock-free modes.
+        boost::ipc_atomic< uint32_t > m_lf_nonempty_event;
+        //! Non-zero if writers may be blocked waiting for the preceding writers to publish their messages. Used in multi-producer mode.
+        boost::ipc_atomic< uint32_t > m_lf_publishers_waiting;
+        //! Event counter that is incremented to wake up the writers blocked waiting for the preceding writers. Used in multi-producer mode.
+        boost::ipc_atomic< uint32_t > m_lf_published_event;
+
+        //! Padding to place the lock-free reader state in a separate cache line.
+        unsigned char m_lf_get_padding[BOOST_LOG_CPU_CACHE_LINE_SIZE];
+        //! The number of allocation blocks released by the reader since the queue creation. Used in lock-free modes.
+        boost::ipc_atomic< uint64_t > m_lf_get_count;
+        //! Non-zero if writers may be blocked waiting for free space in the queue. Used in lock-free modes.
+        boost::ipc_atomic< uint32_t > m_lf_writers_waiting;
+        //! Event counter that is incremented to wake up blocked writers. Used in lock-free modes.
+        boost::ipc_atomic< uint32_t > m_lf_nonfull_event;
+
+        header(uint32_t capacity, size_type block_size, queue_mode mode) :
             m_abi_tag(get_abi_tag()),
             m_capacity(capacity),
             m_block_size(block_size),
+            m_mode(mode),
             m_size(0u),
             m_put_pos(0u),
-            m_get_pos(0u)
+            m_get_pos(0u),
+            m_waiting_writers(0u),
+            m_lf_put_count(0u),
+            m_lf_reserve_count(0u),
+            m_lf_reader_waiting(0u),
+            m_lf_nonempty_event(0u),
+            m_lf_publishers_waiting(0u),
+            m_lf_published_event(0u),
+            m_lf_get_count(0u),
+            m_lf_writers_waiting(0u),
+            m_lf_nonfull_event(0u)
         {
             // Must be initialized last. m_ref_count is zero-initialized initially.
             m_ref_count.opaque_add(1u, boost::memory_order_release);
@@ -159,12 +207,25 @@ private:
             BOOST_LOG_MIX_HEADER_MEMBER(m_ref_count);
             BOOST_LOG_MIX_HEADER_MEMBER(m_capacity);
             BOOST_LOG_MIX_HEADER_MEMBER(m_block_size);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_mode);
             BOOST_LOG_MIX_HEADER_MEMBER(m_mutex);
             BOOST_LOG_MIX_HEADER_MEMBER(m_nonempty_queue);
             BOOST_LOG_MIX_HEADER_MEMBER(m_nonfull_queue);
             BOOST_LOG_MIX_HEADER_MEMBER(m_size);
             BOOST_LOG_MIX_HEADER_MEMBER(m_put_pos);
             BOOST_LOG_MIX_HEADER_MEMBER(m_get_pos);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_waiting_writers);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_put_padding);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_put_count);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_reserve_count);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_reader_waiting);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_nonempty_event);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_publishers_waiting);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_published_event);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_get_padding);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_get_count);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_writers_waiting);
+            BOOST_LOG_MIX_HEADER_MEMBER(m_lf_nonfull_event);
 
 #undef BOOST_LOG_MIX_HEADER_MEMBER
 
@@ -180,6 +241,20 @@ private:
             return reinterpret_cast< block_header* >(p);
         }
 
+        /*!
+         * Returns the handoff state of the reservation starting at the specified allocation block. Used in multi-producer mode.
+         *
+         * The handoff states are stored in an array following the allocation blocks, one for each block, so that they are never
+         * overwritten by message contents.
+         */
+        boost::ipc_atomic< uint64_t >& get_handoff_state(uint32_t index) const BOOST_NOEXCEPT
+        {
+            BOOST_ASSERT(index < m_capacity);
+            unsigned char* p = const_cast< unsigned char* >(reinterpret_cast< const unsigned char* >(this)) + boost::alignment::align_up(sizeof(header), BOOST_LOG_CPU_CACHE_LINE_SIZE);
+            p += static_cast< std::size_t >(m_block_size) * static_cast< std::size_t >(m_capacity);
+            return reinterpret_cast< boost::ipc_atomic< uint64_t >* >(p)[index];
+        }
+
         BOOST_DELETED_FUNCTION(header(header const&))
         BOOST_DELETED_FUNCTION(header& operator=(header const&))
     };
@@ -191,6 +266,8 @@ private:
     boost::interprocess::mapped_region m_region;
     //! Queue overflow handling policy
     const overflow_policy m_overflow_policy;
+    //! Queue synchronization mode
+    queue_mode m_mode;
     //! The mask for selecting bits that constitute size values from 0 to (block_size - 1)
     size_type m_block_size_mask;
     //! The number of the bit set in block_size (i.e. log base 2 of block_size)
@@ -211,6 +288,10 @@ private:
     static BOOST_CONSTEXPR_OR_CONST unsigned int region_open_or_create_timeout = 60u;
     //! The number of short yields to perform during the shared memory creation/opening loop
     static BOOST_CONSTEXPR_OR_CONST unsigned int region_open_or_create_short_yield_loops = 64u;
+    //! Threshold of the number of loop iterations in \c lock_free_publish for using pause instructions while waiting for the preceding writers
+    static BOOST_CONSTEXPR_OR_CONST unsigned int publish_wait_loops_pause = 16u;
+    //! Threshold of the number of loop iterations in \c lock_free_publish for using \c short_yield while waiting for the preceding writers
+    static BOOST_CONSTEXPR_OR_CONST unsigned int publish_wait_loops_short_yield = 64u;
 
 public:
     //! The constructor creates a new shared memory segment
@@ -221,11 +302,13 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy,
-        permissions const& perms
+        permissions const& perms,
+        queue_mode mode
     ) :
         m_shared_memory(),
         m_region(),
         m_overflow_policy(oflow_policy),
+        m_mode(locking_mode),
         m_block_size_mask(0u),
         m_block_size_log2(0u),
         m_stop(false),
@@ -251,7 +334,7 @@ public:
             }
         }
 
-        create_region(capacity, block_size);
+        create_region(capacity, block_size, mode);
     }
 
     //! The constructor creates a new shared memory segment or opens the existing one
@@ -262,11 +345,13 @@ public:
         uint32_t capacity,
         size_type block_size,
         overflow_policy oflow_policy,
-        permissions const& perms
+        permissions const& perms,
+        queue_mode mode
     ) :
         m_shared_memory(),
         m_region(),
         m_overflow_policy(oflow_policy),
+        m_mode(locking_mode),
         m_block_size_mask(0u),
         m_block_size_log2(0u),
         m_stop(false),
@@ -338,7 +423,7 @@ public:
 
     done:
         if (created)
-            create_region(capacity, block_size);
+            create_region(capacity, block_size, mode);
         else
             adopt_region();
     }
@@ -353,6 +438,7 @@ public:
         m_shared_memory(),
         m_region(),
         m_overflow_policy(oflow_policy),
+        m_mode(locking_mode),
         m_block_size_mask(0u),
         m_block_size_log2(0u),
         m_stop(false),
@@ -398,18 +484,40 @@ public:
         return get_header()->m_block_size;
     }
 
+    queue_mode mode() const BOOST_NOEXCEPT
+    {
+        return m_mode;
+    }
+
+    //! Returns \c true if the queue mode is supported on the current platform
+    static bool is_mode_supported(uint32_t mode) BOOST_NOEXCEPT
+    {
+        // Lock-free modes rely on 64-bit counters that never wrap and therefore are not prone to ABA problem
+        return mode == locking_mode || (mode <= multi_producer_mode && boost::ipc_atomic< uint64_t >::is_always_lock_free);
+    }
+
     operation_result send(void const* message_data, size_type message_size)
     {
-        const uint32_t block_count = estimate_block_count(message_size);
+        const uint32_t block_count = get_block_count(message_size);
 
         header* const hdr = get_header();
 
-        if (BOOST_UNLIKELY(block_count > hdr->m_capacity))
-            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
-
         if (m_stop.load(boost::memory_order_relaxed))
             return aborted;
 
+        if (m_mode != locking_mode)
+        {
+            uint64_t pos = 0u;
+            const operation_result res = lock_free_reserve(block_count, false, m_overflow_policy, pos);
+            if (res == succeeded)
+            {
+                write_message(static_cast< uint32_t >(pos % hdr->m_capacity), message_data, message_size);
+                if (!lock_free_publish(pos, block_count))
+                    return aborted;
+            }
+            return res;
+        }
+
         lock_queue();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
 
@@ -427,7 +535,9 @@ public:
             else if (BOOST_UNLIKELY(oflow_policy == throw_on_overflow))
                 BOOST_LOG_THROW_DESCR(capacity_limit_reached, "Interprocess queue is full");
 
+            ++hdr->m_waiting_writers;
             hdr->m_nonfull_queue.wait(hdr->m_mutex);
+            --hdr->m_waiting_writers;
         }
 
         enqueue_message(message_data, message_size, block_count);
@@ -437,16 +547,22 @@ public:
 
     bool try_send(void const* message_data, size_type message_size)
     {
-        const uint32_t block_count = estimate_block_count(message_size);
+        const uint32_t block_count = get_block_count(message_size);
 
         header* const hdr = get_header();
 
-        if (BOOST_UNLIKELY(block_count > hdr->m_capacity))
-            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
-
         if (m_stop.load(boost::memory_order_relaxed))
             return false;
 
+        if (m_mode != locking_mode)
+        {
+            uint64_t pos = 0u;
+            if (lock_free_reserve(block_count, false, fail_on_overflow, pos) != succeeded)
+                return false;
+            write_message(static_cast< uint32_t >(pos % hdr->m_capacity), message_data, message_size);
+            return lock_free_publish(pos, block_count);
+        }
+
         lock_queue();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
 
@@ -461,11 +577,91 @@ public:
         return true;
     }
 
+    void* try_reserve(size_type message_size, uint64_t& pos, uint32_t& reserved_block_count)
+    {
+        const uint32_t block_count = get_block_count(message_size);
+
+        header* const hdr = get_header();
+
+        if (m_stop.load(boost::memory_order_relaxed))
+            return NULL;
+
+        if (m_mode != locking_mode)
+        {
+            while (true)
+            {
+                if (lock_free_reserve(block_count, true, fail_on_overflow, pos) != succeeded)
+                    return NULL;
+
+                const uint32_t index = static_cast< uint32_t >(pos % hdr->m_capacity);
+                const uint32_t padding_block_count = get_padding_block_count(index, block_count);
+                if (BOOST_LIKELY(padding_block_count + block_count <= hdr->m_capacity))
+                {
+                    reserved_block_count = padding_block_count + block_count;
+                    return prepare_reservation(index, message_size);
+                }
+
+                // Only the padding blocks were reserved because the message can only be stored at the beginning of the storage.
+                // Skip them and try again, the message will fit once the reader releases the rest of the storage.
+                if (!lock_free_cancel(pos, padding_block_count))
+                    return NULL;
+            }
+        }
+
+        // The queue remains locked until commit() or cancel() is called
+        lock_queue();
+
+        uint32_t index = hdr->m_put_pos;
+        uint32_t total_block_count = get_padding_block_count(index, block_count) + block_count;
+        if (BOOST_UNLIKELY(total_block_count > hdr->m_capacity) && hdr->m_size == 0u)
+        {
+            // The message can only be stored at the beginning of the storage, which is possible when the queue is empty
+            hdr->m_put_pos = hdr->m_get_pos = index = 0u;
+            total_block_count = block_count;
+        }
+
+        if (m_stop.load(boost::memory_order_relaxed) || (hdr->m_capacity - hdr->m_size) < total_block_count)
+        {
+            hdr->m_mutex.unlock();
+            return NULL;
+        }
+
+        pos = index;
+        reserved_block_count = total_block_count;
+        return prepare_reservation(index, message_size);
+    }
+
+    operation_result commit(uint64_t pos, uint32_t block_count)
+    {
+        if (m_mode != locking_mode)
+            return lock_free_publish(pos, block_count) ? succeeded : aborted;
+
+        header* const hdr = get_header();
+        boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
+        publish_blocks(block_count);
+        return succeeded;
+    }
+
+    void cancel(uint64_t pos, uint32_t block_count)
+    {
+        if (m_mode != locking_mode)
+        {
+            lock_free_cancel(pos, block_count);
+            return;
+        }
+
+        // The reserved blocks are not published, so just unlock the queue
+        get_header()->m_mutex.unlock();
+    }
+
     operation_result receive(receive_handler handler, void* state)
     {
         if (m_stop.load(boost::memory_order_relaxed))
             return aborted;
 
+        if (m_mode != locking_mode)
+            return lock_free_receive(handler, state, true);
+
         lock_queue();
         header* const hdr = get_header();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
@@ -486,11 +682,58 @@ public:
         return succeeded;
     }
 
+    operation_result receive_batch(receive_handler handler, void* state, uint32_t max_messages, bool blocking)
+    {
+        BOOST_ASSERT(max_messages > 0u);
+
+        if (m_stop.load(boost::memory_order_relaxed))
+            return aborted;
+
+        if (m_mode != locking_mode)
+            return lock_free_receive_batch(handler, state, max_messages, blocking);
+
+        lock_queue();
+        header* const hdr = get_header();
+        boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
+
+        while (true)
+        {
+            if (m_stop.load(boost::memory_order_relaxed))
+                return aborted;
+
+            if (hdr->m_size > 0u)
+                break;
+
+            if (!blocking)
+                return no_space;
+
+            hdr->m_nonempty_queue.wait(hdr->m_mutex);
+        }
+
+        uint32_t block_count = 0u;
+        try
+        {
+            read_messages(hdr->m_get_pos, hdr->m_size, max_messages, handler, state, block_count);
+        }
+        catch (...)
+        {
+            release_blocks(block_count);
+            throw;
+        }
+
+        release_blocks(block_count);
+
+        return succeeded;
+    }
+
     bool try_receive(receive_handler handler, void* state)
     {
         if (m_stop.load(boost::memory_order_relaxed))
             return false;
 
+        if (m_mode != locking_mode)
+            return lock_free_receive(handler, state, false) == succeeded;
+
         lock_queue();
         header* const hdr = get_header();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
@@ -508,8 +751,22 @@ public:
         if (m_stop.load(boost::memory_order_relaxed))
             return;
 
-        lock_queue();
         header* const hdr = get_header();
+        if (m_mode != locking_mode)
+        {
+            m_stop.store(true, boost::memory_order_relaxed);
+
+            // Blocked threads in other processes will also wake up, but they will find the queue state unchanged and block again
+            hdr->m_lf_nonempty_event.opaque_add(1u, boost::memory_order_release);
+            hdr->m_lf_nonempty_event.notify_all();
+            hdr->m_lf_nonfull_event.opaque_add(1u, boost::memory_order_release);
+            hdr->m_lf_nonfull_event.notify_all();
+            hdr->m_lf_published_event.opaque_add(1u, boost::memory_order_release);
+            hdr->m_lf_published_event.notify_all();
+            return;
+        }
+
+        lock_queue();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
 
         m_stop.store(true, boost::memory_order_relaxed);
@@ -525,8 +782,16 @@ public:
 
     void clear()
     {
-        lock_queue();
         header* const hdr = get_header();
+        if (m_mode != locking_mode)
+        {
+            // Only the reader is allowed to advance the reading position, so we don't need to synchronize with writers
+            hdr->m_lf_get_count.store(hdr->m_lf_put_count.load(boost::memory_order_acquire), boost::memory_order_release);
+            notify_lock_free_writers();
+            return;
+        }
+
+        lock_queue();
         boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(hdr->m_mutex);
         clear_queue();
     }
@@ -539,18 +804,19 @@ private:
 
     static std::size_t estimate_region_size(uint32_t capacity, size_type block_size) BOOST_NOEXCEPT
     {
-        return boost::alignment::align_up(sizeof(header), BOOST_LOG_CPU_CACHE_LINE_SIZE) + static_cast< std::size_t >(capacity) * static_cast< std::size_t >(block_size);
+        return boost::alignment::align_up(sizeof(header), BOOST_LOG_CPU_CACHE_LINE_SIZE) + static_cast< std::size_t >(capacity) * (static_cast< std::size_t >(block_size) + sizeof(boost::ipc_atomic< uint64_t >));
     }
 
-    void create_region(uint32_t capacity, size_type block_size)
+    void create_region(uint32_t capacity, size_type block_size, queue_mode mode)
     {
         const std::size_t shmem_size = estimate_region_size(capacity, block_size);
         m_shared_memory.truncate(shmem_size);
         boost::interprocess::mapped_region(m_shared_memory, boost::interprocess::read_write, 0u, shmem_size).swap(m_region);
 
-        new (m_region.get_address()) header(capacity, block_size);
+        new (m_region.get_address()) header(capacity, block_size, mode);
 
         init_block_size(block_size);
+        m_mode = mode;
     }
 
     void adopt_region()
@@ -623,7 +889,14 @@ private:
             if (!boost::log::aux::is_power_of_2(hdr->m_block_size))
                 BOOST_LOG_THROW_DESCR(setup_error, "Boost.Log interprocess message queue cannot be opened: the queue block size is not a power of 2");
 
+            if (shmem_size < estimate_region_size(hdr->m_capacity, hdr->m_block_size))
+                BOOST_LOG_THROW_DESCR(setup_error, "Boost.Log interprocess message queue cannot be opened: shared memory segment size too small");
+
+            if (!is_mode_supported(hdr->m_mode))
+                BOOST_LOG_THROW_DESCR(setup_error, "Boost.Log interprocess message queue cannot be opened: the queue mode is not supported");
+
             init_block_size(hdr->m_block_size);
+            m_mode = static_cast< queue_mode >(hdr->m_mode);
         }
         catch (...)
         {
@@ -716,24 +989,57 @@ private:
         hdr->m_size = 0u;
         hdr->m_put_pos = 0u;
         hdr->m_get_pos = 0u;
-        hdr->m_nonfull_queue.notify_all();
+        if (hdr->m_waiting_writers > 0u)
+            hdr->m_nonfull_queue.notify_all();
     }
 
     //! Returns the number of allocation blocks that are required to store user's payload of the specified size
     uint32_t estimate_block_count(size_type size) const BOOST_NOEXCEPT
     {
         // ceil((size + get_header_overhead()) / block_size)
-        return static_cast< uint32_t >((size + block_header::get_header_overhead() + m_block_size_mask) >> m_block_size_log2);
+        return static_cast< uint32_t >((static_cast< uint64_t >(size) + block_header::get_header_overhead() + m_block_size_mask) >> m_block_size_log2);
     }
 
-    //! Puts the message to the back of the queue
-    void enqueue_message(void const* message_data, size_type message_size, uint32_t block_count)
+    //! Returns the number of allocation blocks that are required to store a message of the specified size. Throws if the message cannot be stored in the queue.
+    uint32_t get_block_count(size_type size) const
+    {
+        const uint32_t block_count = estimate_block_count(size);
+        if (BOOST_UNLIKELY(block_count > get_header()->m_capacity || size >= block_header::cancelled_size))
+            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
+        return block_count;
+    }
+
+    //! Returns the number of unused blocks that have to be skipped at the end of the queue storage to store a message contiguously starting at the specified block
+    uint32_t get_padding_block_count(uint32_t pos, uint32_t block_count) const BOOST_NOEXCEPT
+    {
+        const uint32_t tail_block_count = get_header()->m_capacity - pos;
+        return tail_block_count < block_count ? tail_block_count : 0u;
+    }
+
+    //! Writes the header of the message reserved starting at the specified block and returns the pointer to the message data
+    void* prepare_reservation(uint32_t pos, size_type message_size) const BOOST_NOEXCEPT
+    {
+        header* const hdr = get_header();
+
+        block_header* block = hdr->get_block(pos);
+        if (get_padding_block_count(pos, estimate_block_count(message_size)) > 0u)
+        {
+            // Mark the blocks at the end of the storage as unused and place the message at the beginning
+            block->m_size = block_header::padding_size;
+            block = hdr->get_block(0u);
+        }
+
+        block->m_size = message_size;
+        return block->get_data();
+    }
+
+    //! Copies the message to the queue storage, starting at the specified allocation block
+    void write_message(uint32_t pos, void const* message_data, size_type message_size) const BOOST_NOEXCEPT
     {
         header* const hdr = get_header();
 
         const uint32_t capacity = hdr->m_capacity;
         const size_type block_size = hdr->m_block_size;
-        uint32_t pos = hdr->m_put_pos;
         BOOST_ASSERT(pos < capacity);
 
         block_header* block = hdr->get_block(pos);
@@ -742,16 +1048,116 @@ private:
         size_type write_size = (std::min)(static_cast< size_type >((capacity - pos) * block_size - block_header::get_header_overhead()), message_size);
         std::memcpy(block->get_data(), message_data, write_size);
 
-        pos += block_count;
-        if (BOOST_UNLIKELY(pos >= capacity))
+        if (BOOST_UNLIKELY(write_size < message_size))
         {
             // Write the rest of the message at the beginning of the queue
-            pos -= capacity;
-            message_data = static_cast< const unsigned char* >(message_data) + write_size;
-            write_size = message_size - write_size;
-            if (write_size > 0u)
-                std::memcpy(hdr->get_block(0u), message_data, write_size);
+            std::memcpy(hdr->get_block(0u), static_cast< const unsigned char* >(message_data) + write_size, message_size - write_size);
+        }
+    }
+
+    //! Invokes the handler to store the message contents that start at the specified allocation block. Returns the number of blocks occupied by the message.
+    uint32_t read_message(uint32_t pos, receive_handler handler, void* state) const
+    {
+        header* const hdr = get_header();
+
+        const uint32_t capacity = hdr->m_capacity;
+        const size_type block_size = hdr->m_block_size;
+        BOOST_ASSERT(pos < capacity);
+
+        block_header* block = hdr->get_block(pos);
+        uint32_t padding_block_count = 0u;
+        if (BOOST_UNLIKELY(block->m_size == block_header::padding_size))
+        {
+            // The message was placed at the beginning of the storage by try_reserve
+            padding_block_count = capacity - pos;
+            pos = 0u;
+            block = hdr->get_block(0u);
+        }
+
+        size_type message_size = block->m_size;
+
+        size_type read_size = (std::min)(static_cast< size_type >((capacity - pos) * block_size - block_header::get_header_overhead()), message_size);
+        handler(state, block->get_data(), read_size);
+
+        if (BOOST_UNLIKELY(read_size < message_size))
+        {
+            // Read the tail of the message
+            handler(state, hdr->get_block(0u), message_size - read_size);
+        }
+
+        return padding_block_count + estimate_block_count(message_size);
+    }
+
+    //! Invokes the handler for up to \a max_messages messages that start at the specified allocation block and occupy up to \a available_block_count blocks.
+    //! Accumulates the number of blocks occupied by the messages for which the handler returned in \a block_count.
+    void read_messages(uint32_t pos, uint32_t available_block_count, uint32_t max_messages, receive_handler handler, void* state, uint32_t& block_count) const
+    {
+        header* const hdr = get_header();
+
+        const uint32_t capacity = hdr->m_capacity;
+        const size_type block_size = hdr->m_block_size;
+        BOOST_ASSERT(pos < capacity);
+
+        // Used to make the messages that wrap around the end of the queue storage contiguous
+        std::vector< unsigned char > buffer;
+        for (uint32_t i = 0u; i < max_messages && block_count < available_block_count;)
+        {
+            uint32_t index = pos + block_count;
+            if (index >= capacity)
+                index -= capacity;
+
+            block_header* block = hdr->get_block(index);
+            if (BOOST_UNLIKELY(block->m_size == block_header::cancelled_size))
+            {
+                // Cancelled reservations do not count as messages
+                block_count += block->m_cancelled_block_count;
+                continue;
+            }
+
+            uint32_t padding_block_count = 0u;
+            if (BOOST_UNLIKELY(block->m_size == block_header::padding_size))
+            {
+                padding_block_count = capacity - index;
+                index = 0u;
+                block = hdr->get_block(0u);
+            }
+
+            const size_type message_size = block->m_size;
+            const size_type read_size = (std::min)(static_cast< size_type >((capacity - index) * block_size - block_header::get_header_overhead()), message_size);
+            if (BOOST_LIKELY(read_size == message_size))
+            {
+                handler(state, block->get_data(), message_size);
+            }
+            else
+            {
+                const unsigned char* p = static_cast< const unsigned char* >(block->get_data());
+                buffer.assign(p, p + read_size);
+                p = reinterpret_cast< const unsigned char* >(hdr->get_block(0u));
+                buffer.insert(buffer.end(), p, p + (message_size - read_size));
+                handler(state, &buffer[0], message_size);
+            }
+
+            block_count += padding_block_count + estimate_block_count(message_size);
+            ++i;
         }
+    }
+
+    //! Puts the message to the back of the queue
+    void enqueue_message(void const* message_data, size_type message_size, uint32_t block_count)
+    {
+        write_message(get_header()->m_put_pos, message_data, message_size);
+        publish_blocks(block_count);
+    }
+
+    //! Makes the written blocks available to the reader
+    void publish_blocks(uint32_t block_count)
+    {
+        header* const hdr = get_header();
+
+        const uint32_t capacity = hdr->m_capacity;
+        uint32_t pos = hdr->m_put_pos + block_count;
+        if (BOOST_UNLIKELY(pos >= capacity))
+            pos -= capacity;
 
         hdr->m_put_pos = pos;
 
@@ -763,37 +1169,357 @@ private:
 
     //! Retrieves the next message and invokes the handler to store the message contents
     void dequeue_message(receive_handler handler, void* state)
+    {
+        const uint32_t block_count = read_message(get_header()->m_get_pos, handler, state);
+        release_blocks(block_count);
+    }
+
+    //! Releases the blocks that were read by the reader
+    void release_blocks(uint32_t block_count)
     {
         header* const hdr = get_header();
+        BOOST_ASSERT(block_count <= hdr->m_size);
+
+        if (block_count == 0u)
+            return;
 
         const uint32_t capacity = hdr->m_capacity;
-        const size_type block_size = hdr->m_block_size;
-        uint32_t pos = hdr->m_get_pos;
-        BOOST_ASSERT(pos < capacity);
+        uint32_t pos = hdr->m_get_pos + block_count;
+        if (BOOST_UNLIKELY(pos >= capacity))
+            pos -= capacity;
 
-        block_header* block = hdr->get_block(pos);
-        size_type message_size = block->m_size;
-        uint32_t block_count = estimate_block_count(message_size);
+        hdr->m_get_pos = pos;
+        hdr->m_size -= block_count;
 
-        BOOST_ASSERT(block_count <= hdr->m_size);
+        if (hdr->m_waiting_writers > 0u)
+            hdr->m_nonfull_queue.notify_all();
+    }
 
-        size_type read_size = (std::min)(static_cast< size_type >((capacity - pos) * block_size - block_header::get_header_overhead()), message_size);
-        handler(state, block->get_data(), read_size);
+    //! Reserves space for a message in one of the lock-free modes. If \a contiguous is \c true, the reserved space includes the padding blocks required to store the message contiguously.
+    operation_result lock_free_reserve(uint32_t block_count, bool contiguous, overflow_policy oflow_policy, uint64_t& pos)
+    {
+        header* const hdr = get_header();
+        const uint32_t capacity = hdr->m_capacity;
 
-        pos += block_count;
-        if (BOOST_UNLIKELY(pos >= capacity))
+        // In single producer mode the writer owns the published position. Otherwise writers compete for the reserved position and then publish their messages in the order of reservation.
+        boost::ipc_atomic< uint64_t >& reserve_count = m_mode == single_producer_mode ? hdr->m_lf_put_count : hdr->m_lf_reserve_count;
+
+        pos = reserve_count.load(boost::memory_order_relaxed);
+        while (true)
         {
-            // Read the tail of the message
-            pos -= capacity;
-            read_size = message_size - read_size;
-            if (read_size > 0u)
-                handler(state, hdr->get_block(0u), read_size);
+            const uint64_t used = pos - hdr->m_lf_get_count.load(boost::memory_order_acquire);
+            if (BOOST_UNLIKELY(used > capacity))
+            {
+                // The reserved position and the reading position were loaded at different points in time and are inconsistent
+                pos = reserve_count.load(boost::memory_order_relaxed);
+                continue;
+            }
+
+            uint32_t total_block_count = block_count;
+            if (contiguous)
+            {
+                const uint32_t padding_block_count = get_padding_block_count(static_cast< uint32_t >(pos % capacity), block_count);
+                total_block_count += padding_block_count;
+                // If the message does not fit in the storage after the padding blocks, only reserve the padding blocks so that the caller can skip them
+                if (BOOST_UNLIKELY(total_block_count > capacity))
+                    total_block_count = padding_block_count;
+            }
+
+            if ((capacity - static_cast< uint32_t >(used)) >= total_block_count)
+            {
+                if (m_mode == single_producer_mode || reserve_count.compare_exchange_weak(pos, pos + total_block_count, boost::memory_order_relaxed, boost::memory_order_relaxed))
+                    return succeeded;
+
+                continue;
+            }
+
+            if (oflow_policy == fail_on_overflow)
+                return no_space;
+            else if (BOOST_UNLIKELY(oflow_policy == throw_on_overflow))
+                BOOST_LOG_THROW_DESCR(capacity_limit_reached, "Interprocess queue is full");
+
+            // Register as a blocked writer and check the queue state again so that we don't miss the notification from the reader
+            const uint32_t event = prepare_lock_free_wait(hdr->m_lf_writers_waiting, hdr->m_lf_nonfull_event);
+            const uint64_t waiting_used = reserve_count.load(boost::memory_order_seq_cst) - hdr->m_lf_get_count.load(boost::memory_order_seq_cst);
+            if (!m_stop.load(boost::memory_order_relaxed) && waiting_used <= capacity && (capacity - static_cast< uint32_t >(waiting_used)) < total_block_count)
+                hdr->m_lf_nonfull_event.wait(event, boost::memory_order_acquire);
+
+            if (m_stop.load(boost::memory_order_relaxed))
+                return aborted;
+
+            pos = reserve_count.load(boost::memory_order_relaxed);
         }
+    }
 
-        hdr->m_get_pos = pos;
-        hdr->m_size -= block_count;
+    /*!
+     * Publishes the message written to the reserved space in one of the lock-free modes. Returns \c false if the wait for
+     * the preceding writers was interrupted by \c stop_local, in which case the message is not published.
+     *
+     * In multi-producer mode, the interrupted writer hands its reservation over to the preceding writers as a cancelled
+     * reservation, so that the writers that reserved space after it are not blocked. However, a writer that terminated
+     * after reserving space never publishes its message, so the writers that reserved space after it would wait forever.
+     * Such writers can only be released with \c stop_local, and the queue remains unusable for writing until it is recreated.
+     */
+    bool lock_free_publish(uint64_t pos, uint32_t block_count)
+    {
+        header* const hdr = get_header();
 
-        hdr->m_nonfull_queue.notify_all();
+        if (m_mode == multi_producer_mode)
+        {
+            // Wait until the writers that reserved space before us publish their messages
+            for (unsigned int i = 0u; hdr->m_lf_put_count.load(boost::memory_order_acquire) != pos; ++i)
+            {
+                if (m_stop.load(boost::memory_order_relaxed))
+                {
+                    lock_free_abandon(pos, block_count);
+                    return false;
+                }
+
+                if (i < publish_wait_loops_pause)
+                {
+                    boost::log::aux::pause();
+                }
+                else if (i < publish_wait_loops_short_yield)
+                {
+                    short_yield();
+                }
+                else
+                {
+                    const uint32_t event = prepare_lock_free_wait(hdr->m_lf_publishers_waiting, hdr->m_lf_published_event);
+                    if (!m_stop.load(boost::memory_order_relaxed) && hdr->m_lf_put_count.load(boost::memory_order_seq_cst) != pos)
+                        hdr->m_lf_published_event.wait(event, boost::memory_order_acquire);
+                }
+            }
+        }
+
+        lock_free_advance_put_count(pos + block_count);
+        return true;
+    }
+
+    //! Publishes the reserved space as a cancelled reservation that is skipped by the reader in one of the lock-free modes. Returns \c false if interrupted by \c stop_local.
+    bool lock_free_cancel(uint64_t pos, uint32_t block_count)
+    {
+        mark_cancelled(pos, block_count);
+        return lock_free_publish(pos, block_count);
+    }
+
+    //! Marks the reserved space as a cancelled reservation that is skipped by the reader
+    void mark_cancelled(uint64_t pos, uint32_t block_count) const BOOST_NOEXCEPT
+    {
+        block_header* const block = get_header()->get_block(static_cast< uint32_t >(pos % get_header()->m_capacity));
+        block->m_size = block_header::cancelled_size;
+        block->m_cancelled_block_count = block_count;
+    }
+
+    //! Returns the handoff state value indicating that the reservation at the specified position is abandoned by its writer
+    static uint64_t make_abandoned_handoff_state(uint64_t pos) BOOST_NOEXCEPT
+    {
+        return ((pos + 1u) << 1u) | 1u;
+    }
+
+    //! Returns the handoff state value indicating that the messages preceding the specified position have been published
+    static uint64_t make_reached_handoff_state(uint64_t pos) BOOST_NOEXCEPT
+    {
+        return (pos + 1u) << 1u;
+    }
+
+    /*!
+     * Hands the reservation over to the preceding writers in multi-producer mode, when the writer is interrupted by \c stop_local
+     * while waiting for them to publish their messages.
+     *
+     * The reservation is marked as cancelled and its handoff state is set to abandoned. The writer that publishes the preceding
+     * message then also publishes the abandoned reservation in \c lock_free_advance_put_count. If the preceding messages have
+     * been published in the meantime, the handoff state indicates that, and the reservation is published by this writer.
+     * Exchanging the handoff state guarantees that exactly one of the writers publishes the reservation.
+     */
+    void lock_free_abandon(uint64_t pos, uint32_t block_count)
+    {
+        header* const hdr = get_header();
+
+        mark_cancelled(pos, block_count);
+        const uint64_t state = hdr->get_handoff_state(static_cast< uint32_t >(pos % hdr->m_capacity)).exchange(make_abandoned_handoff_state(pos), boost::memory_order_acq_rel);
+        if (state == make_reached_handoff_state(pos))
+            lock_free_advance_put_count(pos + block_count);
+    }
+
+    /*!
+     * Advances the published position to \a put_count, which must be the end of the reservation of the calling writer, and wakes
+     * up the blocked threads. In multi-producer mode, also publishes the following reservations that were abandoned by their writers.
+     */
+    void lock_free_advance_put_count(uint64_t put_count)
+    {
+        header* const hdr = get_header();
+
+        hdr->m_lf_put_count.store(put_count, boost::memory_order_release);
+
+        if (m_mode == multi_producer_mode)
+        {
+            while (true)
+            {
+                const uint32_t index = static_cast< uint32_t >(put_count % hdr->m_capacity);
+                const uint64_t state = hdr->get_handoff_state(index).exchange(make_reached_handoff_state(put_count), boost::memory_order_acq_rel);
+                if (BOOST_LIKELY(state != make_abandoned_handoff_state(put_count)))
+                    break;
+
+                put_count += hdr->get_block(index)->m_cancelled_block_count;
+                hdr->m_lf_put_count.store(put_count, boost::memory_order_release);
+            }
+        }
+
+        // The fence pairs with registering a blocked thread in prepare_lock_free_wait
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        notify_lock_free_event(hdr->m_lf_reader_waiting, hdr->m_lf_nonempty_event);
+        if (m_mode == multi_producer_mode)
+            notify_lock_free_event(hdr->m_lf_publishers_waiting, hdr->m_lf_published_event);
+    }
+
+    //! Returns the number of blocks to skip if the message at the specified allocation block is a cancelled reservation, or 0 otherwise
+    uint32_t get_cancelled_block_count(uint32_t pos) const BOOST_NOEXCEPT
+    {
+        block_header* const block = get_header()->get_block(pos);
+        return BOOST_UNLIKELY(block->m_size == block_header::cancelled_size) ? block->m_cancelled_block_count : 0u;
+    }
+
+    //! Skips the cancelled reservations at the reading position in one of the lock-free modes. Returns \c false if there are no messages left to read.
+    bool lock_free_skip_cancelled(uint64_t& get_count, uint64_t put_count)
+    {
+        header* const hdr = get_header();
+
+        uint64_t new_get_count = get_count;
+        while (new_get_count != put_count)
+        {
+            const uint32_t cancelled_block_count = get_cancelled_block_count(static_cast< uint32_t >(new_get_count % hdr->m_capacity));
+            if (BOOST_LIKELY(cancelled_block_count == 0u))
+                break;
+            new_get_count += cancelled_block_count;
+        }
+
+        if (new_get_count != get_count)
+        {
+            get_count = new_get_count;
+            hdr->m_lf_get_count.store(new_get_count, boost::memory_order_release);
+            notify_lock_free_writers();
+        }
+
+        return new_get_count != put_count;
+    }
+
+    //! Waits until the queue is not empty in one of the lock-free modes. Returns the number of published blocks or a result code if there are none.
+    operation_result lock_free_wait_nonempty(uint64_t get_count, bool blocking, uint64_t& put_count)
+    {
+        header* const hdr = get_header();
+
+        while ((put_count = hdr->m_lf_put_count.load(boost::memory_order_acquire)) == get_count)
+        {
+            if (!blocking)
+                return no_space;
+
+            // Register as a blocked reader and check the queue state again so that we don't miss the notification from writers
+            const uint32_t event = prepare_lock_free_wait(hdr->m_lf_reader_waiting, hdr->m_lf_nonempty_event);
+            if (!m_stop.load(boost::memory_order_relaxed) && hdr->m_lf_put_count.load(boost::memory_order_seq_cst) == get_count)
+                hdr->m_lf_nonempty_event.wait(event, boost::memory_order_acquire);
+
+            if (m_stop.load(boost::memory_order_relaxed))
+                return aborted;
+        }
+
+        return succeeded;
+    }
+
+    //! Retrieves the next message in one of the lock-free modes. Returns \c no_space if the queue is empty and \a blocking is \c false.
+    operation_result lock_free_receive(receive_handler handler, void* state, bool blocking)
+    {
+        header* const hdr = get_header();
+
+        // Only the reader modifies the reading position
+        uint64_t get_count = hdr->m_lf_get_count.load(boost::memory_order_relaxed);
+        uint64_t put_count = 0u;
+        do
+        {
+            const operation_result res = lock_free_wait_nonempty(get_count, blocking, put_count);
+            if (res != succeeded)
+                return res;
+        }
+        while (!lock_free_skip_cancelled(get_count, put_count));
+
+        const uint32_t block_count = read_message(static_cast< uint32_t >(get_count % hdr->m_capacity), handler, state);
+
+        hdr->m_lf_get_count.store(get_count + block_count, boost::memory_order_release);
+        notify_lock_free_writers();
+
+        return succeeded;
+    }
+
+    //! Retrieves multiple messages in one of the lock-free modes. Returns \c no_space if the queue is empty and \a blocking is \c false.
+    operation_result lock_free_receive_batch(receive_handler handler, void* state, uint32_t max_messages, bool blocking)
+    {
+        header* const hdr = get_header();
+
+        uint64_t get_count = hdr->m_lf_get_count.load(boost::memory_order_relaxed);
+        uint64_t put_count = 0u;
+        do
+        {
+            const operation_result res = lock_free_wait_nonempty(get_count, blocking, put_count);
+            if (res != succeeded)
+                return res;
+        }
+        while (!lock_free_skip_cancelled(get_count, put_count));
+
+        uint32_t block_count = 0u;
+        try
+        {
+            read_messages(static_cast< uint32_t >(get_count % hdr->m_capacity), static_cast< uint32_t >(put_count - get_count), max_messages, handler, state, block_count);
+        }
+        catch (...)
+        {
+            if (block_count > 0u)
+            {
+                hdr->m_lf_get_count.store(get_count + block_count, boost::memory_order_release);
+                notify_lock_free_writers();
+            }
+            throw;
+        }
+
+        hdr->m_lf_get_count.store(get_count + block_count, boost::memory_order_release);
+        notify_lock_free_writers();
+
+        return succeeded;
+    }
+
+    //! Wakes up blocked writers, if there are any, after blocks are released in one of the lock-free modes
+    void notify_lock_free_writers() BOOST_NOEXCEPT
+    {
+        header* const hdr = get_header();
+
+        // The fence pairs with registering a blocked writer in prepare_lock_free_wait
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        notify_lock_free_event(hdr->m_lf_writers_waiting, hdr->m_lf_nonfull_event);
+    }
+
+    /*!
+     * Registers the calling thread as blocked on the event in one of the lock-free modes and returns the current event value
+     * to wait on. The caller must check the awaited condition again before waiting so that it doesn't miss the notification.
+     * The waiting flag is reset by the thread that notifies the event.
+     */
+    static uint32_t prepare_lock_free_wait(boost::ipc_atomic< uint32_t >& waiting, boost::ipc_atomic< uint32_t >& event) BOOST_NOEXCEPT
+    {
+        const uint32_t value = event.load(boost::memory_order_acquire);
+        waiting.exchange(1u, boost::memory_order_seq_cst);
+        return value;
+    }
+
+    /*!
+     * Wakes up the threads blocked on the event in one of the lock-free modes, if there are any. Must be called after a \c seq_cst
+     * fence that follows the state change the blocked threads wait for. Resetting the waiting flag ensures that the threads are woken
+     * up once, rather than on every state change until they get scheduled to run.
+     */
+    static void notify_lock_free_event(boost::ipc_atomic< uint32_t >& waiting, boost::ipc_atomic< uint32_t >& event) BOOST_NOEXCEPT
+    {
+        if (waiting.load(boost::memory_order_relaxed) != 0u && waiting.exchange(0u, boost::memory_order_seq_cst) != 0u)
+        {
+            event.opaque_add(1u, boost::memory_order_release);
+            event.notify_all();
+        }
     }
 
     static void short_yield() BOOST_NOEXCEPT
@@ -820,14 +1546,16 @@ private:
     }
 };
 
-BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms)
+BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms, queue_mode mode)
 {
     BOOST_ASSERT(m_impl == NULL);
     if (!boost::log::aux::is_power_of_2(block_size))
         BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue block size is not a power of 2"));
+    if (!implementation::is_mode_supported(mode))
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue mode is not supported"));
     try
     {
-        m_impl = new implementation(open_mode::create_only, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms);
+        m_impl = new implementation(open_mode::create_only, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms, mode);
     }
     catch (boost::exception& e)
     {
@@ -840,14 +1568,16 @@ BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint3
     }
 }
 
-BOOST_LOG_API void reliable_message_queue::open_or_create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms)
+BOOST_LOG_API void reliable_message_queue::open_or_create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms, queue_mode mode)
 {
     BOOST_ASSERT(m_impl == NULL);
     if (!boost::log::aux::is_power_of_2(block_size))
         BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue block size is not a power of 2"));
+    if (!implementation::is_mode_supported(mode))
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue mode is not supported"));
     try
     {
-        m_impl = new implementation(open_mode::open_or_create, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms);
+        m_impl = new implementation(open_mode::open_or_create, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms, mode);
     }
     catch (boost::exception& e)
     {
@@ -910,6 +1640,12 @@ BOOST_LOG_API reliable_message_queue::size_type reliable_message_queue::block_si
     return m_impl->block_size();
 }
 
+BOOST_LOG_API reliable_message_queue::queue_mode reliable_message_queue::mode() const
+{
+    BOOST_ASSERT(m_impl != NULL);
+    return m_impl->mode();
+}
+
 BOOST_LOG_API void reliable_message_queue::stop_local()
 {
     BOOST_ASSERT(m_impl != NULL);
@@ -972,6 +1708,60 @@ BOOST_LOG_API bool reliable_message_queue::try_send(void const* message_data, si
     }
 }
 
+BOOST_LOG_API bool reliable_message_queue::try_reserve(size_type message_size, reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data == NULL);
+    try
+    {
+        void* p = m_impl->try_reserve(message_size, res.m_pos, res.m_block_count);
+        if (!p)
+            return false;
+
+        res.m_data = p;
+        res.m_size = message_size;
+        return true;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::commit(reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data != NULL);
+    try
+    {
+        const operation_result result = m_impl->commit(res.m_pos, res.m_block_count);
+        res = reservation();
+        return result;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API void reliable_message_queue::cancel(reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data != NULL);
+    try
+    {
+        m_impl->cancel(res.m_pos, res.m_block_count);
+        res = reservation();
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
 BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::do_receive(receive_handler handler, void* state)
 {
     BOOST_ASSERT(m_impl != NULL);
@@ -1000,6 +1790,34 @@ BOOST_LOG_API bool reliable_message_queue::do_try_receive(receive_handler handle
     }
 }
 
+BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::do_receive_batch(receive_handler handler, void* state, uint32_t max_messages)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    try
+    {
+        return m_impl->receive_batch(handler, state, max_messages, true);
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API bool reliable_message_queue::do_try_receive_batch(receive_handler handler, void* state, uint32_t max_messages)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    try
+    {
+        return m_impl->receive_batch(handler, state, max_messages, false) == succeeded;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
 //! Fixed buffer receive handler
 BOOST_LOG_API void reliable_message_queue::fixed_buffer_receive_handler(void* state, const void* data, size_type size)
 {
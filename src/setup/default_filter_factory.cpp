@@ -17,12 +17,15 @@
 
 #include <boost/log/detail/setup_config.hpp>
 #include <string>
+#include <algorithm>
 #include <boost/mpl/vector.hpp>
 #include <boost/preprocessor/seq/enum.hpp>
 #include <boost/spirit/include/qi_core.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/expressions/predicates/has_attr.hpp>
+#include <boost/log/expressions/predicates/hierarchical_channel_severity_filter.hpp>
+#include <boost/log/attributes/value_visitation.hpp>
 #include <boost/log/utility/type_dispatch/standard_types.hpp>
 #include <boost/log/utility/string_literal.hpp>
 #include <boost/log/utility/functional/logical.hpp>
@@ -219,6 +222,153 @@ typedef mpl::vector<
     BOOST_PP_SEQ_ENUM(BOOST_LOG_STANDARD_FLOATING_POINT_TYPES()BOOST_LOG_STANDARD_STRING_TYPES())
 > floating_point_and_string_types;
 
+//! The filter checks severity levels against the thresholds for hierarchical channels. Severity levels of integral types and \c trivial::severity_level are compared as integers.
+class channel_thresholds_filter
+{
+public:
+    typedef bool result_type;
+
+private:
+    typedef expressions::hierarchical_channel_severity_filter_terminal< std::string, long > thresholds_type;
+    typedef mpl::vector<
+        boost::log::trivial::severity_level, BOOST_PP_SEQ_ENUM(BOOST_LOG_STANDARD_INTEGRAL_TYPES())
+    > severity_types;
+
+    //! Severity level visitor
+    struct severity_visitor
+    {
+        typedef void result_type;
+
+        severity_visitor(long threshold, bool& res) : m_threshold(threshold), m_res(res)
+        {
+        }
+
+        result_type operator() (boost::log::trivial::severity_level severity) const
+        {
+            m_res = static_cast< long >(severity) >= m_threshold;
+        }
+
+        template< typename T >
+        result_type operator() (T const& severity) const
+        {
+            m_res = greater_equal()(severity, m_threshold);
+        }
+
+    private:
+        const long m_threshold;
+        bool& m_res;
+    };
+
+    //! Channel visitor
+    struct channel_visitor
+    {
+        typedef void result_type;
+
+        channel_visitor(channel_thresholds_filter const& self, attribute_value_set const& values, bool& res) : m_self(self), m_values(values), m_res(res)
+        {
+        }
+
+        result_type operator() (std::string const& channel) const
+        {
+            long const* const threshold = m_self.m_thresholds.find_threshold(channel);
+            if (threshold)
+                boost::log::visit< severity_types >(m_self.m_severity_name, m_values, severity_visitor(*threshold, m_res));
+        }
+
+    private:
+        channel_thresholds_filter const& m_self;
+        attribute_value_set const& m_values;
+        bool& m_res;
+    };
+
+private:
+    attribute_name m_channel_name;
+    attribute_name m_severity_name;
+    thresholds_type m_thresholds;
+
+public:
+    channel_thresholds_filter(attribute_name const& channel_name, attribute_name const& severity_name) :
+        m_channel_name(channel_name),
+        m_severity_name(severity_name),
+        m_thresholds(channel_name, severity_name)
+    {
+    }
+
+    //! Adds a new rule for the channel and its descendants
+    void add(std::string const& channel, long threshold)
+    {
+        m_thresholds.add(channel, threshold);
+    }
+
+    result_type operator() (attribute_value_set const& values) const
+    {
+        bool res = false;
+        boost::log::visit< std::string >(m_channel_name, values, channel_visitor(*this, values, res));
+        return res;
+    }
+};
+
+/*!
+ * The function parses the list of channel severity thresholds and constructs the hierarchical channel severity filter.
+ * The list may be preceded by the severity attribute name in percent signs and a colon. The thresholds can be
+ * \c trivial::severity_level names or integers.
+ */
+template< typename CharT >
+filter parse_channel_thresholds(attribute_name const& name, std::basic_string< CharT > const& arg)
+{
+    typedef log::aux::char_constants< CharT > constants;
+
+    const CharT* p = constants::trim_spaces_left(arg.c_str(), arg.c_str() + arg.size());
+    const CharT* const end = arg.c_str() + arg.size();
+
+    attribute_name severity_name = boost::log::aux::default_attribute_names::severity();
+    if (p != end && *p == constants::char_percent)
+    {
+        const CharT* const name_end = std::find(p + 1, end, constants::char_percent);
+        const CharT* const colon = constants::trim_spaces_left(name_end == end ? end : name_end + 1, end);
+        if (name_end == end || name_end == p + 1 || colon == end || *colon != static_cast< CharT >(':'))
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid severity attribute name in the channel severity threshold specification: \"" + log::aux::to_narrow(arg) + "\"");
+
+        severity_name = attribute_name(log::aux::to_narrow(std::basic_string< CharT >(p + 1, name_end)));
+        p = colon + 1;
+    }
+
+    channel_thresholds_filter flt(name, severity_name);
+    while (true)
+    {
+        const CharT* const rule_end = std::find(p, end, constants::char_comma);
+        const CharT* const eq = std::find(p, rule_end, constants::char_equal);
+        if (eq == rule_end)
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid channel severity threshold specification: \"" + log::aux::to_narrow(std::basic_string< CharT >(p, rule_end)) + "\"");
+
+        const CharT* const channel_begin = constants::trim_spaces_left(p, eq);
+        const CharT* const channel_end = constants::trim_spaces_right(channel_begin, eq);
+        const CharT* const level_begin = constants::trim_spaces_left(eq + 1, rule_end);
+        const CharT* const level_end = constants::trim_spaces_right(level_begin, rule_end);
+
+        // The threshold is either a severity level name or an integer
+        long threshold = 0;
+        boost::log::trivial::severity_level lvl;
+        const CharT* level_it = level_begin;
+        if (boost::log::trivial::from_string(level_begin, static_cast< std::size_t >(level_end - level_begin), lvl))
+            threshold = static_cast< long >(lvl);
+        else if (!(qi::parse(level_it, level_end, qi::long_, threshold) && level_it == level_end))
+            BOOST_LOG_THROW_DESCR(parse_error, "Invalid severity level in the channel severity threshold specification: \"" + log::aux::to_narrow(std::basic_string< CharT >(level_begin, level_end)) + "\"");
+
+        // The asterisk denotes the threshold for all channels
+        std::basic_string< CharT > channel;
+        if (!(channel_end - channel_begin == 1 && *channel_begin == constants::char_asterisk))
+            channel.assign(channel_begin, channel_end);
+        flt.add(log::aux::to_narrow(channel), threshold);
+
+        if (rule_end == end)
+            break;
+        p = rule_end + 1;
+    }
+
+    return filter(flt);
+}
+
 } // namespace
 
 //! The callback for equality relation filter
@@ -284,6 +434,10 @@ filter default_filter_factory< CharT >::on_custom_relation(attribute_name const&
         typedef string_predicate< contains_fun > predicate;
         return predicate_wrapper< log::string_types, predicate >(name, predicate(contains_fun(), arg));
     }
+    else if (rel == constants::thresholds_keyword())
+    {
+        return parse_channel_thresholds(name, arg);
+    }
     else if (rel != constants::matches_keyword())
     {
         BOOST_LOG_THROW_DESCR(parse_error, "The custom attribute relation \"" + log::aux::to_narrow(rel) + "\" is not supported");
@@ -18,8 +18,22 @@
 
 #include <boost/log/detail/setup_config.hpp>
 #include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <boost/atomic/atomic.hpp>
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/begin.hpp>
+#include <boost/mpl/end.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/is_sequence.hpp>
+#include <boost/type_index.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
-#include <boost/log/attributes/value_visitation.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/utility/type_dispatch/type_dispatcher.hpp>
+#include <boost/log/utility/type_dispatch/static_type_dispatcher.hpp>
 #include <boost/log/utility/setup/filter_parser.hpp>
 #include <boost/log/utility/functional/save_result.hpp>
 #include <boost/log/detail/header.hpp>
@@ -30,27 +44,114 @@ BOOST_LOG_OPEN_NAMESPACE
 
 namespace aux {
 
-//! Relation predicate wrapper
+/*!
+ * \brief Relation predicate wrapper
+ *
+ * The wrapper looks up the attribute value and passes it to the predicate, if the value has one of the types in \c ValueT.
+ * In filters, values of a given attribute almost always have the same type, so instead of looking the value type up
+ * in the list of the supported types on every call the wrapper remembers the last matched type and tries it first.
+ */
 template< typename ValueT, typename PredicateT >
-struct predicate_wrapper
+class predicate_wrapper
 {
+public:
     typedef typename PredicateT::result_type result_type;
 
-    explicit predicate_wrapper(attribute_name const& name, PredicateT const& pred) : m_name(name), m_visitor(pred)
+private:
+    //! The list of supported types
+    typedef typename mpl::eval_if<
+        mpl::is_sequence< ValueT >,
+        mpl::identity< ValueT >,
+        mpl::identity< mpl::vector1< ValueT > >
+    >::type value_types;
+    //! Predicate result receiver
+    typedef save_result_wrapper< PredicateT const&, bool > receiver_type;
+    //! Dispatching map element type
+    typedef std::pair< typeindex::type_index, void* > dispatching_map_element_type;
+
+    //! Number of entries in the dispatching map
+    static BOOST_CONSTEXPR_OR_CONST unsigned int dispatching_map_size = mpl::size< value_types >::value;
+
+    //! Type dispatcher that checks the cached type before the lookup
+    class dispatcher :
+        public type_dispatcher
+    {
+    private:
+        predicate_wrapper const& m_wrapper;
+        void* m_receiver;
+
+    public:
+        dispatcher(predicate_wrapper const& wrapper, receiver_type& receiver) BOOST_NOEXCEPT :
+            type_dispatcher(&dispatcher::get_callback),
+            m_wrapper(wrapper),
+            m_receiver((void*)boost::addressof(receiver))
+        {
+        }
+
+    private:
+        static callback_base get_callback(type_dispatcher* p, typeindex::type_index type)
+        {
+            dispatcher* const self = static_cast< dispatcher* >(p);
+            const dispatching_map_element_type* const map = self->m_wrapper.m_dispatching_map;
+
+            const unsigned int cached = self->m_wrapper.m_cached_index.load(boost::memory_order_relaxed);
+            if (BOOST_LIKELY(cached < dispatching_map_size && map[cached].first == type))
+                return callback_base(self->m_receiver, map[cached].second);
+
+            const dispatching_map_element_type* const end = map + dispatching_map_size;
+            const dispatching_map_element_type* it = std::lower_bound(map, end, dispatching_map_element_type(type, (void*)NULL), dispatching_map_order());
+            if (it != end && it->first == type)
+            {
+                self->m_wrapper.m_cached_index.store(static_cast< unsigned int >(it - map), boost::memory_order_relaxed);
+                return callback_base(self->m_receiver, it->second);
+            }
+
+            return callback_base();
+        }
+    };
+
+private:
+    attribute_name m_name;
+    const PredicateT m_visitor;
+    //! Sorted dispatching map of the supported types
+    dispatching_map_element_type m_dispatching_map[dispatching_map_size];
+    //! Index of the last matched type in the dispatching map, or \c dispatching_map_size if no type matched yet
+    mutable boost::atomic< unsigned int > m_cached_index;
+
+public:
+    explicit predicate_wrapper(attribute_name const& name, PredicateT const& pred) :
+        m_name(name),
+        m_visitor(pred),
+        m_cached_index(dispatching_map_size)
     {
+        typedef typename mpl::begin< value_types >::type begin_iterator_type;
+        typedef typename mpl::end< value_types >::type end_iterator_type;
+        dispatching_map_initializer< receiver_type >::init(static_cast< begin_iterator_type* >(0), static_cast< end_iterator_type* >(0), m_dispatching_map);
+        std::sort(m_dispatching_map, m_dispatching_map + dispatching_map_size, dispatching_map_order());
     }
 
-    template< typename T >
-    result_type operator() (T const& arg) const
+    predicate_wrapper(predicate_wrapper const& that) :
+        m_name(that.m_name),
+        m_visitor(that.m_visitor),
+        m_cached_index(that.m_cached_index.load(boost::memory_order_relaxed))
+    {
+        std::copy(that.m_dispatching_map, that.m_dispatching_map + dispatching_map_size, m_dispatching_map);
+    }
+
+    result_type operator() (attribute_value_set const& values) const
     {
         bool res = false;
-        boost::log::visit< ValueT >(m_name, arg, save_result_wrapper< PredicateT const&, bool >(m_visitor, res));
+        attribute_value_set::const_iterator it = values.find(m_name);
+        if (it != values.end())
+        {
+            receiver_type receiver(m_visitor, res);
+            dispatcher disp(*this, receiver);
+            it->second.dispatch(disp);
+        }
         return res;
     }
 
-private:
-    attribute_name m_name;
-    const PredicateT m_visitor;
+    BOOST_DELETED_FUNCTION(predicate_wrapper& operator= (predicate_wrapper const&))
 };
 
 //! The default filter factory that supports creating filters for the standard types (see utility/type_dispatch/standard_types.hpp)
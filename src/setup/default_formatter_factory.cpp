@@ -16,31 +16,19 @@
 #if !defined(BOOST_LOG_WITHOUT_SETTINGS_PARSERS) && !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
 
 #include <boost/log/detail/setup_config.hpp>
-#include <cstddef>
-#include <ctime>
-#include <boost/core/snprintf.hpp>
-#include <boost/mpl/vector.hpp>
-#include <boost/mpl/vector/vector40.hpp>
-#include <boost/preprocessor/cat.hpp>
-#include <boost/preprocessor/seq/enum.hpp>
-#include <boost/preprocessor/seq/size.hpp>
-#include <boost/date_time/special_defs.hpp>
-#include <boost/date_time/gregorian/gregorian_types.hpp>
-#include <boost/date_time/local_time/local_time_types.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
 #include <boost/log/attributes/value_visitation.hpp>
-#include <boost/log/utility/type_dispatch/standard_types.hpp>
-#include <boost/log/utility/type_dispatch/date_time_types.hpp>
-#include <boost/log/utility/string_literal.hpp>
 #include <boost/log/utility/formatting_ostream.hpp>
-#include <boost/log/detail/code_conversion.hpp>
 #include <boost/log/detail/process_id.hpp>
+#include <boost/log/detail/default_attribute_names.hpp>
 #if !defined(BOOST_LOG_NO_THREADS)
 #include <boost/log/detail/thread_id.hpp>
 #endif
-#include <boost/log/attributes/named_scope.hpp>
+#include "default_value_visitor.hpp"
 #include "default_formatter_factory.hpp"
 #include <boost/log/detail/header.hpp>
 
@@ -50,29 +38,22 @@ BOOST_LOG_OPEN_NAMESPACE
 
 namespace aux {
 
-#if !defined(BOOST_LOG_NO_THREADS)
-#define BOOST_LOG_AUX_THREAD_ID_TYPE() (boost::log::aux::thread::id)
-#else
-#define BOOST_LOG_AUX_THREAD_ID_TYPE()
-#endif
-
-#define BOOST_LOG_AUX_LOG_ATTRIBUTE_VALUE_TYPES()\
-    (boost::log::trivial::severity_level)\
-    (boost::log::attributes::named_scope_list)\
-    (boost::log::aux::process::id)\
-    BOOST_LOG_AUX_THREAD_ID_TYPE()
+BOOST_LOG_ANONYMOUS_NAMESPACE {
 
-// The list of the attribute value types supported by the default formatter. Note that we have to exclude std::time_t
-// as it is an integral type, as well as double from the native time duration types - these are part of arithmetic types already.
-#define BOOST_LOG_AUX_LOG_DEFAULT_VALUE_TYPES()\
-    BOOST_LOG_DEFAULT_ATTRIBUTE_VALUE_TYPES()\
-    (std::tm)\
-    BOOST_LOG_BOOST_DATE_TYPES()\
-    BOOST_LOG_BOOST_TIME_DURATION_TYPES()\
-    BOOST_LOG_BOOST_TIME_PERIOD_TYPES()\
-    BOOST_LOG_AUX_LOG_ATTRIBUTE_VALUE_TYPES()
+//! The generic attribute value writer, supports all value types the default formatter supports
+template< typename CharT >
+void write_value(attribute_value const& value, basic_formatting_ostream< CharT >& strm)
+{
+    value.visit< default_formatter_value_types >(default_value_visitor< CharT >(strm));
+}
 
-BOOST_LOG_ANONYMOUS_NAMESPACE {
+//! The attribute value writer that is specialized for the expected value type
+template< typename CharT, typename T >
+void write_typed_value(attribute_value const& value, basic_formatting_ostream< CharT >& strm)
+{
+    if (BOOST_UNLIKELY(!value.visit< T >(default_value_visitor< CharT >(strm))))
+        write_value< CharT >(value, strm);
+}
 
 //! The default formatter generated by the default formatter factory
 template< typename CharT >
@@ -82,181 +63,26 @@ public:
     typedef void result_type;
 
 private:
-    //! Attribute value visitor
-    struct visitor
-    {
-        typedef void result_type;
-
-        explicit visitor(basic_formatting_ostream< CharT >& strm) : m_strm(strm)
-        {
-        }
-
-        template< typename T >
-        void operator() (T const& value) const
-        {
-            m_strm << value;
-        }
-
-        void operator() (std::tm const& value) const
-        {
-            char buf[32];
-            std::size_t len = std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &value);
-            m_strm.write(buf, len);
-        }
-
-        void operator() (boost::posix_time::ptime const& value) const
-        {
-            if (!value.is_special())
-            {
-                std::tm t = boost::posix_time::to_tm(value);
-                char buf[32];
-                std::size_t len = std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &t);
-                std::size_t size = sizeof(buf) - len;
-                int res = boost::core::snprintf(buf + len, size, ".%.6u", static_cast< unsigned int >(value.time_of_day().total_microseconds() % 1000000));
-                if (BOOST_UNLIKELY(res < 0))
-                    buf[len] = '\0';
-                else if (static_cast< std::size_t >(res) >= size)
-                    len += size - 1;
-                else
-                    len += res;
-
-                m_strm.write(buf, len);
-            }
-            else
-            {
-                format_special_date_time(value);
-            }
-        }
-
-        void operator() (boost::local_time::local_date_time const& value) const
-        {
-            if (!value.is_special())
-            {
-                this->operator()(value.local_time());
-                m_strm << ' ' << value.zone_as_posix_string();
-            }
-            else
-            {
-                format_special_date_time(value);
-            }
-        }
-
-        void operator() (boost::gregorian::date const& value) const
-        {
-            if (!value.is_special())
-            {
-                std::tm t = boost::gregorian::to_tm(value);
-                char buf[32];
-                std::size_t len = std::strftime(buf, sizeof(buf), "%Y-%m-%d", &t);
-                m_strm.write(buf, len);
-            }
-            else
-            {
-                format_special_date_time(value.as_special());
-            }
-        }
-
-        void operator() (boost::posix_time::time_duration const& value) const
-        {
-            if (!value.is_special())
-            {
-                boost::posix_time::time_duration val = value;
-                if (val.is_negative())
-                {
-                    m_strm << '-';
-                    val = -val;
-                }
-                unsigned long long total_useconds = value.total_microseconds();
-                unsigned long long hours = total_useconds / (3600ull * 1000000ull);
-                unsigned int minutes = static_cast< unsigned int >(total_useconds / (60ull * 1000000ull) % 60ull);
-                unsigned int seconds = static_cast< unsigned int >(total_useconds / 1000000ull % 60ull);
-                unsigned int useconds = static_cast< unsigned int >(total_useconds % 1000000ull);
-                char buf[64];
-                int len = boost::core::snprintf(buf, sizeof(buf), "%.2llu:%.2u:%.2u.%.6u", hours, minutes, seconds, useconds);
-                if (BOOST_LIKELY(len > 0))
-                {
-                    unsigned int size = static_cast< unsigned int >(len) >= sizeof(buf) ? static_cast< unsigned int >(sizeof(buf)) : static_cast< unsigned int >(len);
-                    m_strm.write(buf, size);
-                }
-            }
-            else
-            {
-                format_special_date_time(value);
-            }
-        }
-
-        void operator() (boost::gregorian::date_duration const& value) const
-        {
-            if (!value.is_special())
-            {
-                m_strm << value.get_rep().as_number();
-            }
-            else
-            {
-                format_special_date_time(value.get_rep().as_special());
-            }
-        }
-
-        template< typename PointRepT, typename DurationRepT >
-        void operator() (boost::date_time::period< PointRepT, DurationRepT > const& value) const
-        {
-            m_strm << '[';
-            this->operator()(value.begin());
-            m_strm << '/';
-            this->operator()(value.last());
-            m_strm << ']';
-        }
-
-    private:
-        template< typename T >
-        void format_special_date_time(T const& value) const
-        {
-            if (value.is_not_a_date_time())
-                m_strm << "not-a-date-time";
-            else if (value.is_pos_infinity())
-                m_strm << "+infinity";
-            else if (value.is_neg_infinity())
-                m_strm << "-infinity";
-        }
-
-        void format_special_date_time(boost::date_time::special_values value) const
-        {
-            switch (value)
-            {
-            case boost::date_time::not_a_date_time:
-                m_strm << "not-a-date-time";
-                break;
-            case boost::date_time::pos_infin:
-                m_strm << "+infinity";
-                break;
-            case boost::date_time::neg_infin:
-                m_strm << "-infinity";
-                break;
-            default:
-                break;
-            }
-        }
-
-    private:
-        basic_formatting_ostream< CharT >& m_strm;
-    };
+    typedef typename default_formatter_factory< CharT >::value_writer value_writer;
 
 public:
-    explicit default_formatter(attribute_name name) : m_attribute_name(name)
+    explicit default_formatter(attribute_name name) :
+        m_attribute_name(name),
+        m_writer(default_formatter_factory< CharT >::get_value_writer(name))
     {
     }
 
     result_type operator() (record_view const& rec, basic_formatting_ostream< CharT >& strm) const
     {
-        typedef BOOST_PP_CAT(mpl::vector, BOOST_PP_SEQ_SIZE(BOOST_LOG_AUX_LOG_DEFAULT_VALUE_TYPES()))<
-            BOOST_PP_SEQ_ENUM(BOOST_LOG_AUX_LOG_DEFAULT_VALUE_TYPES())
-        > value_types;
-
-        boost::log::visit< value_types >(m_attribute_name, rec, visitor(strm));
+        attribute_value_set const& values = rec.attribute_values();
+        attribute_value_set::const_iterator it = values.find(m_attribute_name);
+        if (it != values.end())
+            m_writer(it->second, strm);
     }
 
 private:
     const attribute_name m_attribute_name;
+    const value_writer m_writer;
 };
 
 } // namespace
@@ -270,6 +96,31 @@ default_formatter_factory< CharT >::create_formatter(attribute_name const& name,
     return formatter_type(default_formatter< CharT >(name));
 }
 
+//! The function returns the attribute value writer for the specified attribute name
+template< typename CharT >
+typename default_formatter_factory< CharT >::value_writer
+default_formatter_factory< CharT >::get_value_writer(attribute_name const& name)
+{
+    // Pick the value type that is most likely to be used with the standard attributes, so that
+    // formatting of these attributes doesn't involve lookup in the full list of supported types
+    if (name == default_attribute_names::timestamp())
+        return &write_typed_value< CharT, boost::posix_time::ptime >;
+    if (name == default_attribute_names::severity())
+        return &write_typed_value< CharT, boost::log::trivial::severity_level >;
+    if (name == default_attribute_names::channel())
+        return &write_typed_value< CharT, std::string >;
+    if (name == default_attribute_names::line_id())
+        return &write_typed_value< CharT, unsigned int >;
+    if (name == default_attribute_names::process_id())
+        return &write_typed_value< CharT, boost::log::aux::process::id >;
+#if !defined(BOOST_LOG_NO_THREADS)
+    if (name == default_attribute_names::thread_id())
+        return &write_typed_value< CharT, boost::log::aux::thread::id >;
+#endif
+
+    return &write_value< CharT >;
+}
+
 //  Explicitly instantiate factory implementation
 #ifdef BOOST_LOG_USE_CHAR
 template class default_formatter_factory< char >;
@@ -18,6 +18,8 @@
 
 #include <boost/log/detail/setup_config.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value.hpp>
+#include <boost/log/utility/formatting_ostream_fwd.hpp>
 #include <boost/log/utility/setup/formatter_parser.hpp>
 #include <boost/log/detail/header.hpp>
 
@@ -43,9 +45,18 @@ public:
     typedef typename base_type::string_type string_type;
     typedef typename base_type::formatter_type formatter_type;
     typedef typename base_type::args_map args_map;
+    //! Attribute value writer type
+    typedef void (*value_writer)(attribute_value const& value, basic_formatting_ostream< char_type >& strm);
 
     //! The function creates a formatter for the specified attribute.
     formatter_type create_formatter(attribute_name const& name, args_map const& args) BOOST_OVERRIDE;
+
+    /*!
+     * The function returns the writer of attribute values with the specified name. For the standard attribute names
+     * the writer is specialized for the commonly used value type and falls back to the generic formatting
+     * if the attribute value has a different type.
+     */
+    static value_writer get_value_writer(attribute_name const& name);
 };
 
 } // namespace aux
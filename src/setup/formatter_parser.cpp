@@ -17,16 +17,18 @@
 
 #include <boost/log/detail/setup_config.hpp>
 #include <map>
+#include <vector>
 #include <string>
 #include <sstream>
 #include <stdexcept>
 #include <boost/assert.hpp>
 #include <boost/move/core.hpp>
 #include <boost/move/utility_core.hpp>
-#include <boost/optional/optional.hpp>
-#include <boost/utility/in_place_factory.hpp>
+#include <boost/utility/string_view.hpp>
 #include <boost/log/expressions/formatter.hpp>
 #include <boost/log/attributes/attribute_name.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/core/record_view.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/detail/singleton.hpp>
 #include <boost/log/detail/code_conversion.hpp>
@@ -41,6 +43,7 @@
 #include "parser_utils.hpp"
 #include "spirit_encoding.hpp"
 #if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+#include <boost/log/expressions/formatters/json.hpp>
 #include "default_formatter_factory.hpp"
 #endif
 #include <boost/log/detail/header.hpp>
@@ -117,61 +120,256 @@ private:
     }
 };
 
-//! Function object for formatter chaining
-template< typename CharT, typename SecondT >
-struct chained_formatter
+//! Formatter that executes a flat program of formatting instructions
+template< typename CharT >
+class compiled_formatter
 {
+public:
     typedef void result_type;
-    typedef basic_formatter< CharT > formatter_type;
+    typedef CharT char_type;
+    typedef std::basic_string< char_type > string_type;
+    typedef basic_formatter< char_type > formatter_type;
     typedef typename formatter_type::stream_type stream_type;
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+    typedef typename aux::default_formatter_factory< char_type >::value_writer value_writer;
+#endif
 
-#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
-    explicit chained_formatter(formatter_type&& first, SecondT&& second) :
-#else
-    template< typename T >
-    explicit chained_formatter(BOOST_RV_REF(formatter_type) first, T const& second) :
+private:
+    //! Instruction codes
+    enum opcode
+    {
+        op_literal,     //!< Output a part of the literal string buffer
+        op_message,     //!< Output the log message
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+        op_value,       //!< Look up an attribute value and output it with the value writer
+#endif
+        op_formatter    //!< Invoke a formatter created by a user-defined factory
+    };
+
+    //! Formatting instruction
+    struct instruction
+    {
+        opcode m_opcode;
+        //! Literal position and size in the literal string buffer
+        std::size_t m_literal_pos, m_literal_size;
+        //! Attribute name
+        attribute_name m_name;
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+        //! Attribute value writer
+        value_writer m_writer;
 #endif
-        m_first(boost::move(first)), m_second(boost::move(second))
+        //! Formatter
+        formatter_type m_formatter;
+
+        explicit instruction(opcode op) :
+            m_opcode(op),
+            m_literal_pos(0u),
+            m_literal_size(0u)
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+            , m_writer(NULL)
+#endif
+        {
+        }
+    };
+
+    typedef std::vector< instruction > program_type;
+
+private:
+    //! All string literals of the formatter
+    string_type m_literals;
+    //! Formatting instructions
+    program_type m_program;
+    //! Message formatter
+    expressions::aux::message_formatter m_message_formatter;
+
+public:
+    //! Returns \c true if the program has no instructions
+    bool empty() const BOOST_NOEXCEPT { return m_program.empty(); }
+
+    //! Appends a string literal to the program. Adjacent literals are merged.
+    void append_literal(string_type const& str)
     {
+        if (str.empty())
+            return;
+
+        if (m_program.empty() || m_program.back().m_opcode != op_literal)
+        {
+            m_program.push_back(instruction(op_literal));
+            m_program.back().m_literal_pos = m_literals.size();
+        }
+
+        m_literals.append(str);
+        m_program.back().m_literal_size += str.size();
     }
 
-    result_type operator() (record_view const& rec, stream_type& strm) const
+    //! Appends message output to the program
+    void append_message()
     {
-        m_first(rec, strm);
-        m_second(rec, strm);
+        m_program.push_back(instruction(op_message));
     }
 
-private:
-    formatter_type m_first;
-    SecondT m_second;
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+    //! Appends attribute value output to the program
+    void append_value(attribute_name const& name, value_writer writer)
+    {
+        m_program.push_back(instruction(op_value));
+        m_program.back().m_name = name;
+        m_program.back().m_writer = writer;
+    }
+#endif
+
+    //! Appends a formatter invocation to the program
+    void append_formatter(BOOST_RV_REF(formatter_type) fmt)
+    {
+        m_program.push_back(instruction(op_formatter));
+        m_program.back().m_formatter.swap(fmt);
+    }
+
+    result_type operator() (record_view const& rec, stream_type& strm) const
+    {
+        const char_type* const literals = m_literals.data();
+        for (typename program_type::const_iterator it = m_program.begin(), end = m_program.end(); it != end; ++it)
+        {
+            instruction const& instr = *it;
+            switch (instr.m_opcode)
+            {
+            case op_literal:
+                strm << boost::basic_string_view< char_type >(literals + instr.m_literal_pos, instr.m_literal_size);
+                break;
+
+            case op_message:
+                m_message_formatter(rec, strm);
+                break;
+
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+            case op_value:
+                {
+                    attribute_value_set const& values = rec.attribute_values();
+                    attribute_value_set::const_iterator value = values.find(instr.m_name);
+                    if (value != values.end())
+                        instr.m_writer(value->second, strm);
+                }
+                break;
+#endif
+
+            default:
+                instr.m_formatter(rec, strm);
+                break;
+            }
+        }
+    }
 };
 
-//! String literal formatter
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+
+//! Formatter that writes attribute values as a JSON object
 template< typename CharT >
-struct literal_formatter
+class json_formatter
 {
+public:
     typedef void result_type;
     typedef CharT char_type;
     typedef std::basic_string< char_type > string_type;
-    typedef basic_formatting_ostream< char_type > stream_type;
+    typedef basic_formatter< char_type > formatter_type;
+    typedef typename formatter_type::stream_type stream_type;
 
-#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
-    explicit literal_formatter(string_type&& str) : m_str(boost::move(str))
-#else
-    explicit literal_formatter(string_type const& str) : m_str(str)
-#endif
+private:
+    //! Object member description
+    struct member
     {
+        //! Attribute name
+        attribute_name m_name;
+        //! Quoted and escaped member name, followed by a colon
+        std::string m_key;
+    };
+    typedef std::vector< member > members;
+
+private:
+    //! Object members, if empty, all attribute values are written
+    members m_members;
+
+public:
+    //! Constructs the formatter that writes the attribute values listed in the comma-separated string, or all values if the list is empty
+    explicit json_formatter(string_type const& names)
+    {
+        typedef boost::log::aux::char_constants< char_type > constants;
+        const char_type* p = names.data();
+        const char_type* const end = p + names.size();
+        while (p != end)
+        {
+            p = constants::trim_spaces_left(p, end);
+            const char_type* name_end = p;
+            while (name_end != end && *name_end != static_cast< char_type >(','))
+                ++name_end;
+            const char_type* next = name_end;
+            name_end = constants::trim_spaces_right(p, name_end);
+            if (p == name_end)
+                BOOST_LOG_THROW_DESCR(parse_error, "Empty attribute name in the JSON formatter attribute list");
+
+            m_members.push_back(member());
+            member& m = m_members.back();
+            m.m_name = attribute_name(log::aux::to_narrow(string_type(p, name_end)));
+            make_key(m.m_name.string(), m.m_key);
+
+            p = next;
+            if (p != end)
+                ++p;
+        }
     }
 
     result_type operator() (record_view const& rec, stream_type& strm) const
     {
-        strm << m_str;
+        attribute_value_set const& values = rec.attribute_values();
+        bool first = true;
+        strm.put('{');
+        if (m_members.empty())
+        {
+            std::string key;
+            for (attribute_value_set::const_iterator it = values.begin(), end = values.end(); it != end; ++it)
+            {
+                make_key(it->first.string(), key);
+                put_member(strm, key, it->second, first);
+            }
+        }
+        else
+        {
+            for (typename members::const_iterator it = m_members.begin(), end = m_members.end(); it != end; ++it)
+            {
+                attribute_value_set::const_iterator value = values.find(it->m_name);
+                if (value != values.end())
+                    put_member(strm, it->m_key, value->second, first);
+            }
+        }
+        strm.put('}');
     }
 
 private:
-    const string_type m_str;
+    //! Writes an object member to the stream
+    static void put_member(stream_type& strm, std::string const& key, attribute_value const& value, bool& first)
+    {
+        if (!first)
+            strm.put(',');
+        first = false;
+
+        strm.write(key.data(), static_cast< std::streamsize >(key.size()));
+        // The values are written the same way as by format_json() with the default value types
+        boost::log::aux::put_json_default_value(strm, value);
+    }
+
+    //! Composes a quoted and escaped member name, followed by a colon
+    static void make_key(std::string const& name, std::string& key)
+    {
+        key.clear();
+        basic_formatting_ostream< char > strm(key);
+        strm.put('"');
+        expressions::aux::put_json_escaped(strm, name.data(), name.size());
+        strm.write("\":", 2);
+        strm.flush();
+    }
 };
 
+#endif // !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+
 //! Formatter parsing grammar
 template< typename CharT >
 class formatter_parser
@@ -190,12 +388,14 @@ private:
 
 private:
     //! The formatter being constructed
-    optional< formatter_type > m_Formatter;
+    compiled_formatter< char_type > m_Formatter;
 
     //! Attribute name
     attribute_name m_AttrName;
     //! Formatter factory arguments
     args_map m_FactoryArgs;
+    //! Indicates that the placeholder has an argument list, possibly empty
+    bool m_HasArgs;
 
     //! Formatter argument name
     mutable string_type m_ArgName;
@@ -204,7 +404,7 @@ private:
 
 public:
     //! Constructor
-    formatter_parser()
+    formatter_parser() : m_HasArgs(false)
     {
     }
 
@@ -254,6 +454,7 @@ public:
                 if (*p == constants::char_paren_bracket_left)
                 {
                     // We found formatter arguments
+                    m_HasArgs = true;
                     p = parse_args(constants::trim_spaces_left(++p, end), end);
                     p = constants::trim_spaces_left(p, end);
                     if (p == end)
@@ -275,13 +476,13 @@ public:
     //! Returns the parsed formatter
     formatter_type get_formatter()
     {
-        if (!m_Formatter)
+        if (m_Formatter.empty())
         {
             // This may happen if parser input is an empty string
             return formatter_type(nop());
         }
 
-        return boost::move(m_Formatter.get());
+        return formatter_type(boost::move(m_Formatter));
     }
 
 private:
@@ -392,19 +593,41 @@ private:
         if (m_AttrName == log::aux::default_attribute_names::message())
         {
             // We make a special treatment for the message text formatter
-            append_formatter(expressions::aux::message_formatter());
+            m_Formatter.append_message();
         }
         else
         {
-            // Use the factory to create the formatter
             formatters_repository< char_type > const& repo = formatters_repository< char_type >::get();
             formatter_factory_type& factory = repo.get_factory(m_AttrName);
-            append_formatter(factory.create_formatter(m_AttrName, m_FactoryArgs));
+#if !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+            if (&factory == &repo.m_DefaultFactory && m_HasArgs && m_AttrName == "JSON")
+            {
+                // Unless the user registered a formatter factory for this name, %JSON(...)% outputs attribute values as a JSON object.
+                // The placeholder without the argument list outputs the value of the attribute named "JSON", as any other placeholder.
+                string_type names;
+                typename args_map::const_iterator it = m_FactoryArgs.find(constants::json_attributes_keyword());
+                if (it != m_FactoryArgs.end())
+                    names = it->second;
+                m_Formatter.append_formatter(formatter_type(json_formatter< char_type >(names)));
+            }
+            else if (&factory == &repo.m_DefaultFactory)
+            {
+                // The default factory ignores arguments, so we can output the value directly, without creating a formatter
+                m_Formatter.append_value(m_AttrName, aux::default_formatter_factory< char_type >::get_value_writer(m_AttrName));
+            }
+            else
+#endif
+            {
+                // Use the factory to create the formatter
+                formatter_type fmt = factory.create_formatter(m_AttrName, m_FactoryArgs);
+                m_Formatter.append_formatter(boost::move(fmt));
+            }
         }
 
         // Eventually, clear all the auxiliary data
         m_AttrName = attribute_name();
         m_FactoryArgs.clear();
+        m_HasArgs = false;
     }
 
     //! The method is called when a string literal is discovered
@@ -412,17 +635,7 @@ private:
     {
         string_type s(begin, end);
         constants::translate_escape_sequences(s);
-        append_formatter(literal_formatter< char_type >(boost::move(s)));
-    }
-
-    //! The method appends a formatter part to the final formatter
-    template< typename FormatterT >
-    void append_formatter(FormatterT fmt)
-    {
-        if (!!m_Formatter)
-            m_Formatter = boost::in_place(chained_formatter< char_type, FormatterT >(boost::move(m_Formatter.get()), boost::move(fmt)));
-        else
-            m_Formatter = boost::in_place(boost::move(fmt));
+        m_Formatter.append_literal(s);
     }
 
     //  Assignment and copying are prohibited
@@ -25,6 +25,7 @@
 
 #include <boost/log/detail/setup_config.hpp>
 #include <cstddef>
+#include <chrono>
 #include <ios>
 #include <map>
 #include <vector>
@@ -510,6 +511,21 @@ public:
             backend->auto_flush(param_cast_to_bool("AutoFlush", auto_flush_param.get()));
         }
 
+        // Group commit
+        if (optional< string_type > group_commit_size_param = params["GroupCommitSize"])
+        {
+            const uintmax_t group_size = param_cast_to_int< uintmax_t >("GroupCommitSize", group_commit_size_param.get());
+            if (optional< string_type > group_commit_interval_param = params["GroupCommitInterval"])
+            {
+                backend->set_group_commit(group_size, std::chrono::milliseconds(
+                    param_cast_to_int< unsigned int >("GroupCommitInterval", group_commit_interval_param.get())));
+            }
+            else
+            {
+                backend->set_group_commit(group_size);
+            }
+        }
+
         // Append
         if (optional< string_type > append_param = params["Append"])
         {
@@ -538,11 +554,23 @@ public:
             if (optional< string_type > max_files_param = params["MaxFiles"])
                 max_files = param_cast_to_int< uintmax_t >("MaxFiles", max_files_param.get());
 
+            // Asynchronous file collection
+            bool async_collection = false;
+            if (optional< string_type > async_collection_param = params["AsyncCollection"])
+                async_collection = param_cast_to_bool("AsyncCollection", async_collection_param.get());
+
+            // Persistent index of the target directory
+            bool persistent_index = false;
+            if (optional< string_type > persistent_index_param = params["PersistentIndex"])
+                persistent_index = param_cast_to_bool("PersistentIndex", persistent_index_param.get());
+
             backend->set_file_collector(sinks::file::make_collector(
                 keywords::target = target_dir,
                 keywords::max_size = max_size,
                 keywords::min_free_space = space,
-                keywords::max_files = max_files));
+                keywords::max_files = max_files,
+                keywords::async_collection = async_collection,
+                keywords::persistent_index = persistent_index));
 
             // Scan for log files
             if (optional< string_type > scan_param = params["ScanForFiles"])
@@ -584,7 +612,28 @@ public:
     {
         // Construct the backend
         typedef sinks::syslog_backend backend_t;
+#if !defined(BOOST_LOG_NO_ASIO)
+        sinks::syslog::impl_types use_impl = sinks::syslog::udp_socket_based;
+        if (optional< string_type > transport_param = params["Transport"])
+        {
+            string_type const& value = transport_param.get();
+            if (value == constants::syslog_transport_udp())
+                use_impl = sinks::syslog::udp_socket_based;
+            else if (value == constants::syslog_transport_tcp())
+                use_impl = sinks::syslog::tcp_socket_based;
+            else if (value == constants::syslog_transport_local())
+                use_impl = sinks::syslog::local_socket_based;
+            else
+            {
+                BOOST_LOG_THROW_DESCR(invalid_value,
+                    "Syslog transport \"" + boost::log::aux::to_narrow(value) + "\" is not supported");
+            }
+        }
+
+        shared_ptr< backend_t > backend = boost::make_shared< backend_t >(keywords::use_impl = use_impl);
+#else
         shared_ptr< backend_t > backend = boost::make_shared< backend_t >();
+#endif // !defined(BOOST_LOG_NO_ASIO)
 
         // For now we use only the default level mapping. Will add support for configuration later.
         backend->set_severity_mapper(sinks::syslog::direct_severity_mapping< >(log::aux::default_attribute_names::severity()));
@@ -596,6 +645,14 @@ public:
 
         if (optional< string_type > target_address_param = params["TargetAddress"])
             backend->set_target_address(param_cast_to_address("TargetAddress", target_address_param.get()));
+
+        if (optional< string_type > target_path_param = params["TargetPath"])
+            backend->set_target_path(log::aux::to_narrow(target_path_param.get()));
+        else if (use_impl == sinks::syslog::local_socket_based)
+            BOOST_LOG_THROW_DESCR(missing_value, "The local syslog socket path is not specified");
+
+        if (optional< string_type > max_batch_size_param = params["MaxBatchSize"])
+            backend->set_max_batch_size(param_cast_to_int< std::size_t >("MaxBatchSize", max_batch_size_param.get()));
 #endif // !defined(BOOST_LOG_NO_ASIO)
 
         return base_type::init_sink(backend, params);
@@ -28,6 +28,7 @@
 #endif
 
 #include <string>
+#include <cstddef>
 #if defined(BOOST_LOG_USE_STD_REGEX)
 #include <regex>
 #include <boost/log/support/std_regex.hpp>
@@ -42,11 +43,12 @@
 #include <boost/log/utility/functional/matches.hpp>
 #include <boost/log/utility/type_dispatch/standard_types.hpp>
 #include <boost/log/detail/code_conversion.hpp>
-#if defined(BOOST_LOG_USE_CHAR) && defined(BOOST_LOG_USE_WCHAR_T)
+#include <boost/log/detail/match_result_cache.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/fusion/container/set.hpp>
 #include <boost/fusion/sequence/intrinsic/at_key.hpp>
 #include <boost/fusion/algorithm/iteration/for_each.hpp>
-#endif
 #include "default_filter_factory.hpp"
 #include <boost/log/detail/header.hpp>
 
@@ -68,8 +70,8 @@ namespace regex_namespace = boost;
 
 #if defined(BOOST_LOG_USE_CHAR) && defined(BOOST_LOG_USE_WCHAR_T)
 
-//! A special filtering predicate that adopts the string operand to the attribute value character type
-struct matches_predicate :
+//! A regular expression matching predicate that adopts the string operand to the attribute value character type
+struct regex_predicate :
     public matches_fun
 {
     template< typename CharT >
@@ -105,7 +107,7 @@ struct matches_predicate :
     typedef matches_fun::result_type result_type;
 
     template< typename CharT >
-    explicit matches_predicate(std::basic_string< CharT > const& operand)
+    explicit regex_predicate(std::basic_string< CharT > const& operand)
     {
         fusion::for_each(m_operands, initializer< CharT >(operand));
     }
@@ -124,9 +126,9 @@ private:
 
 #else
 
-//! A special filtering predicate that adopts the string operand to the attribute value character type
+//! A regular expression matching predicate that adopts the string operand to the attribute value character type
 template< typename CharT >
-struct matches_predicate :
+struct regex_predicate :
     public matches_fun
 {
     typedef typename matches_fun::result_type result_type;
@@ -134,7 +136,7 @@ struct matches_predicate :
     typedef std::basic_string< char_type > string_type;
     typedef regex_namespace::basic_regex< char_type > regex_type;
 
-    explicit matches_predicate(string_type const& operand) :
+    explicit regex_predicate(string_type const& operand) :
         m_operand(operand, regex_type::ECMAScript | regex_type::optimize)
     {
     }
@@ -155,8 +157,8 @@ private:
 
 #if defined(BOOST_LOG_USE_CHAR) && defined(BOOST_LOG_USE_WCHAR_T)
 
-//! A special filtering predicate that adopts the string operand to the attribute value character type
-struct matches_predicate :
+//! A regular expression matching predicate that adopts the string operand to the attribute value character type
+struct regex_predicate :
     public matches_fun
 {
     template< typename CharT >
@@ -192,7 +194,7 @@ struct matches_predicate :
     typedef matches_fun::result_type result_type;
 
     template< typename CharT >
-    explicit matches_predicate(std::basic_string< CharT > const& operand)
+    explicit regex_predicate(std::basic_string< CharT > const& operand)
     {
         fusion::for_each(m_operands, initializer< CharT >(operand));
     }
@@ -211,9 +213,9 @@ private:
 
 #else
 
-//! A special filtering predicate that adopts the string operand to the attribute value character type
+//! A regular expression matching predicate that adopts the string operand to the attribute value character type
 template< typename CharT >
-struct matches_predicate :
+struct regex_predicate :
     public matches_fun
 {
     typedef typename matches_fun::result_type result_type;
@@ -221,7 +223,7 @@ struct matches_predicate :
     typedef std::basic_string< char_type > string_type;
     typedef xpressive::basic_regex< const char_type* > regex_type;
 
-    explicit matches_predicate(string_type const& operand) :
+    explicit regex_predicate(string_type const& operand) :
         m_operand(regex_type::compile(operand.c_str(), operand.size(), regex_type::ECMAScript | regex_type::optimize))
     {
     }
@@ -240,6 +242,303 @@ private:
 
 #endif // defined(BOOST_LOG_USE_STD_REGEX) || defined(BOOST_LOG_USE_BOOST_REGEX)
 
+//! Kinds of regular expressions that can be matched without the regular expression engine
+enum literal_pattern_kind
+{
+    not_literal,        //!< The expression is not a literal pattern
+    literal_full,       //!< The expression is a literal string, e.g. "abc"
+    literal_prefix,     //!< The expression matches strings that begin with a literal, e.g. "abc.*"
+    literal_suffix,     //!< The expression matches strings that end with a literal, e.g. ".*abc"
+    literal_substring   //!< The expression matches strings that contain a literal, e.g. ".*abc.*"
+};
+
+/*!
+ * The class detects regular expressions that are equivalent to a simple string comparison
+ * and performs the comparison instead of the regular expression matching.
+ */
+template< typename CharT >
+class literal_pattern
+{
+public:
+    typedef CharT char_type;
+    typedef std::basic_string< char_type > string_type;
+    typedef std::char_traits< char_type > traits_type;
+
+private:
+    //! Pattern kind
+    literal_pattern_kind m_kind;
+    //! The literal to compare the strings with
+    string_type m_literal;
+
+public:
+    literal_pattern() : m_kind(not_literal)
+    {
+    }
+
+    //! Returns the pattern kind
+    literal_pattern_kind kind() const { return m_kind; }
+
+    //! Detects the pattern kind of the regular expression
+    void parse(string_type const& expr)
+    {
+        m_kind = not_literal;
+        m_literal.clear();
+
+        const char_type* p = expr.data();
+        const char_type* const end = p + expr.size();
+
+        // The expression is always matched against the whole string, so the anchors are redundant
+        if (p != end && *p == static_cast< char_type >('^'))
+            ++p;
+
+        const bool any_prefix = is_any_sequence(p, end);
+        if (any_prefix)
+            p += 2;
+
+        string_type literal;
+        while (p != end)
+        {
+            char_type c = *p;
+            if (c == static_cast< char_type >('\\'))
+            {
+                // Only escaped special characters are literals, other escape sequences denote character classes, assertions, etc.
+                ++p;
+                if (p == end || !is_special(*p))
+                    return;
+                c = *p;
+            }
+            else if (is_special(c))
+            {
+                break;
+            }
+
+            literal.push_back(c);
+            ++p;
+        }
+
+        const bool any_suffix = is_any_sequence(p, end);
+        if (any_suffix)
+            p += 2;
+
+        if (p != end && *p == static_cast< char_type >('$'))
+            ++p;
+
+        if (p == end)
+        {
+            m_literal.swap(literal);
+            if (any_prefix)
+                m_kind = any_suffix ? literal_substring : literal_suffix;
+            else
+                m_kind = any_suffix ? literal_prefix : literal_full;
+        }
+    }
+
+    /*!
+     * Matches the string against the pattern
+     *
+     * \param str Pointer to the string
+     * \param size String length
+     * \param result Receives the matching result
+     * \return \c true if the string has been matched, \c false if the string has to be matched by the regular expression engine
+     */
+    bool match(const char_type* str, std::size_t size, bool& result) const
+    {
+        if (m_kind == not_literal)
+            return false;
+
+        const std::size_t literal_size = m_literal.size();
+        if (m_kind == literal_full)
+        {
+            result = size == literal_size && traits_type::compare(str, m_literal.data(), size) == 0;
+            return true;
+        }
+
+        // ".*" does not match line terminators, leave such strings to the regular expression engine
+        for (std::size_t i = 0u; i < size; ++i)
+        {
+            if (is_line_terminator(str[i]))
+                return false;
+        }
+
+        switch (m_kind)
+        {
+        case literal_prefix:
+            result = size >= literal_size && traits_type::compare(str, m_literal.data(), literal_size) == 0;
+            break;
+
+        case literal_suffix:
+            result = size >= literal_size && traits_type::compare(str + (size - literal_size), m_literal.data(), literal_size) == 0;
+            break;
+
+        default:
+            result = find_literal(str, size);
+            break;
+        }
+
+        return true;
+    }
+
+private:
+    //! Checks if the string contains the literal
+    bool find_literal(const char_type* str, std::size_t size) const
+    {
+        const std::size_t literal_size = m_literal.size();
+        if (literal_size == 0u)
+            return true;
+        if (size < literal_size)
+            return false;
+
+        // Find the first character of the literal with the character traits, which are typically optimized for the character type
+        const char_type* const literal = m_literal.data();
+        const char_type* const search_end = str + (size - literal_size) + 1u;
+        while (str != search_end)
+        {
+            str = traits_type::find(str, static_cast< std::size_t >(search_end - str), literal[0]);
+            if (!str)
+                return false;
+            if (traits_type::compare(str + 1, literal + 1, literal_size - 1u) == 0)
+                return true;
+            ++str;
+        }
+
+        return false;
+    }
+
+    //! Checks if the expression at the given position is ".*"
+    static bool is_any_sequence(const char_type* p, const char_type* end)
+    {
+        return (end - p) >= 2 && p[0] == static_cast< char_type >('.') && p[1] == static_cast< char_type >('*');
+    }
+
+    //! Checks if the character has a special meaning in regular expressions
+    static bool is_special(char_type c)
+    {
+        switch (c)
+        {
+        case static_cast< char_type >('^'):
+        case static_cast< char_type >('$'):
+        case static_cast< char_type >('\\'):
+        case static_cast< char_type >('.'):
+        case static_cast< char_type >('*'):
+        case static_cast< char_type >('+'):
+        case static_cast< char_type >('?'):
+        case static_cast< char_type >('('):
+        case static_cast< char_type >(')'):
+        case static_cast< char_type >('['):
+        case static_cast< char_type >(']'):
+        case static_cast< char_type >('{'):
+        case static_cast< char_type >('}'):
+        case static_cast< char_type >('|'):
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    //! Checks if the character is a line terminator in ECMAScript
+    static bool is_line_terminator(char_type c)
+    {
+        return c == static_cast< char_type >('\n') || c == static_cast< char_type >('\r') ||
+            (sizeof(char_type) > 1u && (static_cast< unsigned int >(c) == 0x2028u || static_cast< unsigned int >(c) == 0x2029u));
+    }
+};
+
+//! Literal patterns for all supported character types
+#if defined(BOOST_LOG_USE_CHAR) && defined(BOOST_LOG_USE_WCHAR_T)
+typedef fusion::set< literal_pattern< char >, literal_pattern< wchar_t > > literal_patterns;
+#elif defined(BOOST_LOG_USE_CHAR)
+typedef fusion::set< literal_pattern< char > > literal_patterns;
+#else
+typedef fusion::set< literal_pattern< wchar_t > > literal_patterns;
+#endif
+
+/*!
+ * A filtering predicate that matches the attribute value against a regular expression. Regular expressions
+ * that are equivalent to a string comparison are matched without the regular expression engine. Otherwise,
+ * the matching results are cached, since the attribute values are often drawn from a small set of strings,
+ * like channel names or tags.
+ */
+template< typename RegexPredicateT >
+class matches_predicate
+{
+public:
+    typedef bool result_type;
+
+private:
+    template< typename CharT >
+    struct initializer
+    {
+        typedef void result_type;
+        typedef CharT char_type;
+        typedef std::basic_string< char_type > string_type;
+
+        initializer(string_type const& val, bool& is_literal) : m_initializer(val), m_is_literal(is_literal)
+        {
+        }
+
+        template< typename T >
+        result_type operator() (T& val) const
+        {
+            try
+            {
+                typedef typename T::char_type target_char_type;
+                std::basic_string< target_char_type > str;
+                log::aux::code_convert(m_initializer, str);
+                val.parse(str);
+            }
+            catch (...)
+            {
+            }
+
+            if (val.kind() == not_literal)
+                m_is_literal = false;
+        }
+
+    private:
+        string_type const& m_initializer;
+        bool& m_is_literal;
+    };
+
+private:
+    //! Regular expression matching predicate
+    RegexPredicateT m_regex;
+    //! Literal patterns
+    literal_patterns m_literals;
+    //! Matching results cache, if the regular expression is not a literal pattern
+    shared_ptr< match_result_cache > m_cache;
+
+public:
+    template< typename CharT >
+    explicit matches_predicate(std::basic_string< CharT > const& operand) : m_regex(operand)
+    {
+        bool is_literal = true;
+        fusion::for_each(m_literals, initializer< CharT >(operand, is_literal));
+        if (!is_literal)
+            m_cache = boost::make_shared< match_result_cache >();
+    }
+
+    template< typename T >
+    result_type operator() (T const& val) const
+    {
+        typedef typename T::value_type char_type;
+
+        bool result = false;
+        if (fusion::at_key< literal_pattern< char_type > >(m_literals).match(val.data(), val.size(), result))
+            return result;
+
+        match_result_cache* const cache = m_cache.get();
+        if (cache && cache->find(val.data(), val.size(), result))
+            return result;
+
+        result = m_regex(val);
+
+        if (cache)
+            cache->insert(val.data(), val.size(), result);
+
+        return result;
+    }
+};
+
 } // namespace
 
 //! The function parses the "matches" relation
@@ -247,9 +546,11 @@ template< typename CharT >
 filter parse_matches_relation(attribute_name const& name, std::basic_string< CharT > const& operand)
 {
 #if defined(BOOST_LOG_USE_CHAR) && defined(BOOST_LOG_USE_WCHAR_T)
-    return predicate_wrapper< log::string_types::type, matches_predicate >(name, matches_predicate(operand));
+    typedef matches_predicate< regex_predicate > predicate_type;
+    return predicate_wrapper< log::string_types::type, predicate_type >(name, predicate_type(operand));
 #else
-    return predicate_wrapper< std::basic_string< CharT >, matches_predicate< CharT > >(name, matches_predicate< CharT >(operand));
+    typedef matches_predicate< regex_predicate< CharT > > predicate_type;
+    return predicate_wrapper< std::basic_string< CharT >, predicate_type >(name, predicate_type(operand));
 #endif
 }
 
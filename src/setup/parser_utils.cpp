@@ -53,6 +53,7 @@ const char_constants< char >::char_type char_constants< char >::char_section_bra
 const char_constants< char >::char_type char_constants< char >::char_section_bracket_right;
 const char_constants< char >::char_type char_constants< char >::char_paren_bracket_left;
 const char_constants< char >::char_type char_constants< char >::char_paren_bracket_right;
+const char_constants< char >::char_type char_constants< char >::char_asterisk;
 
 #endif // BOOST_LOG_BROKEN_STATIC_CONSTANTS_LINKAGE
 
@@ -226,6 +227,7 @@ const char_constants< wchar_t >::char_type char_constants< wchar_t >::char_secti
 const char_constants< wchar_t >::char_type char_constants< wchar_t >::char_section_bracket_right;
 const char_constants< wchar_t >::char_type char_constants< wchar_t >::char_paren_bracket_left;
 const char_constants< wchar_t >::char_type char_constants< wchar_t >::char_paren_bracket_right;
+const char_constants< wchar_t >::char_type char_constants< wchar_t >::char_asterisk;
 
 #endif // BOOST_LOG_BROKEN_STATIC_CONSTANTS_LINKAGE
 
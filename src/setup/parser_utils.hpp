@@ -61,6 +61,7 @@ struct char_constants< char >
     static const char_type char_section_bracket_right = ']';
     static const char_type char_paren_bracket_left = '(';
     static const char_type char_paren_bracket_right = ')';
+    static const char_type char_asterisk = '*';
 
     static const char_type* not_keyword() { return "not"; }
     static const char_type* and_keyword() { return "and"; }
@@ -75,8 +76,10 @@ struct char_constants< char >
     static const char_type* ends_with_keyword() { return "ends_with"; }
     static const char_type* contains_keyword() { return "contains"; }
     static const char_type* matches_keyword() { return "matches"; }
+    static const char_type* thresholds_keyword() { return "thresholds"; }
 
     static const char_type* message_text_keyword() { return "_"; }
+    static const char_type* json_attributes_keyword() { return "attributes"; }
 
     static literal_type true_keyword() { return literal_type("true"); }
     static literal_type false_keyword() { return literal_type("false"); }
@@ -123,6 +126,10 @@ struct char_constants< char >
     static const char_type* registration_on_demand() { return "OnDemand"; }
     static const char_type* registration_forced() { return "Forced"; }
 
+    static const char_type* syslog_transport_udp() { return "UDP"; }
+    static const char_type* syslog_transport_tcp() { return "TCP"; }
+    static const char_type* syslog_transport_local() { return "Local"; }
+
     static const char_type* text_file_destination() { return "TextFile"; }
     static const char_type* console_destination() { return "Console"; }
     static const char_type* syslog_destination() { return "Syslog"; }
@@ -197,6 +204,7 @@ struct char_constants< wchar_t >
     static const char_type char_section_bracket_right = L']';
     static const char_type char_paren_bracket_left = L'(';
     static const char_type char_paren_bracket_right = L')';
+    static const char_type char_asterisk = L'*';
 
     static const char_type* not_keyword() { return L"not"; }
     static const char_type* and_keyword() { return L"and"; }
@@ -211,8 +219,10 @@ struct char_constants< wchar_t >
     static const char_type* ends_with_keyword() { return L"ends_with"; }
     static const char_type* contains_keyword() { return L"contains"; }
     static const char_type* matches_keyword() { return L"matches"; }
+    static const char_type* thresholds_keyword() { return L"thresholds"; }
 
     static const char_type* message_text_keyword() { return L"_"; }
+    static const char_type* json_attributes_keyword() { return L"attributes"; }
 
     static literal_type true_keyword() { return literal_type(L"true"); }
     static literal_type false_keyword() { return literal_type(L"false"); }
@@ -259,6 +269,10 @@ struct char_constants< wchar_t >
     static const char_type* registration_on_demand() { return L"OnDemand"; }
     static const char_type* registration_forced() { return L"Forced"; }
 
+    static const char_type* syslog_transport_udp() { return L"UDP"; }
+    static const char_type* syslog_transport_tcp() { return L"TCP"; }
+    static const char_type* syslog_transport_local() { return L"Local"; }
+
     static const char_type* text_file_destination() { return L"TextFile"; }
     static const char_type* console_destination() { return L"Console"; }
     static const char_type* syslog_destination() { return L"Syslog"; }
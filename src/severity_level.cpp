@@ -18,7 +18,11 @@
 #include <boost/cstdint.hpp>
 #include <boost/log/sources/severity_feature.hpp>
 
-#if !defined(BOOST_LOG_NO_THREADS) && !defined(BOOST_LOG_USE_COMPILER_TLS)
+#if !defined(BOOST_LOG_NO_THREADS) && !defined(BOOST_LOG_USE_COMPILER_TLS) && (defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_LOG_NO_CXX11_THREAD_LOCAL_SEVERITY))
+#define BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC
+#endif
+
+#if defined(BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC)
 #include <boost/thread/thread.hpp> // at_thread_exit
 #include <boost/log/detail/singleton.hpp>
 #include <boost/log/detail/thread_specific.hpp>
@@ -41,6 +45,13 @@ static uintmax_t g_Severity = 0;
 
 static BOOST_LOG_TLS uintmax_t g_Severity = 0;
 
+#elif !defined(BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC)
+
+// The severity level has a trivial type and is constant-initialized, so accessing it in C++11 TLS involves no lazy initialization
+// and works in global constructors and destructors. The TLS may still be unavailable if the library is loaded dynamically
+// on some systems, in which case BOOST_LOG_NO_CXX11_THREAD_LOCAL_SEVERITY can be defined to use Boost.Thread TSS instead.
+static thread_local uintmax_t g_Severity = 0;
+
 #else
 
 //! Severity level storage class
@@ -52,7 +63,7 @@ class severity_level_holder :
 #endif
 
 
-#if !defined(BOOST_LOG_NO_THREADS) && !defined(BOOST_LOG_USE_COMPILER_TLS)
+#if defined(BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC)
 
 //! The method returns the severity level for the current thread
 BOOST_LOG_API uintmax_t& get_severity_level()
@@ -69,7 +80,7 @@ BOOST_LOG_API uintmax_t& get_severity_level()
     return *p;
 }
 
-#else // !defined(BOOST_LOG_NO_THREADS) && !defined(BOOST_LOG_USE_COMPILER_TLS)
+#else // defined(BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC)
 
 //! The method returns the severity level for the current thread
 BOOST_LOG_API uintmax_t& get_severity_level()
@@ -77,7 +88,7 @@ BOOST_LOG_API uintmax_t& get_severity_level()
     return g_Severity;
 }
 
-#endif // !defined(BOOST_LOG_NO_THREADS) && !defined(BOOST_LOG_USE_COMPILER_TLS)
+#endif // defined(BOOST_LOG_SEVERITY_LEVEL_USE_THREAD_SPECIFIC)
 
 } // namespace aux
 
@@ -18,7 +18,11 @@
 #ifndef BOOST_LOG_WITHOUT_SYSLOG
 
 #include <ctime>
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <vector>
+#include <string>
 #include <algorithm>
 #include <stdexcept>
 #include <boost/limits.hpp>
@@ -33,15 +37,21 @@
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/generic/stream_protocol.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/host_name.hpp>
 #include <boost/asio/ip/resolver_base.hpp>
 #endif
 #include <boost/system/error_code.hpp>
+#include <boost/system/system_error.hpp>
 #include <boost/date_time/c_time.hpp>
 #include <boost/log/sinks/syslog_backend.hpp>
 #include <boost/log/sinks/syslog_constants.hpp>
 #include <boost/log/detail/singleton.hpp>
+#include <boost/log/detail/process_id.hpp>
 #include <boost/log/exceptions.hpp>
 #if !defined(BOOST_LOG_NO_THREADS)
 #include <mutex>
@@ -51,6 +61,17 @@
 #include <syslog.h>
 #endif // BOOST_LOG_USE_NATIVE_SYSLOG
 
+#if !defined(BOOST_LOG_NO_ASIO) && !defined(BOOST_WINDOWS)
+#include <errno.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#if defined(__linux__)
+#define BOOST_LOG_HAS_SENDMMSG
+#endif
+#endif
+
 #include <boost/log/detail/header.hpp>
 
 namespace boost {
@@ -92,6 +113,7 @@ struct syslog_backend::implementation
 #endif // BOOST_LOG_USE_NATIVE_SYSLOG
 #if !defined(BOOST_LOG_NO_ASIO)
     struct udp_socket_based;
+    struct stream_socket_based;
 #endif
 
     //! Level mapper
@@ -110,6 +132,8 @@ struct syslog_backend::implementation
 
     //! The method sends the formatted message to the syslog host
     virtual void send(syslog::level lev, string_type const& formatted_message) = 0;
+    //! The method sends the messages that may have been buffered by the implementation
+    virtual void flush() {}
 };
 
 
@@ -313,6 +337,12 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
     private:
         //! The socket primitive
         asio::ip::udp::socket m_Socket;
+#if defined(BOOST_LOG_HAS_SENDMMSG)
+        //! Message descriptors for batched sending
+        std::vector< struct mmsghdr > m_Messages;
+        //! Packet buffer descriptors for batched sending
+        std::vector< struct iovec > m_Buffers;
+#endif
 
     public:
         //! The constructor creates a socket bound to the specified local address and port
@@ -331,8 +361,14 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
             m_Socket.close(ec);
         }
 
-        //! The method sends the syslog message to the specified endpoint
-        void send_message(int pri, const char* local_host_name, asio::ip::udp::endpoint const& target, const char* message);
+        //! The method sends the packet to the specified endpoint
+        void send_packet(asio::ip::udp::endpoint const& target, const char* packet, std::size_t size)
+        {
+            m_Socket.send_to(asio::buffer(packet, size), target);
+        }
+
+        //! The method sends the packets stored sequentially in the buffer to the specified endpoint
+        void send_packets(asio::ip::udp::endpoint const& target, const char* packets, const std::size_t* sizes, std::size_t count);
 
         BOOST_DELETED_FUNCTION(syslog_udp_socket(syslog_udp_socket const&))
         BOOST_DELETED_FUNCTION(syslog_udp_socket& operator= (syslog_udp_socket const&))
@@ -356,13 +392,16 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         std::mutex m_Mutex;
         //! The resolver is used to acquire connection endpoints
         asio::ip::udp::resolver m_HostNameResolver;
+        //! The resolver is used to acquire connection endpoints for TCP connections
+        asio::ip::tcp::resolver m_TCPHostNameResolver;
 #endif // !defined(BOOST_LOG_NO_THREADS)
 
     private:
         //! Default constructor
         syslog_udp_service()
 #if !defined(BOOST_LOG_NO_THREADS)
-            : m_HostNameResolver(m_IOContext)
+            : m_HostNameResolver(m_IOContext),
+            m_TCPHostNameResolver(m_IOContext)
 #endif // !defined(BOOST_LOG_NO_THREADS)
         {
             boost::system::error_code err;
@@ -373,43 +412,63 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         {
             base_type::get_instance().reset(new syslog_udp_service());
         }
+
+    public:
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! Returns the resolver for the specified protocol
+        asio::ip::udp::resolver& get_resolver(asio::ip::udp const&) BOOST_NOEXCEPT
+        {
+            return m_HostNameResolver;
+        }
+        //! Returns the resolver for the specified protocol
+        asio::ip::tcp::resolver& get_resolver(asio::ip::tcp const&) BOOST_NOEXCEPT
+        {
+            return m_TCPHostNameResolver;
+        }
+#endif // !defined(BOOST_LOG_NO_THREADS)
     };
 
-    //! The method sends the syslog message to the specified endpoint
-    void syslog_udp_socket::send_message(
-        int pri, const char* local_host_name, asio::ip::udp::endpoint const& target, const char* message)
+    //! The method sends the packets stored sequentially in the buffer to the specified endpoint
+    void syslog_udp_socket::send_packets(asio::ip::udp::endpoint const& target, const char* packets, const std::size_t* sizes, std::size_t count)
     {
-        std::time_t t = std::time(NULL);
-        std::tm ts;
-        std::tm* time_stamp = boost::date_time::c_time::localtime(&t, &ts);
-
-        // Month will have to be injected separately, as involving locale won't do here
-        static const char months[12][4] =
+#if defined(BOOST_LOG_HAS_SENDMMSG)
+        m_Messages.resize(count);
+        m_Buffers.resize(count);
+        for (std::size_t i = 0u; i < count; ++i)
         {
-            "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
-        };
+            struct iovec& buf = m_Buffers[i];
+            buf.iov_base = const_cast< char* >(packets);
+            buf.iov_len = sizes[i];
+            packets += sizes[i];
+
+            struct mmsghdr& msg = m_Messages[i];
+            std::memset(&msg, 0, sizeof(msg));
+            msg.msg_hdr.msg_name = const_cast< asio::ip::udp::endpoint::data_type* >(target.data());
+            msg.msg_hdr.msg_namelen = static_cast< socklen_t >(target.size());
+            msg.msg_hdr.msg_iov = &buf;
+            msg.msg_hdr.msg_iovlen = 1u;
+        }
 
-        // The packet size is mandated in RFC3164, plus one for the terminating zero
-        char packet[1025];
-        int n = boost::core::snprintf
-        (
-            packet,
-            sizeof(packet),
-            "<%d>%s %2d %02d:%02d:%02d %s %s",
-            pri,
-            months[time_stamp->tm_mon],
-            time_stamp->tm_mday,
-            time_stamp->tm_hour,
-            time_stamp->tm_min,
-            time_stamp->tm_sec,
-            local_host_name,
-            message
-        );
-        if (BOOST_LIKELY(n > 0))
+        std::size_t sent = 0u;
+        while (sent < count)
+        {
+            const int res = ::sendmmsg(m_Socket.native_handle(), &m_Messages[sent], static_cast< unsigned int >(count - sent), 0);
+            if (BOOST_UNLIKELY(res < 0))
+            {
+                const int err = errno;
+                if (err == EINTR)
+                    continue;
+                BOOST_THROW_EXCEPTION(boost::system::system_error(err, boost::system::system_category(), "sendmmsg"));
+            }
+            sent += static_cast< unsigned int >(res);
+        }
+#else
+        for (std::size_t i = 0u; i < count; ++i)
         {
-            std::size_t packet_size = static_cast< std::size_t >(n) >= sizeof(packet) ? sizeof(packet) - 1u : static_cast< std::size_t >(n);
-            m_Socket.send_to(asio::buffer(packet, packet_size), target);
+            send_packet(target, packets, sizes[i]);
+            packets += sizes[i];
         }
+#endif
     }
 
 } // namespace
@@ -417,6 +476,9 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
 struct syslog_backend::implementation::udp_socket_based :
     public implementation
 {
+    //! The maximum packet size mandated in RFC3164
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_packet_size = 1024u;
+
     //! Protocol to be used
     asio::ip::udp m_Protocol;
     //! Pointer to the list of sockets
@@ -426,11 +488,25 @@ struct syslog_backend::implementation::udp_socket_based :
     //! The target host to send packets to
     asio::ip::udp::endpoint m_TargetHost;
 
+    //! The time for which the packet header is formatted
+    std::time_t m_HeaderTime;
+    //! The packet header that follows the priority value: the time stamp and the local host name
+    std::string m_Header;
+
+    //! The maximum number of packets in a batch
+    std::size_t m_MaxBatchSize;
+    //! The buffered packets, stored sequentially
+    std::vector< char > m_BatchBuffer;
+    //! Sizes of the buffered packets
+    std::vector< std::size_t > m_BatchPacketSizes;
+
     //! Constructor
     explicit udp_socket_based(syslog::facility const& fac, asio::ip::udp const& protocol) :
         implementation(fac),
         m_Protocol(protocol),
-        m_pService(syslog_udp_service::get())
+        m_pService(syslog_udp_service::get()),
+        m_HeaderTime(static_cast< std::time_t >(-1)),
+        m_MaxBatchSize(1u)
     {
         if (m_Protocol == asio::ip::udp::v4())
         {
@@ -446,6 +522,18 @@ struct syslog_backend::implementation::udp_socket_based :
         }
     }
 
+    //! Destructor
+    ~udp_socket_based() BOOST_OVERRIDE
+    {
+        try
+        {
+            send_batch();
+        }
+        catch (...)
+        {
+        }
+    }
+
     //! The method sends the formatted message to the syslog host
     void send(syslog::level lev, string_type const& formatted_message) BOOST_OVERRIDE
     {
@@ -455,11 +543,538 @@ struct syslog_backend::implementation::udp_socket_based :
             m_pSocket.reset(new syslog_udp_socket(m_pService->m_IOContext, m_Protocol, any_local_address));
         }
 
-        m_pSocket->send_message(
-            this->m_Facility | static_cast< int >(lev),
-            m_pService->m_LocalHostName.c_str(),
-            m_TargetHost,
-            formatted_message.c_str());
+        update_header();
+
+        if (m_MaxBatchSize <= 1u)
+        {
+            char packet[max_packet_size];
+            std::size_t packet_size = compose_packet(packet, this->m_Facility | static_cast< int >(lev), formatted_message);
+            m_pSocket->send_packet(m_TargetHost, packet, packet_size);
+        }
+        else
+        {
+            std::size_t offset = m_BatchBuffer.size();
+            m_BatchBuffer.resize(offset + max_packet_size);
+            std::size_t packet_size = compose_packet(&m_BatchBuffer[offset], this->m_Facility | static_cast< int >(lev), formatted_message);
+            m_BatchBuffer.resize(offset + packet_size);
+            m_BatchPacketSizes.push_back(packet_size);
+
+            if (m_BatchPacketSizes.size() >= m_MaxBatchSize)
+                send_batch();
+        }
+    }
+
+    //! The method sends the buffered packets
+    void flush() BOOST_OVERRIDE
+    {
+        send_batch();
+    }
+
+    //! Sets the maximum batch size
+    void set_max_batch_size(std::size_t max_batch_size)
+    {
+        if (max_batch_size <= m_BatchPacketSizes.size())
+            send_batch();
+        m_MaxBatchSize = max_batch_size;
+    }
+
+private:
+    //! Updates the cached packet header, if the time stamp has changed since the last update
+    void update_header()
+    {
+        std::time_t t = std::time(NULL);
+        if (BOOST_LIKELY(t == m_HeaderTime))
+            return;
+
+        std::tm ts;
+        std::tm* time_stamp = boost::date_time::c_time::localtime(&t, &ts);
+
+        // Month will have to be injected separately, as involving locale won't do here
+        static const char months[12][4] =
+        {
+            "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+        };
+
+        char header[max_packet_size];
+        int n = boost::core::snprintf
+        (
+            header,
+            sizeof(header),
+            "%s %2d %02d:%02d:%02d %s ",
+            months[time_stamp->tm_mon],
+            time_stamp->tm_mday,
+            time_stamp->tm_hour,
+            time_stamp->tm_min,
+            time_stamp->tm_sec,
+            m_pService->m_LocalHostName.c_str()
+        );
+        if (BOOST_LIKELY(n > 0))
+            m_Header.assign(header, static_cast< std::size_t >(n) >= sizeof(header) ? sizeof(header) - 1u : static_cast< std::size_t >(n));
+        else
+            m_Header.clear();
+
+        m_HeaderTime = t;
+    }
+
+    //! Composes the packet in the buffer of \c max_packet_size bytes, returns the packet size
+    std::size_t compose_packet(char* packet, int pri, string_type const& formatted_message) const
+    {
+        // The priority value is at most 3 digits
+        char* p = packet;
+        *p++ = '<';
+        unsigned int upri = static_cast< unsigned int >(pri);
+        if (upri >= 100u)
+            *p++ = static_cast< char >('0' + upri / 100u);
+        if (upri >= 10u)
+            *p++ = static_cast< char >('0' + (upri / 10u) % 10u);
+        *p++ = static_cast< char >('0' + upri % 10u);
+        *p++ = '>';
+
+        std::size_t size = static_cast< std::size_t >(p - packet);
+        std::size_t n = (std::min)(m_Header.size(), max_packet_size - size);
+        std::memcpy(packet + size, m_Header.data(), n);
+        size += n;
+
+        n = (std::min)(formatted_message.size(), max_packet_size - size);
+        std::memcpy(packet + size, formatted_message.data(), n);
+        size += n;
+
+        return size;
+    }
+
+    //! The method sends the buffered packets in a batch
+    void send_batch()
+    {
+        if (!m_BatchPacketSizes.empty())
+        {
+            try
+            {
+                m_pSocket->send_packets(m_TargetHost, m_BatchBuffer.data(), m_BatchPacketSizes.data(), m_BatchPacketSizes.size());
+            }
+            catch (...)
+            {
+                m_BatchBuffer.clear();
+                m_BatchPacketSizes.clear();
+                throw;
+            }
+
+            m_BatchBuffer.clear();
+            m_BatchPacketSizes.clear();
+        }
+    }
+};
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+    //! Returns a string with the characters not allowed in RFC5424 header fields replaced, or "-" if the string is empty
+    std::string make_header_field(std::string const& value, std::size_t max_size)
+    {
+        if (value.empty())
+            return std::string(1u, '-');
+
+        std::string field(value, 0u, (std::min)(value.size(), max_size));
+        for (std::string::iterator it = field.begin(), end = field.end(); it != end; ++it)
+        {
+            const unsigned char c = static_cast< unsigned char >(*it);
+            if (c < 33u || c > 126u)
+                *it = '_';
+        }
+
+        return field;
+    }
+
+} // namespace
+
+//! Stream socket-based implementation. Sends messages formatted according to RFC5424, with RFC6587 octet-counting framing.
+struct syslog_backend::implementation::stream_socket_based :
+    public implementation
+{
+    //! Socket protocol type
+    typedef asio::generic::stream_protocol protocol_type;
+    //! Clock used for reconnection scheduling
+    typedef std::chrono::steady_clock clock_type;
+
+    //! Connection states
+    enum connection_state
+    {
+        disconnected,
+        connecting,
+        connected
+    };
+
+    //! The maximum size of the messages retained while the connection is not established
+    static BOOST_CONSTEXPR_OR_CONST std::size_t max_buffer_size = 1024u * 1024u;
+    //! The maximum time to wait for the connection to be established when flushing the backend, in milliseconds
+    static BOOST_CONSTEXPR_OR_CONST int connect_timeout = 200;
+
+    //! Pointer to the service that provides the IO context and the local host name
+    shared_ptr< syslog_udp_service > m_pService;
+    //! Indicates that the backend uses TCP
+    const bool m_IsTCP;
+    //! IP protocol to use for address resolution, if the backend uses TCP
+    asio::ip::tcp m_IPProtocol;
+    //! The socket
+    protocol_type::socket m_Socket;
+    //! The target endpoint
+    protocol_type::endpoint m_TargetEndpoint;
+    //! Indicates that the target endpoint is specified
+    bool m_HasTargetEndpoint;
+    //! The local endpoint to bind the socket to, if specified
+    protocol_type::endpoint m_LocalEndpoint;
+    //! Indicates that the local endpoint is specified
+    bool m_HasLocalEndpoint;
+
+    //! Connection state
+    connection_state m_State;
+    //! The time point when the next connection attempt can be made
+    clock_type::time_point m_NextConnectTime;
+    //! The delay before the next connection attempt after a failure
+    clock_type::duration m_ReconnectDelay;
+
+    //! Framed messages that are not written yet
+    std::string m_Buffer;
+    //! End offsets of the messages in the buffer
+    std::vector< std::size_t > m_MessageEnds;
+    //! The maximum number of messages in a batch
+    std::size_t m_MaxBatchSize;
+
+    //! The time for which the time stamp is formatted
+    std::time_t m_TimeStampTime;
+    //! The time stamp, up to seconds
+    char m_TimeStamp[20];
+    //! The static part of the message header that follows the time stamp
+    std::string m_HeaderSuffix;
+
+    //! Constructor
+    stream_socket_based(syslog::facility const& fac, bool is_tcp, asio::ip::tcp const& ip_protocol, std::string const& ident) :
+        implementation(fac),
+        m_pService(syslog_udp_service::get()),
+        m_IsTCP(is_tcp),
+        m_IPProtocol(ip_protocol),
+        m_Socket(m_pService->m_IOContext),
+        m_HasTargetEndpoint(is_tcp),
+        m_HasLocalEndpoint(false),
+        m_State(disconnected),
+        m_ReconnectDelay(min_reconnect_delay()),
+        m_MaxBatchSize(1u),
+        m_TimeStampTime(static_cast< std::time_t >(-1))
+    {
+        if (m_IsTCP)
+        {
+            if (m_IPProtocol == asio::ip::tcp::v4())
+            {
+                m_TargetEndpoint = asio::ip::tcp::endpoint(asio::ip::address_v4(0x7F000001), 514); // 127.0.0.1:514
+            }
+            else
+            {
+                // ::1, port 514
+                asio::ip::address_v6::bytes_type addr;
+                std::fill_n(addr.data(), addr.size() - 1u, static_cast< unsigned char >(0u));
+                addr[addr.size() - 1u] = 1u;
+                m_TargetEndpoint = asio::ip::tcp::endpoint(asio::ip::address_v6(addr), 514);
+            }
+        }
+
+        m_TimeStamp[0] = '\0';
+
+        // HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA
+        m_HeaderSuffix.push_back(' ');
+        m_HeaderSuffix.append(make_header_field(m_pService->m_LocalHostName, 255u));
+        m_HeaderSuffix.push_back(' ');
+        m_HeaderSuffix.append(make_header_field(ident, 48u));
+
+        char pid[std::numeric_limits< unsigned long >::digits10 + 3];
+        int n = boost::core::snprintf(pid, sizeof(pid), " %lu - - ", static_cast< unsigned long >(log::aux::this_process::get_id().native_id()));
+        if (BOOST_LIKELY(n > 0))
+            m_HeaderSuffix.append(pid, (std::min)(static_cast< std::size_t >(n), sizeof(pid) - 1u));
+    }
+
+    //! Destructor
+    ~stream_socket_based() BOOST_OVERRIDE
+    {
+        try
+        {
+            write_buffer(true);
+        }
+        catch (...)
+        {
+        }
+
+        boost::system::error_code ec;
+        m_Socket.close(ec);
+    }
+
+    //! The method sends the formatted message to the syslog host
+    void send(syslog::level lev, string_type const& formatted_message) BOOST_OVERRIDE
+    {
+        // Local syslog daemons commonly listen on datagram sockets, such as "/dev/log", so there is no sensible default path
+        if (BOOST_UNLIKELY(!m_HasTargetEndpoint))
+            BOOST_LOG_THROW_DESCR(setup_error, "The path of the local syslog socket is not specified");
+
+        std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+        std::time_t t = std::chrono::system_clock::to_time_t(now);
+        if (t != m_TimeStampTime)
+            update_time_stamp(t);
+
+        unsigned int usec = static_cast< unsigned int >(std::chrono::duration_cast< std::chrono::microseconds >(now - std::chrono::system_clock::from_time_t(t)).count() % 1000000);
+
+        // <PRI>1 YYYY-MM-DDThh:mm:ss.uuuuuuZ HOSTNAME APP-NAME PROCID - - MSG
+        char header[64];
+        int n = boost::core::snprintf(header, sizeof(header), "<%d>1 %s.%06uZ", this->m_Facility | static_cast< int >(lev), m_TimeStamp, usec);
+        if (BOOST_UNLIKELY(n <= 0))
+            return;
+        const std::size_t header_size = (std::min)(static_cast< std::size_t >(n), sizeof(header) - 1u);
+        const std::size_t message_size = header_size + m_HeaderSuffix.size() + formatted_message.size();
+
+        char length[std::numeric_limits< std::size_t >::digits10 + 3];
+        n = boost::core::snprintf(length, sizeof(length), "%lu ", static_cast< unsigned long >(message_size));
+        const std::size_t length_size = (std::min)(static_cast< std::size_t >(n), sizeof(length) - 1u);
+
+        if (BOOST_UNLIKELY((m_Buffer.size() + length_size + message_size) > max_buffer_size && !m_Buffer.empty()))
+        {
+            write_buffer();
+            if ((m_Buffer.size() + length_size + message_size) > max_buffer_size)
+                BOOST_LOG_THROW_DESCR(limitation_error, "Syslog message buffer overflow, the connection to the syslog server is not established");
+        }
+
+        m_Buffer.reserve(m_Buffer.size() + length_size + message_size);
+        m_Buffer.append(length, length_size);
+        m_Buffer.append(header, header_size);
+        m_Buffer.append(m_HeaderSuffix);
+        m_Buffer.append(formatted_message);
+        m_MessageEnds.push_back(m_Buffer.size());
+
+        if (m_MessageEnds.size() >= m_MaxBatchSize)
+            write_buffer();
+    }
+
+    //! The method sends the buffered messages
+    void flush() BOOST_OVERRIDE
+    {
+        write_buffer(true);
+    }
+
+    //! Sets the maximum batch size
+    void set_max_batch_size(std::size_t max_batch_size)
+    {
+        m_MaxBatchSize = max_batch_size;
+        if (max_batch_size <= m_MessageEnds.size())
+            write_buffer();
+    }
+
+    //! Sets the local endpoint to bind the socket to
+    void set_local_endpoint(protocol_type::endpoint const& ep)
+    {
+        m_LocalEndpoint = ep;
+        m_HasLocalEndpoint = true;
+        reset_connection();
+    }
+
+    //! Sets the target endpoint
+    void set_target_endpoint(protocol_type::endpoint const& ep)
+    {
+        m_TargetEndpoint = ep;
+        m_HasTargetEndpoint = true;
+        reset_connection();
+    }
+
+    //! Sets the local socket path
+    void set_target_path(std::string const& path)
+    {
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        set_target_endpoint(asio::local::stream_protocol::endpoint(path));
+#else
+        (void)path;
+        BOOST_LOG_THROW_DESCR(setup_error, "Local sockets are not supported on this platform");
+#endif
+    }
+
+private:
+    //! Returns the initial reconnection delay
+    static clock_type::duration min_reconnect_delay() BOOST_NOEXCEPT
+    {
+        return std::chrono::milliseconds(100);
+    }
+    //! Returns the maximum reconnection delay
+    static clock_type::duration max_reconnect_delay() BOOST_NOEXCEPT
+    {
+        return std::chrono::seconds(10);
+    }
+
+    //! Updates the time stamp for the given time
+    void update_time_stamp(std::time_t t)
+    {
+        std::tm ts;
+        std::tm* time_stamp = boost::date_time::c_time::gmtime(&t, &ts);
+        boost::core::snprintf
+        (
+            m_TimeStamp,
+            sizeof(m_TimeStamp),
+            "%04u-%02u-%02uT%02u:%02u:%02u",
+            static_cast< unsigned int >(time_stamp->tm_year + 1900) % 10000u,
+            static_cast< unsigned int >(time_stamp->tm_mon + 1) % 100u,
+            static_cast< unsigned int >(time_stamp->tm_mday) % 100u,
+            static_cast< unsigned int >(time_stamp->tm_hour) % 100u,
+            static_cast< unsigned int >(time_stamp->tm_min) % 100u,
+            static_cast< unsigned int >(time_stamp->tm_sec) % 100u
+        );
+        m_TimeStampTime = t;
+    }
+
+    //! Closes the current connection so that the next write establishes a new one
+    void reset_connection()
+    {
+        try
+        {
+            write_buffer(true);
+        }
+        catch (...)
+        {
+        }
+
+        close_socket();
+        m_NextConnectTime = clock_type::time_point();
+        m_ReconnectDelay = min_reconnect_delay();
+    }
+
+    //! Closes the socket
+    void close_socket() BOOST_NOEXCEPT
+    {
+        boost::system::error_code ec;
+        m_Socket.close(ec);
+        m_State = disconnected;
+    }
+
+    //! Closes the socket and schedules the next connection attempt after a failure
+    BOOST_NORETURN void connection_failed(boost::system::error_code const& err)
+    {
+        close_socket();
+        m_NextConnectTime = clock_type::now() + m_ReconnectDelay;
+        m_ReconnectDelay = (std::min)(m_ReconnectDelay * 2, max_reconnect_delay());
+        BOOST_THROW_EXCEPTION(boost::system::system_error(err, "Failed to connect to the syslog server"));
+    }
+
+    /*!
+     * Attempts to establish the connection. Returns \c true if the connection is established. If the connection cannot be
+     * established immediately, only waits for it if \a wait is \c true. Otherwise the connection attempt continues
+     * in background and its completion is checked on the next call.
+     */
+    bool connect(bool wait)
+    {
+        if (m_State == disconnected)
+        {
+            if (clock_type::now() < m_NextConnectTime)
+                return false;
+
+            boost::system::error_code ec;
+            m_Socket.open(m_TargetEndpoint.protocol(), ec);
+            if (!ec && m_HasLocalEndpoint)
+                m_Socket.bind(m_LocalEndpoint, ec);
+            if (ec)
+                connection_failed(ec);
+
+#if !defined(BOOST_WINDOWS)
+            m_Socket.non_blocking(true, ec);
+            if (ec)
+                connection_failed(ec);
+
+            if (::connect(m_Socket.native_handle(), m_TargetEndpoint.data(), static_cast< socklen_t >(m_TargetEndpoint.size())) != 0)
+            {
+                const int err = errno;
+                if (err != EINPROGRESS && err != EINTR)
+                    connection_failed(boost::system::error_code(err, boost::system::system_category()));
+
+                m_State = connecting;
+            }
+#else
+            m_Socket.connect(m_TargetEndpoint, ec);
+            if (ec)
+                connection_failed(ec);
+#endif
+        }
+
+#if !defined(BOOST_WINDOWS)
+        if (m_State == connecting)
+        {
+            // Check if the connection has completed. Don't block the logging thread when sending log records,
+            // and don't block for long if the server is slow to respond when flushing.
+            struct pollfd pfd = {};
+            pfd.fd = m_Socket.native_handle();
+            pfd.events = POLLOUT;
+            const int res = ::poll(&pfd, 1, wait ? connect_timeout : 0);
+            if (res == 0)
+                return false;
+            if (res < 0)
+            {
+                const int err = errno;
+                if (err == EINTR)
+                    return false;
+                connection_failed(boost::system::error_code(err, boost::system::system_category()));
+            }
+
+            int err = 0;
+            socklen_t err_size = sizeof(err);
+            if (::getsockopt(m_Socket.native_handle(), SOL_SOCKET, SO_ERROR, &err, &err_size) != 0)
+                err = errno;
+            if (err != 0)
+                connection_failed(boost::system::error_code(err, boost::system::system_category()));
+        }
+
+        boost::system::error_code ec;
+        m_Socket.non_blocking(false, ec);
+        if (ec)
+            connection_failed(ec);
+#endif
+
+        m_State = connected;
+        m_ReconnectDelay = min_reconnect_delay();
+        return true;
+    }
+
+    //! Writes the buffered messages to the connection. If \a wait is \c true, waits for the connection to be established.
+    void write_buffer(bool wait = false)
+    {
+        // If the connection breaks, reconnect and try again once, as the server may have been restarted
+        for (unsigned int attempt = 0u; !m_Buffer.empty(); ++attempt)
+        {
+            if (m_State != connected && !connect(wait))
+                return;
+
+            std::size_t written = 0u;
+            boost::system::error_code ec;
+            while (written < m_Buffer.size())
+            {
+                written += m_Socket.write_some(asio::buffer(m_Buffer.data() + written, m_Buffer.size() - written), ec);
+                if (BOOST_UNLIKELY(!!ec))
+                {
+                    if (ec == asio::error::interrupted)
+                    {
+                        ec.clear();
+                        continue;
+                    }
+                    break;
+                }
+            }
+
+            if (BOOST_LIKELY(!ec))
+            {
+                m_Buffer.clear();
+                m_MessageEnds.clear();
+                return;
+            }
+
+            // Drop the messages that have been written completely. The partially written message will be sent again.
+            std::vector< std::size_t >::iterator it = std::upper_bound(m_MessageEnds.begin(), m_MessageEnds.end(), written);
+            const std::size_t written_messages_size = it != m_MessageEnds.begin() ? *(it - 1) : 0u;
+            m_MessageEnds.erase(m_MessageEnds.begin(), it);
+            for (it = m_MessageEnds.begin(); it != m_MessageEnds.end(); ++it)
+                *it -= written_messages_size;
+            m_Buffer.erase(0u, written_messages_size);
+
+            close_socket();
+            if (attempt > 0u)
+                connection_failed(ec);
+        }
     }
 };
 
@@ -493,6 +1108,12 @@ BOOST_LOG_API void syslog_backend::consume(record_view const& rec, string_type c
         formatted_message);
 }
 
+//! The method sends the log records that may have been accumulated in the current batch
+BOOST_LOG_API void syslog_backend::flush()
+{
+    m_pImpl->flush();
+}
+
 
 //! The method creates the backend implementation
 BOOST_LOG_API void syslog_backend::construct(syslog::facility fac, syslog::impl_types use_impl, ip_versions ip_version, std::string const& ident)
@@ -507,7 +1128,6 @@ BOOST_LOG_API void syslog_backend::construct(syslog::facility fac, syslog::impl_
 #endif // BOOST_LOG_USE_NATIVE_SYSLOG
 
 #if !defined(BOOST_LOG_NO_ASIO)
-    typedef implementation::udp_socket_based udp_socket_based_impl;
     asio::ip::udp protocol = asio::ip::udp::v4();
     switch (ip_version)
     {
@@ -520,37 +1140,76 @@ BOOST_LOG_API void syslog_backend::construct(syslog::facility fac, syslog::impl_
         BOOST_LOG_THROW_DESCR(setup_error, "Incorrect IP version specified");
     }
 
-    m_pImpl = new udp_socket_based_impl(fac, protocol);
+    switch (use_impl)
+    {
+    case syslog::tcp_socket_based:
+    case syslog::local_socket_based:
+        {
+            typedef implementation::stream_socket_based stream_socket_based_impl;
+            m_pImpl = new stream_socket_based_impl(fac, use_impl == syslog::tcp_socket_based, ip_version == v4 ? asio::ip::tcp::v4() : asio::ip::tcp::v6(), ident);
+        }
+        break;
+
+    default:
+        {
+            typedef implementation::udp_socket_based udp_socket_based_impl;
+            m_pImpl = new udp_socket_based_impl(fac, protocol);
+        }
+        break;
+    }
 #endif
 }
 
 #if !defined(BOOST_LOG_NO_ASIO)
 
+#if !defined(BOOST_LOG_NO_THREADS)
+
+BOOST_LOG_ANONYMOUS_NAMESPACE {
+
+    //! Resolves the host name and port to an endpoint
+    template< typename ProtocolT >
+    typename ProtocolT::endpoint resolve_address(syslog_udp_service& service, ProtocolT const& protocol, std::string const& addr, unsigned short port, asio::ip::resolver_base::flags flags)
+    {
+        char service_name[std::numeric_limits< unsigned int >::digits10 + 3];
+        boost::core::snprintf(service_name, sizeof(service_name), "%u", static_cast< unsigned int >(port));
+
+        std::lock_guard< std::mutex > lock(service.m_Mutex);
+        typename ProtocolT::resolver::results_type results = service.get_resolver(protocol).resolve
+        (
+            protocol,
+            addr,
+            service_name,
+            flags
+        );
+
+        return *results.cbegin();
+    }
+
+} // namespace
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
 //! The method sets the local address which log records will be sent from.
 BOOST_LOG_API void syslog_backend::set_local_address(std::string const& addr, unsigned short port)
 {
 #if !defined(BOOST_LOG_NO_THREADS)
     typedef implementation::udp_socket_based udp_socket_based_impl;
+    typedef implementation::stream_socket_based stream_socket_based_impl;
     if (udp_socket_based_impl* impl = dynamic_cast< udp_socket_based_impl* >(m_pImpl))
     {
-        char service_name[std::numeric_limits< unsigned int >::digits10 + 3];
-        boost::core::snprintf(service_name, sizeof(service_name), "%u", static_cast< unsigned int >(port));
+        asio::ip::udp::endpoint local_address = resolve_address(*impl->m_pService, impl->m_Protocol, addr, port,
+            asio::ip::resolver_base::address_configured | asio::ip::resolver_base::passive);
 
-        asio::ip::udp::endpoint local_address;
+        impl->flush();
+        impl->m_pSocket.reset(new syslog_udp_socket(impl->m_pService->m_IOContext, impl->m_Protocol, local_address));
+    }
+    else if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        if (impl->m_IsTCP)
         {
-            std::lock_guard< std::mutex > lock(impl->m_pService->m_Mutex);
-            asio::ip::udp::resolver::results_type results = impl->m_pService->m_HostNameResolver.resolve
-            (
-                impl->m_Protocol,
-                addr,
-                service_name,
-                asio::ip::resolver_base::address_configured | asio::ip::resolver_base::passive
-            );
-
-            local_address = *results.cbegin();
+            impl->set_local_endpoint(resolve_address(*impl->m_pService, impl->m_IPProtocol, addr, port,
+                asio::ip::resolver_base::address_configured | asio::ip::resolver_base::passive));
         }
-
-        impl->m_pSocket.reset(new syslog_udp_socket(impl->m_pService->m_IOContext, impl->m_Protocol, local_address));
     }
 #else
     // Boost.ASIO requires threads for the host name resolver,
@@ -562,14 +1221,26 @@ BOOST_LOG_API void syslog_backend::set_local_address(std::string const& addr, un
 BOOST_LOG_API void syslog_backend::set_local_address(boost::asio::ip::address const& addr, unsigned short port)
 {
     typedef implementation::udp_socket_based udp_socket_based_impl;
+    typedef implementation::stream_socket_based stream_socket_based_impl;
     if (udp_socket_based_impl* impl = dynamic_cast< udp_socket_based_impl* >(m_pImpl))
     {
         if ((impl->m_Protocol == asio::ip::udp::v4() && !addr.is_v4()) || (impl->m_Protocol == asio::ip::udp::v6() && !addr.is_v6()))
             BOOST_LOG_THROW_DESCR(setup_error, "Incorrect IP version specified in the local address");
 
+        impl->flush();
         impl->m_pSocket.reset(new syslog_udp_socket(
             impl->m_pService->m_IOContext, impl->m_Protocol, asio::ip::udp::endpoint(addr, port)));
     }
+    else if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        if (impl->m_IsTCP)
+        {
+            if ((impl->m_IPProtocol == asio::ip::tcp::v4() && !addr.is_v4()) || (impl->m_IPProtocol == asio::ip::tcp::v6() && !addr.is_v6()))
+                BOOST_LOG_THROW_DESCR(setup_error, "Incorrect IP version specified in the local address");
+
+            impl->set_local_endpoint(asio::ip::tcp::endpoint(addr, port));
+        }
+    }
 }
 
 //! The method sets the address of the remote host where log records will be sent to.
@@ -577,26 +1248,22 @@ BOOST_LOG_API void syslog_backend::set_target_address(std::string const& addr, u
 {
 #if !defined(BOOST_LOG_NO_THREADS)
     typedef implementation::udp_socket_based udp_socket_based_impl;
+    typedef implementation::stream_socket_based stream_socket_based_impl;
     if (udp_socket_based_impl* impl = dynamic_cast< udp_socket_based_impl* >(m_pImpl))
     {
-        char service_name[std::numeric_limits< unsigned int >::digits10 + 3];
-        boost::core::snprintf(service_name, sizeof(service_name), "%u", static_cast< unsigned int >(port));
+        asio::ip::udp::endpoint remote_address = resolve_address(*impl->m_pService, impl->m_Protocol, addr, port,
+            asio::ip::resolver_query_base::address_configured);
 
-        asio::ip::udp::endpoint remote_address;
+        impl->flush();
+        impl->m_TargetHost = remote_address;
+    }
+    else if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        if (impl->m_IsTCP)
         {
-            std::lock_guard< std::mutex > lock(impl->m_pService->m_Mutex);
-            asio::ip::udp::resolver::results_type results = impl->m_pService->m_HostNameResolver.resolve
-            (
-                impl->m_Protocol,
-                addr,
-                service_name,
-                asio::ip::resolver_query_base::address_configured
-            );
-
-            remote_address = *results.cbegin();
+            impl->set_target_endpoint(resolve_address(*impl->m_pService, impl->m_IPProtocol, addr, port,
+                asio::ip::resolver_query_base::address_configured));
         }
-
-        impl->m_TargetHost = remote_address;
     }
 #else
     // Boost.ASIO requires threads for the host name resolver,
@@ -608,13 +1275,51 @@ BOOST_LOG_API void syslog_backend::set_target_address(std::string const& addr, u
 BOOST_LOG_API void syslog_backend::set_target_address(boost::asio::ip::address const& addr, unsigned short port)
 {
     typedef implementation::udp_socket_based udp_socket_based_impl;
+    typedef implementation::stream_socket_based stream_socket_based_impl;
     if (udp_socket_based_impl* impl = dynamic_cast< udp_socket_based_impl* >(m_pImpl))
     {
         if ((impl->m_Protocol == asio::ip::udp::v4() && !addr.is_v4()) || (impl->m_Protocol == asio::ip::udp::v6() && !addr.is_v6()))
             BOOST_LOG_THROW_DESCR(setup_error, "Incorrect IP version specified in the target address");
 
+        impl->flush();
         impl->m_TargetHost = asio::ip::udp::endpoint(addr, port);
     }
+    else if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        if (impl->m_IsTCP)
+        {
+            if ((impl->m_IPProtocol == asio::ip::tcp::v4() && !addr.is_v4()) || (impl->m_IPProtocol == asio::ip::tcp::v6() && !addr.is_v6()))
+                BOOST_LOG_THROW_DESCR(setup_error, "Incorrect IP version specified in the target address");
+
+            impl->set_target_endpoint(asio::ip::tcp::endpoint(addr, port));
+        }
+    }
+}
+
+//! The method sets the path of the local socket where log records will be sent to
+BOOST_LOG_API void syslog_backend::set_target_path(std::string const& path)
+{
+    typedef implementation::stream_socket_based stream_socket_based_impl;
+    if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        if (!impl->m_IsTCP)
+            impl->set_target_path(path);
+    }
+}
+
+//! The method sets the maximum number of log records that can be sent to the syslog server in a single batch
+BOOST_LOG_API void syslog_backend::set_max_batch_size(std::size_t max_batch_size)
+{
+    typedef implementation::udp_socket_based udp_socket_based_impl;
+    typedef implementation::stream_socket_based stream_socket_based_impl;
+    if (udp_socket_based_impl* impl = dynamic_cast< udp_socket_based_impl* >(m_pImpl))
+    {
+        impl->set_max_batch_size(max_batch_size);
+    }
+    else if (stream_socket_based_impl* impl = dynamic_cast< stream_socket_based_impl* >(m_pImpl))
+    {
+        impl->set_max_batch_size(max_batch_size);
+    }
 }
 
 #endif // !defined(BOOST_LOG_NO_ASIO)
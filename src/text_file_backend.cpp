@@ -18,11 +18,15 @@
 #include <cctype>
 #include <cwctype>
 #include <ctime>
+#include <chrono>
+#include <memory>
 #include <cstdio>
 #include <cstdlib>
 #include <cstddef>
+#include <climits>
 #include <limits>
 #include <list>
+#include <map>
 #include <string>
 #include <locale>
 #include <ostream>
@@ -30,6 +34,7 @@
 #include <iterator>
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 #include <boost/core/ref.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/optional/optional.hpp>
@@ -37,6 +42,7 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/system/system_error.hpp>
 #include <boost/filesystem/directory.hpp>
@@ -48,6 +54,7 @@
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/options.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
 #include <boost/date_time/gregorian/gregorian_types.hpp>
 #include <boost/spirit/home/qi/numeric/numeric_utils.hpp>
 #include <boost/log/detail/singleton.hpp>
@@ -57,8 +64,31 @@
 #include <boost/log/sinks/auto_newline_mode.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
 
+#if defined(BOOST_POSIX_API) && (defined(__linux__) || defined(__APPLE__))
+#include <sys/stat.h>
+#include <cerrno>
+#define BOOST_LOG_HAS_PRECISE_MODIFICATION_TIME
+#endif
+
+#if defined(BOOST_POSIX_API)
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#define BOOST_LOG_HAS_FILE_SYNC
+#if defined(__linux__) || (defined(_POSIX_SYNCHRONIZED_IO) && _POSIX_SYNCHRONIZED_IO > 0 && !defined(__APPLE__))
+#define BOOST_LOG_HAS_FDATASYNC
+#endif
+#if !defined(O_CLOEXEC)
+#define O_CLOEXEC 0
+#endif
+#endif // defined(BOOST_POSIX_API)
+
 #if !defined(BOOST_LOG_NO_THREADS)
+#include <deque>
 #include <mutex>
+#include <thread>
+#include <exception>
+#include <condition_variable>
 #endif // !defined(BOOST_LOG_NO_THREADS)
 
 #include <boost/log/detail/header.hpp>
@@ -101,6 +131,28 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
 #endif
     }
 
+    //! Returns the file modification time, with the best precision supported by the platform
+    inline uintmax_t get_modification_time(filesystem::path const& p, system::error_code& ec)
+    {
+#if defined(BOOST_LOG_HAS_PRECISE_MODIFICATION_TIME)
+        struct stat st;
+        if (::stat(p.c_str(), &st) != 0)
+        {
+            ec.assign(errno, system::generic_category());
+            return 0u;
+        }
+
+        ec.clear();
+#if defined(__APPLE__)
+        return static_cast< uintmax_t >(st.st_mtimespec.tv_sec) * 1000000000u + static_cast< uintmax_t >(st.st_mtimespec.tv_nsec);
+#else
+        return static_cast< uintmax_t >(st.st_mtim.tv_sec) * 1000000000u + static_cast< uintmax_t >(st.st_mtim.tv_nsec);
+#endif
+#else
+        return static_cast< uintmax_t >(filesystem::last_write_time(p, ec));
+#endif
+    }
+
     typedef filesystem::path::string_type path_string_type;
     typedef path_string_type::value_type path_char_type;
 
@@ -634,6 +686,400 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
     }
 
 
+    //! Persistent index of the files in the target directory of a file collector
+    /*!
+     * The index is a journal file in the target directory. Every change made to the directory by the collector
+     * is appended to the journal, followed by a synchronization record that contains the directory modification
+     * time after the change. The journal is only trusted if the directory modification time still matches
+     * the last synchronization record, otherwise the directory is considered to be modified by a third party
+     * and has to be scanned. When the index is loaded, the recorded sizes and modification times of the files
+     * are also verified, which detects the files that were rewritten in place while the collector was not running.
+     * Such modifications made while the index is in use do not change the directory modification time and are
+     * not detected.
+     *
+     * File names are stored as native path strings, without character code conversion. Control characters,
+     * backslashes and, for wide character paths, non-ASCII characters are written as escape sequences
+     * with the hexadecimal character codes.
+     */
+    class file_collector_index
+    {
+    public:
+        //! Information about an indexed file
+        struct entry
+        {
+            uintmax_t m_Size;
+            std::time_t m_TimeStamp;
+        };
+        //! Indexed files, by file name
+        typedef std::map< path_string_type, entry > entries;
+
+    private:
+        //! Directory which is indexed
+        filesystem::path m_Dir;
+        //! Index file name
+        filesystem::path m_Path;
+        //! Index file stream, open only while the index is valid
+        filesystem::ofstream m_File;
+        //! Indexed files
+        entries m_Entries;
+        //! Directory modification time as of the last synchronization record
+        uintmax_t m_DirTimeStamp;
+        //! Number of records in the index file
+        uintmax_t m_RecordCount;
+
+    public:
+        file_collector_index() : m_DirTimeStamp(0u), m_RecordCount(0u)
+        {
+        }
+
+        //! Returns the index file name
+        static path_string_type const& file_name()
+        {
+            static const path_string_type name = filesystem::path(".boost_log_collector_index").native();
+            return name;
+        }
+
+        //! Tests if the file is the index file or its temporary copy and should not be treated as a log file
+        static bool is_index_file(path_string_type const& name)
+        {
+            path_string_type const& index_name = file_name();
+            return name.size() >= index_name.size() && name.compare(0u, index_name.size(), index_name) == 0;
+        }
+
+        //! Loads the index of the directory
+        void open(filesystem::path const& dir)
+        {
+            m_Dir = dir;
+            m_Path = dir / file_name();
+            try
+            {
+                if (load())
+                {
+                    m_File.open(m_Path, std::ios_base::out | std::ios_base::app);
+                    if (!m_File.is_open())
+                        invalidate();
+                }
+            }
+            catch (...)
+            {
+                invalidate();
+            }
+        }
+
+        //! Returns the indexed files
+        entries const& get_entries() const BOOST_NOEXCEPT { return m_Entries; }
+
+        //! Checks that the index exists and the directory was not modified since the last synchronization record
+        bool is_up_to_date()
+        {
+            if (m_File.is_open())
+            {
+                system::error_code ec;
+                const uintmax_t dir_time = get_modification_time(m_Dir, ec);
+                if (!ec && dir_time == m_DirTimeStamp)
+                    return true;
+
+                invalidate();
+            }
+
+            return false;
+        }
+
+        //! Replaces the index contents with the result of a directory scan
+        void reset(entries& files)
+        {
+            invalidate();
+            m_Entries.swap(files);
+            try
+            {
+                rewrite();
+            }
+            catch (...)
+            {
+                invalidate();
+            }
+        }
+
+        //! Records a file added to the directory
+        void add(path_string_type const& name, uintmax_t size, std::time_t time_stamp)
+        {
+            if (m_File.is_open())
+            {
+                entry& e = m_Entries[name];
+                e.m_Size = size;
+                e.m_TimeStamp = time_stamp;
+                write_entry(name, e);
+                ++m_RecordCount;
+            }
+        }
+
+        //! Records a file removed from the directory
+        void remove(path_string_type const& name)
+        {
+            if (m_File.is_open())
+            {
+                m_Entries.erase(name);
+                std::string str;
+                encode_name(name, str);
+                m_File << "- " << str << '\n';
+                ++m_RecordCount;
+            }
+        }
+
+        //! Appends the synchronization record after the changes to the directory have been recorded
+        void commit()
+        {
+            if (m_File.is_open())
+            {
+                try
+                {
+                    // Compact the journal once it becomes mostly obsolete records
+                    if (m_RecordCount > 64u + m_Entries.size() * 2u)
+                        rewrite();
+                    else
+                        write_sync_record();
+                }
+                catch (...)
+                {
+                    invalidate();
+                }
+            }
+        }
+
+        //! Marks the index as not reflecting the directory contents
+        void invalidate()
+        {
+            if (m_File.is_open())
+                m_File.close();
+            m_File.clear();
+            m_Entries.clear();
+            m_RecordCount = 0u;
+        }
+
+    private:
+        //! Writes a record for the file
+        void write_entry(path_string_type const& name, entry const& e)
+        {
+            std::string str;
+            encode_name(name, str);
+            m_File << "+ " << e.m_Size << ' ' << static_cast< long long >(e.m_TimeStamp) << ' ' << str << '\n';
+        }
+
+        //! Converts the native file name to the representation in the index file
+        static void encode_name(path_string_type const& name, std::string& str)
+        {
+            typedef path_string_type::value_type char_type;
+            str.clear();
+            str.reserve(name.size());
+            for (path_string_type::const_iterator it = name.begin(), end = name.end(); it != end; ++it)
+            {
+                const char_type c = *it;
+                const uintmax_t code = static_cast< uintmax_t >(static_cast< boost::make_unsigned< char_type >::type >(c));
+                if (code < 0x20u || c == static_cast< char_type >('\\') || (sizeof(char_type) > 1u && code > 0x7eu))
+                {
+                    // Escape as \xHH...H with the number of hexadecimal digits given by the character size
+                    static const char hex_digits[] = "0123456789abcdef";
+                    str.push_back('\\');
+                    str.push_back('x');
+                    for (unsigned int shift = sizeof(char_type) * CHAR_BIT; shift > 0u;)
+                    {
+                        shift -= 4u;
+                        str.push_back(hex_digits[(code >> shift) & 15u]);
+                    }
+                }
+                else
+                {
+                    str.push_back(static_cast< char >(c));
+                }
+            }
+        }
+
+        //! Converts the file name from the representation in the index file to the native file name, returns \c false if the name is not valid
+        static bool decode_name(const char* p, path_string_type& name)
+        {
+            typedef path_string_type::value_type char_type;
+            name.clear();
+            while (*p != '\0')
+            {
+                if (*p != '\\')
+                {
+                    name.push_back(static_cast< char_type >(static_cast< unsigned char >(*p)));
+                    ++p;
+                    continue;
+                }
+
+                if (p[1] != 'x')
+                    return false;
+                p += 2;
+
+                uintmax_t code = 0u;
+                for (unsigned int i = 0u; i < sizeof(char_type) * 2u; ++i, ++p)
+                {
+                    const char c = *p;
+                    unsigned int digit;
+                    if (c >= '0' && c <= '9')
+                        digit = static_cast< unsigned int >(c - '0');
+                    else if (c >= 'a' && c <= 'f')
+                        digit = static_cast< unsigned int >(c - 'a' + 10);
+                    else
+                        return false;
+                    code = (code << 4u) | digit;
+                }
+                name.push_back(static_cast< char_type >(code));
+            }
+
+            return !name.empty();
+        }
+
+        //! Writes the synchronization record
+        void write_sync_record()
+        {
+            system::error_code ec;
+            m_DirTimeStamp = get_modification_time(m_Dir, ec);
+            if (BOOST_UNLIKELY(!!ec))
+            {
+                invalidate();
+                return;
+            }
+
+            m_File << "= " << m_DirTimeStamp << '\n';
+            m_File.flush();
+            ++m_RecordCount;
+            if (BOOST_UNLIKELY(!m_File.good()))
+                invalidate();
+        }
+
+        //! Writes the complete index file anew and replaces the previous index with it
+        void rewrite()
+        {
+            if (m_File.is_open())
+                m_File.close();
+            m_File.clear();
+            m_RecordCount = 0u;
+
+            filesystem::path tmp_path = m_Path;
+            tmp_path += ".tmp";
+            m_File.open(tmp_path, std::ios_base::out | std::ios_base::trunc);
+            if (!m_File.is_open())
+            {
+                invalidate();
+                return;
+            }
+
+            m_File << "boost_log_collector_index 2\n";
+            for (entries::const_iterator it = m_Entries.begin(), end = m_Entries.end(); it != end; ++it)
+            {
+                write_entry(it->first, it->second);
+                ++m_RecordCount;
+            }
+
+            m_File.close();
+            if (BOOST_UNLIKELY(!m_File))
+            {
+                invalidate();
+                return;
+            }
+
+            filesystem::rename(tmp_path, m_Path);
+
+            // The rename has modified the directory, the synchronization record will account for that
+            m_File.clear();
+            m_File.open(m_Path, std::ios_base::out | std::ios_base::app);
+            if (!m_File.is_open())
+            {
+                invalidate();
+                return;
+            }
+
+            write_sync_record();
+        }
+
+        //! Reads the index file, returns \c true if the index is valid
+        bool load()
+        {
+            m_Entries.clear();
+            m_RecordCount = 0u;
+
+            filesystem::ifstream file(m_Path);
+            if (!file.is_open())
+                return false;
+
+            std::string line;
+            if (!std::getline(file, line) || line != "boost_log_collector_index 2")
+                return false;
+
+            path_string_type name;
+            bool synchronized = false;
+            while (std::getline(file, line))
+            {
+                if (line.size() < 3u || line[1] != ' ')
+                    return false;
+
+                const char* p = line.c_str() + 2;
+                char* end = NULL;
+                switch (line[0])
+                {
+                case '+':
+                    {
+                        entry e;
+                        e.m_Size = static_cast< uintmax_t >(std::strtoull(p, &end, 10));
+                        if (end == p || *end != ' ')
+                            return false;
+                        p = end + 1;
+                        e.m_TimeStamp = static_cast< std::time_t >(std::strtoll(p, &end, 10));
+                        if (end == p || *end != ' ' || !decode_name(end + 1, name))
+                            return false;
+                        m_Entries[name] = e;
+                        synchronized = false;
+                    }
+                    break;
+
+                case '-':
+                    if (!decode_name(p, name))
+                        return false;
+                    m_Entries.erase(name);
+                    synchronized = false;
+                    break;
+
+                case '=':
+                    m_DirTimeStamp = static_cast< uintmax_t >(std::strtoull(p, &end, 10));
+                    if (end == p || *end != '\0')
+                        return false;
+                    synchronized = true;
+                    break;
+
+                default:
+                    return false;
+                }
+
+                ++m_RecordCount;
+            }
+
+            if (!synchronized || !file.eof())
+                return false;
+
+            system::error_code ec;
+            const uintmax_t dir_time = get_modification_time(m_Dir, ec);
+            if (ec || dir_time != m_DirTimeStamp)
+                return false;
+
+            // The files could have been rewritten in place since the index was last updated, which does not modify the directory
+            for (entries::const_iterator it = m_Entries.begin(), end = m_Entries.end(); it != end; ++it)
+            {
+                filesystem::path const file_path = m_Dir / it->first;
+                const uintmax_t size = filesystem::file_size(file_path, ec);
+                if (ec || size != it->second.m_Size)
+                    return false;
+                const std::time_t time_stamp = filesystem::last_write_time(file_path, ec);
+                if (ec || time_stamp != it->second.m_TimeStamp)
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+
     class file_collector_repository;
 
     //! Type of the hook used for sequencing file collectors
@@ -662,27 +1108,6 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
                 }
             };
 
-            //! Predicate for testing if a file_info refers to a file equivalent to another path
-            class equivalent_file
-            {
-            public:
-                typedef bool result_type;
-
-            private:
-                filesystem::path const& m_Path;
-
-            public:
-                explicit equivalent_file(filesystem::path const& path) BOOST_NOEXCEPT :
-                    m_Path(path)
-                {
-                }
-
-                result_type operator()(file_info const& info) const
-                {
-                    return filesystem::equivalent(info.m_Path, m_Path);
-                }
-            };
-
             uintmax_t m_Size;
             std::time_t m_TimeStamp;
             filesystem::path m_Path;
@@ -691,6 +1116,12 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         typedef std::list< file_info > file_list;
         //! The string type compatible with the universal path type
         typedef filesystem::path::string_type path_string_type;
+        /*!
+         * Lookup table of the stored files, by the absolute file path. The paths are composed from the lexically normalized
+         * directory paths, and the files are identified by the path strings rather than by \c filesystem::equivalent. This means
+         * that the same file found through different paths, e.g. through a symlinked directory, is considered a different file.
+         */
+        typedef std::unordered_map< path_string_type, file_list::iterator > file_lookup;
 
     private:
         //! A reference to the repository this collector belongs to
@@ -719,9 +1150,43 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
 
         //! The list of stored files
         file_list m_Files;
+        //! The lookup table of the stored files
+        file_lookup m_FileLookup;
         //! Total size of the stored files
         uintmax_t m_TotalSize;
 
+        //! The flag indicates that the persistent index of the target directory is maintained
+        bool m_UseIndex;
+        //! The persistent index of the target directory
+        file_collector_index m_Index;
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! Synchronization mutex for the asynchronous collection state
+        std::mutex m_PendingMutex;
+        //! Condition variable used to wake the collection thread and the threads waiting for it to complete
+        std::condition_variable m_PendingCond;
+        //! Description of a file that was passed to \c store_file but not stored yet
+        struct pending_file
+        {
+            //! Current path to the file
+            filesystem::path m_Path;
+            //! The file name the file had when it was passed to \c store_file
+            filesystem::path m_FileName;
+        };
+        //! The files that were passed to \c store_file but not stored yet
+        std::deque< pending_file > m_PendingFiles;
+        //! The thread that stores files in asynchronous mode
+        std::thread m_CollectionThread;
+        //! The flag indicates that files are stored asynchronously
+        bool m_Asynchronous;
+        //! The flag indicates that the collection thread is currently storing a file
+        bool m_Collecting;
+        //! The flag indicates that the collection thread should terminate once the pending files are stored
+        bool m_StopCollection;
+        //! The first error that occurred in the collection thread and has not been reported yet
+        std::exception_ptr m_CollectionError;
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
     public:
         //! Constructor
         file_collector(
@@ -729,7 +1194,9 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
             filesystem::path const& target_dir,
             uintmax_t max_size,
             uintmax_t min_free_space,
-            uintmax_t max_files);
+            uintmax_t max_files,
+            bool async_collection,
+            bool persistent_index);
 
         //! Destructor
         ~file_collector() BOOST_OVERRIDE;
@@ -744,7 +1211,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         file::scan_result scan_for_files(file::scan_method method, filesystem::path const& pattern) BOOST_OVERRIDE;
 
         //! The function updates storage restrictions
-        void update(uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files);
+        void update(uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files, bool async_collection, bool persistent_index);
 
         //! The function checks if the directory is governed by this collector
         bool is_governed(filesystem::path const& dir) const
@@ -753,11 +1220,44 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         }
 
     private:
+        //! Moves the file to the target directory under the specified name and deletes old files, if needed
+        void do_store_file(filesystem::path const& src_path, filesystem::path const& file_name_path);
+        //! Removes the file from the list of stored files
+        file_list::iterator erase_file(file_list::iterator it);
+        //! Adds the file found by scanning to the list of found files, if it matches the pattern and is not stored yet
+        void add_found_file(
+            file_info& info, bool has_attributes, file::scan_method method, path_string_type const& mask,
+            file_list& files, uintmax_t& total_size, file::scan_result& result);
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! The collection thread function
+        void run_collection();
+        //! Blocks until all pending files are stored
+        void wait_for_pending_files();
+        //! Stores the pending files and terminates the collection thread
+        void stop_collection();
+        //! Renames the file to a unique name in the same directory, so that the file name can be reused before the file is stored
+        static filesystem::path rename_to_pending(filesystem::path const& src_path);
+        //! Rethrows the error that occurred in the collection thread, if any. Must be called with the pending mutex locked.
+        void rethrow_collection_error();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
         //! Makes relative path absolute with respect to the base path
         filesystem::path make_absolute(filesystem::path const& p) const
         {
             return filesystem::absolute(p, m_BasePath);
         }
+        //! Makes relative directory path absolute with respect to the base path and lexically normalizes it
+        filesystem::path make_normalized_dir(filesystem::path const& p) const
+        {
+            filesystem::path dir = make_absolute(p).lexically_normal();
+            // Normalizing a path with a trailing separator may produce a trailing dot element
+            filesystem::path const dir_fn = dir.filename();
+            path_string_type const& dir_name = dir_fn.native();
+            if (dir_name.size() == 1u && dir_name[0] == static_cast< path_string_type::value_type >('.'))
+                dir = dir.parent_path();
+            return dir;
+        }
         //! Acquires file name string from the path
         static path_string_type filename_string(filesystem::path const& p)
         {
@@ -797,7 +1297,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
     public:
         //! Finds or creates a file collector
         shared_ptr< file::collector > get_collector(
-            filesystem::path const& target_dir, uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files);
+            filesystem::path const& target_dir, uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files, bool async_collection, bool persistent_index);
 
         //! Removes the file collector from the list
         void remove_collector(file_collector* p);
@@ -816,69 +1316,227 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         filesystem::path const& target_dir,
         uintmax_t max_size,
         uintmax_t min_free_space,
-        uintmax_t max_files
+        uintmax_t max_files,
+        bool async_collection,
+        bool persistent_index
     ) :
         m_pRepository(repo),
         m_MaxSize(max_size),
         m_MinFreeSpace(min_free_space),
         m_MaxFiles(max_files),
         m_BasePath(filesystem::current_path()),
-        m_TotalSize(0)
+        m_TotalSize(0),
+        m_UseIndex(persistent_index)
+#if !defined(BOOST_LOG_NO_THREADS)
+        , m_Asynchronous(async_collection),
+        m_Collecting(false),
+        m_StopCollection(false)
+#endif // !defined(BOOST_LOG_NO_THREADS)
     {
-        m_StorageDir = make_absolute(target_dir);
+#if defined(BOOST_LOG_NO_THREADS)
+        (void)async_collection;
+#endif // defined(BOOST_LOG_NO_THREADS)
+        m_StorageDir = make_normalized_dir(target_dir);
         filesystem::create_directories(m_StorageDir);
+        if (m_UseIndex)
+            m_Index.open(m_StorageDir);
     }
 
     //! Destructor
     file_collector::~file_collector()
     {
+#if !defined(BOOST_LOG_NO_THREADS)
+        stop_collection();
+#endif // !defined(BOOST_LOG_NO_THREADS)
         m_pRepository->remove_collector(this);
     }
 
     //! The function stores the specified file in the storage
     void file_collector::store_file(filesystem::path const& src_path)
     {
-        // NOTE FOR THE FOLLOWING CODE:
-        // Avoid using Boost.Filesystem functions that would call path::codecvt(). store_file() can be called
-        // at process termination, and the global codecvt facet can already be destroyed at this point.
-        // https://svn.boost.org/trac/boost/ticket/8642
+#if !defined(BOOST_LOG_NO_THREADS)
+        {
+            std::lock_guard< std::mutex > lock(m_PendingMutex);
+            if (m_Asynchronous)
+            {
+                if (!m_CollectionThread.joinable())
+                    m_CollectionThread = std::thread([this]() { this->run_collection(); });
+
+                // Resolve the path now, as the current path may change by the time the file is stored.
+                // The file is also renamed now, as the sink backend may create a new file with the same name right away.
+                m_PendingFiles.push_back(pending_file());
+                pending_file& pending = m_PendingFiles.back();
+                pending.m_FileName = src_path.filename();
+                pending.m_Path = rename_to_pending(src_path.has_parent_path() ? filesystem::system_complete(src_path) : m_BasePath / src_path);
+                m_PendingCond.notify_all();
+
+                // The file is queued regardless, but the caller has to learn that storing one of the previous files failed
+                rethrow_collection_error();
+                return;
+            }
+        }
+#endif // !defined(BOOST_LOG_NO_THREADS)
 
-        // Let's construct the new file name
-        file_info info;
-        info.m_TimeStamp = filesystem::last_write_time(src_path);
-        info.m_Size = filesystem::file_size(src_path);
+        do_store_file(src_path, src_path.filename());
+    }
 
-        const filesystem::path file_name_path = src_path.filename();
-        path_string_type const& file_name = file_name_path.native();
-        info.m_Path = m_StorageDir / file_name_path;
+#if !defined(BOOST_LOG_NO_THREADS)
 
-        // Check if the file is already in the target directory
-        filesystem::path src_dir = src_path.has_parent_path() ?
-            filesystem::system_complete(src_path.parent_path()) :
-            m_BasePath;
-        const bool is_in_target_dir = filesystem::equivalent(src_dir, m_StorageDir);
-        if (!is_in_target_dir)
+    //! Renames the file to a unique name in the same directory, so that the file name can be reused before the file is stored
+    filesystem::path file_collector::rename_to_pending(filesystem::path const& src_path)
+    {
+        path_string_type pattern = src_path.filename().native();
+        const char* const suffix = ".pending.";
+        for (const char* p = suffix; *p != '\0'; ++p)
+            pattern.push_back(static_cast< path_char_type >(*p));
+
+        const filesystem::path dir = src_path.parent_path();
+        file_counter_formatter formatter(pattern.size(), 1);
+        for (unsigned int n = 0u; n < 1000u; ++n)
         {
-            if (filesystem::exists(info.m_Path))
-            {
-                // If the file already exists, try to mangle the file name
-                // to ensure there's no conflict. I'll need to make this customizable some day.
-                file_counter_formatter formatter(file_name.size(), 5);
-                unsigned int n = 0;
-                while (true)
-                {
-                    path_string_type alt_file_name = formatter(file_name, n);
-                    info.m_Path = m_StorageDir / filesystem::path(alt_file_name);
-                    if (!filesystem::exists(info.m_Path))
-                        break;
+            filesystem::path pending_path = dir / filesystem::path(formatter(pattern, n));
+            system::error_code ec;
+            if (filesystem::symlink_status(pending_path, ec).type() != filesystem::file_not_found)
+                continue;
 
-                    if (BOOST_UNLIKELY(n == (std::numeric_limits< unsigned int >::max)()))
-                    {
-                        BOOST_THROW_EXCEPTION(filesystem_error(
-                            "Target file exists and an unused fallback file name could not be found",
-                            info.m_Path,
-                            system::error_code(system::errc::io_error, system::generic_category())));
-                    }
+            filesystem::rename(src_path, pending_path, ec);
+            if (!ec)
+                return pending_path;
+
+            break;
+        }
+
+        // If the file cannot be renamed, leave it as is and let the collection thread report the error, if it cannot store the file either
+        return src_path;
+    }
+
+    //! The collection thread function
+    void file_collector::run_collection()
+    {
+        std::unique_lock< std::mutex > lock(m_PendingMutex);
+        while (true)
+        {
+            if (!m_PendingFiles.empty())
+            {
+                filesystem::path src_path, file_name_path;
+                src_path.swap(m_PendingFiles.front().m_Path);
+                file_name_path.swap(m_PendingFiles.front().m_FileName);
+                m_PendingFiles.pop_front();
+                m_Collecting = true;
+                lock.unlock();
+
+                std::exception_ptr error;
+                try
+                {
+                    do_store_file(src_path, file_name_path);
+                }
+                catch (...)
+                {
+                    // The file is left where it is, just like it would be if the synchronous store_file call failed.
+                    // The error is reported from the next call to store_file or scan_for_files.
+                    error = std::current_exception();
+                }
+
+                lock.lock();
+                if (error && !m_CollectionError)
+                    m_CollectionError = error;
+                m_Collecting = false;
+                m_PendingCond.notify_all();
+            }
+            else if (m_StopCollection)
+            {
+                break;
+            }
+            else
+            {
+                m_PendingCond.wait(lock);
+            }
+        }
+    }
+
+    //! Blocks until all pending files are stored
+    void file_collector::wait_for_pending_files()
+    {
+        std::unique_lock< std::mutex > lock(m_PendingMutex);
+        while (!m_PendingFiles.empty() || m_Collecting)
+            m_PendingCond.wait(lock);
+
+        rethrow_collection_error();
+    }
+
+    //! Stores the pending files and terminates the collection thread
+    void file_collector::stop_collection()
+    {
+        {
+            std::lock_guard< std::mutex > lock(m_PendingMutex);
+            m_StopCollection = true;
+            m_PendingCond.notify_all();
+        }
+
+        if (m_CollectionThread.joinable())
+            m_CollectionThread.join();
+
+        // There is no one to report the errors to at this point, the files that failed to be stored are left where they are
+    }
+
+    //! Rethrows the error that occurred in the collection thread, if any
+    void file_collector::rethrow_collection_error()
+    {
+        if (BOOST_UNLIKELY(!!m_CollectionError))
+        {
+            std::exception_ptr error;
+            error.swap(m_CollectionError);
+            std::rethrow_exception(error);
+        }
+    }
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+    //! Moves the file to the target directory under the specified name and deletes old files, if needed
+    void file_collector::do_store_file(filesystem::path const& src_path, filesystem::path const& file_name_path)
+    {
+        // NOTE FOR THE FOLLOWING CODE:
+        // Avoid using Boost.Filesystem functions that would call path::codecvt(). store_file() can be called
+        // at process termination, and the global codecvt facet can already be destroyed at this point.
+        // https://svn.boost.org/trac/boost/ticket/8642
+
+        // Let's construct the new file name
+        file_info info;
+        info.m_TimeStamp = filesystem::last_write_time(src_path);
+        info.m_Size = filesystem::file_size(src_path);
+
+        path_string_type const& file_name = file_name_path.native();
+        info.m_Path = m_StorageDir / file_name_path;
+
+        // Check if the file is already in the target directory. A file that was renamed by store_file in asynchronous mode
+        // has to be renamed back, even if it is in the target directory.
+        filesystem::path src_dir = src_path.has_parent_path() ?
+            filesystem::system_complete(src_path.parent_path()) :
+            m_BasePath;
+        const bool is_in_target_dir = filesystem::equivalent(src_dir, m_StorageDir);
+        const bool is_in_place = is_in_target_dir && src_path.filename() == file_name_path;
+        if (!is_in_place)
+        {
+            if (filesystem::exists(info.m_Path))
+            {
+                // If the file already exists, try to mangle the file name
+                // to ensure there's no conflict. I'll need to make this customizable some day.
+                file_counter_formatter formatter(file_name.size(), 5);
+                unsigned int n = 0;
+                while (true)
+                {
+                    path_string_type alt_file_name = formatter(file_name, n);
+                    info.m_Path = m_StorageDir / filesystem::path(alt_file_name);
+                    if (!filesystem::exists(info.m_Path))
+                        break;
+
+                    if (BOOST_UNLIKELY(n == (std::numeric_limits< unsigned int >::max)()))
+                    {
+                        BOOST_THROW_EXCEPTION(filesystem_error(
+                            "Target file exists and an unused fallback file name could not be found",
+                            info.m_Path,
+                            system::error_code(system::errc::io_error, system::generic_category())));
+                    }
 
                     ++n;
                 }
@@ -890,34 +1548,26 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
 
         BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
 
-        file_list::iterator it = m_Files.begin();
-        const file_list::iterator end = m_Files.end();
-        if (is_in_target_dir)
+        // The index can only be updated incrementally if the directory has not been modified by anyone else.
+        // In particular, this is not the case when the sink writes log files directly into the target directory.
+        const bool update_index = m_UseIndex && m_Index.is_up_to_date();
+
+        if (is_in_place)
         {
-            // If the sink writes log file into the target dir (is_in_target_dir == true), it is possible that after scanning
+            // If the sink writes log file into the target dir (is_in_place == true), it is possible that after scanning
             // an old file entry refers to the file that is picked up by the sink for writing. Later on, the sink attempts
             // to store the file in the storage. At best, this would result in duplicate file entries. At worst, if the storage
             // limits trigger a deletion and this file get deleted, we may have an entry that refers to no actual file. In any case,
             // the total size of files in the storage will be incorrect. Here we work around this problem and simply remove
             // the old file entry without removing the file. The entry will be re-added to the list later.
-            while (it != end)
-            {
-                system::error_code ec;
-                if (filesystem::equivalent(it->m_Path, info.m_Path, ec))
-                {
-                    m_TotalSize -= it->m_Size;
-                    m_Files.erase(it);
-                    break;
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-
-            it = m_Files.begin();
+            file_lookup::iterator lookup_it = m_FileLookup.find(info.m_Path.native());
+            if (lookup_it != m_FileLookup.end())
+                erase_file(lookup_it->second);
         }
 
+        file_list::iterator it = m_Files.begin();
+        const file_list::iterator end = m_Files.end();
+
         // Check if an old file should be erased
         uintmax_t free_space = m_MinFreeSpace ? filesystem::space(m_StorageDir).available : static_cast< uintmax_t >(0);
         while (it != end &&
@@ -936,8 +1586,9 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
                     // to the erased file size on compressed filesystems
                     if (m_MinFreeSpace)
                         free_space = filesystem::space(m_StorageDir).available;
-                    m_TotalSize -= old_info.m_Size;
-                    it = m_Files.erase(it);
+                    if (update_index && old_info.m_Path.parent_path() == m_StorageDir)
+                        m_Index.remove(filename_string(old_info.m_Path));
+                    it = erase_file(it);
                 }
                 catch (system::system_error&)
                 {
@@ -948,19 +1599,35 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
             else
             {
                 // If it's not a file or is absent, just remove it from the list
-                m_TotalSize -= old_info.m_Size;
-                it = m_Files.erase(it);
+                if (update_index && old_info.m_Path.parent_path() == m_StorageDir)
+                    m_Index.remove(filename_string(old_info.m_Path));
+                it = erase_file(it);
             }
         }
 
-        if (!is_in_target_dir)
+        if (!is_in_place)
         {
             // Move/rename the file to the target storage
             move_file(src_path, info.m_Path);
         }
 
         m_Files.push_back(info);
+        m_FileLookup[info.m_Path.native()] = --m_Files.end();
         m_TotalSize += info.m_Size;
+
+        if (update_index)
+        {
+            m_Index.add(filename_string(info.m_Path), info.m_Size, info.m_TimeStamp);
+            m_Index.commit();
+        }
+    }
+
+    //! Removes the file from the list of stored files
+    file_collector::file_list::iterator file_collector::erase_file(file_list::iterator it)
+    {
+        m_TotalSize -= it->m_Size;
+        m_FileLookup.erase(it->m_Path.native());
+        return m_Files.erase(it);
     }
 
     //! The function checks if the specified path refers to an existing file in the storage
@@ -993,58 +1660,94 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         file::scan_result result;
         if (method != file::no_scan)
         {
+#if !defined(BOOST_LOG_NO_THREADS)
+            // Make sure the files rotated earlier are accounted for, and not found by the scan in their original location
+            wait_for_pending_files();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
             filesystem::path dir = m_StorageDir;
             path_string_type mask;
             if (method == file::scan_matching)
             {
                 mask = filename_string(pattern);
                 if (pattern.has_parent_path())
-                    dir = make_absolute(pattern.parent_path());
+                    dir = make_normalized_dir(pattern.parent_path());
             }
 
             system::error_code ec;
             filesystem::file_status status = filesystem::status(dir, ec);
             if (status.type() == filesystem::directory_file)
             {
+                // Files in the target directory are identified by their paths composed from the target directory path,
+                // so use the same directory path spelling for the files we find
+                const bool is_target_dir = filesystem::equivalent(dir, m_StorageDir, ec);
+                if (is_target_dir)
+                    dir = m_StorageDir;
+
                 BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
 
                 file_list files;
-                filesystem::directory_iterator it(dir), end;
                 uintmax_t total_size = 0u;
-                for (; it != end; ++it)
+                const bool use_index = is_target_dir && m_UseIndex;
+                if (use_index && m_Index.is_up_to_date())
                 {
-                    filesystem::directory_entry const& dir_entry = *it;
-                    file_info info;
-                    info.m_Path = dir_entry.path();
-                    status = dir_entry.status(ec);
-                    if (status.type() == filesystem::regular_file)
+                    // The index is up to date, there's no need to scan the directory
+                    file_collector_index::entries const& entries = m_Index.get_entries();
+                    for (file_collector_index::entries::const_iterator it = entries.begin(), end = entries.end(); it != end; ++it)
                     {
-                        // Check that there are no duplicates in the resulting list
-                        if (std::find_if(m_Files.begin(), m_Files.end(), file_info::equivalent_file(info.m_Path)) == m_Files.end())
+                        file_info info;
+                        info.m_Path = dir / it->first;
+                        info.m_Size = it->second.m_Size;
+                        info.m_TimeStamp = it->second.m_TimeStamp;
+                        add_found_file(info, true, method, mask, files, total_size, result);
+                    }
+                }
+                else
+                {
+                    file_collector_index::entries listing;
+                    filesystem::directory_iterator it(dir), end;
+                    for (; it != end; ++it)
+                    {
+                        filesystem::directory_entry const& dir_entry = *it;
+                        status = dir_entry.status(ec);
+                        if (status.type() == filesystem::regular_file)
                         {
-                            // Check that the file name matches the pattern
-                            unsigned int file_number = 0u;
-                            bool file_number_parsed = false;
-                            if (method != file::scan_matching ||
-                                match_pattern(filename_string(info.m_Path), mask, file_number, file_number_parsed))
+                            file_info info;
+                            info.m_Path = dir_entry.path();
+                            const path_string_type file_name = filename_string(info.m_Path);
+                            if (is_target_dir && file_collector_index::is_index_file(file_name))
+                                continue;
+
+                            if (use_index)
                             {
+                                // Collect the complete listing of the directory to rebuild the index
                                 info.m_Size = filesystem::file_size(info.m_Path);
-                                total_size += info.m_Size;
                                 info.m_TimeStamp = filesystem::last_write_time(info.m_Path);
-                                files.push_back(info);
-                                ++result.found_count;
-
-                                // Test that the file_number >= result.last_file_counter accounting for the integer overflow
-                                if (file_number_parsed && (!result.last_file_counter || (file_number - *result.last_file_counter) < ((~0u) ^ ((~0u) >> 1u))))
-                                    result.last_file_counter = file_number;
+                                file_collector_index::entry& e = listing[file_name];
+                                e.m_Size = info.m_Size;
+                                e.m_TimeStamp = info.m_TimeStamp;
                             }
+
+                            add_found_file(info, use_index, method, mask, files, total_size, result);
                         }
                     }
+
+                    if (use_index)
+                        m_Index.reset(listing);
+                }
+
+                // Only add the found files to the lookup table once they are in the list of stored files. Until then,
+                // scanning may throw and the iterators into the local list would become dangling.
+                if (!files.empty())
+                {
+                    file_list::iterator it = files.begin();
+                    m_Files.splice(m_Files.end(), files);
+                    m_TotalSize += total_size;
+                    for (file_list::iterator end = m_Files.end(); it != end; ++it)
+                        m_FileLookup[it->m_Path.native()] = it;
                 }
 
                 // Sort files chronologically
-                m_Files.splice(m_Files.end(), files);
-                m_TotalSize += total_size;
                 m_Files.sort(file_info::order_by_timestamp());
             }
         }
@@ -1052,20 +1755,71 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         return result;
     }
 
+    //! Adds the file found by scanning to the list of found files, if it matches the pattern and is not stored yet
+    void file_collector::add_found_file(
+        file_info& info, bool has_attributes, file::scan_method method, path_string_type const& mask,
+        file_list& files, uintmax_t& total_size, file::scan_result& result)
+    {
+        // Check that there are no duplicates in the resulting list
+        if (m_FileLookup.find(info.m_Path.native()) == m_FileLookup.end())
+        {
+            // Check that the file name matches the pattern
+            unsigned int file_number = 0u;
+            bool file_number_parsed = false;
+            if (method != file::scan_matching ||
+                match_pattern(filename_string(info.m_Path), mask, file_number, file_number_parsed))
+            {
+                if (!has_attributes)
+                {
+                    info.m_Size = filesystem::file_size(info.m_Path);
+                    info.m_TimeStamp = filesystem::last_write_time(info.m_Path);
+                }
+
+                total_size += info.m_Size;
+                files.push_back(info);
+                ++result.found_count;
+
+                // Test that the file_number >= result.last_file_counter accounting for the integer overflow
+                if (file_number_parsed && (!result.last_file_counter || (file_number - *result.last_file_counter) < ((~0u) ^ ((~0u) >> 1u))))
+                    result.last_file_counter = file_number;
+            }
+        }
+    }
+
     //! The function updates storage restrictions
-    void file_collector::update(uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files)
+    void file_collector::update(uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files, bool async_collection, bool persistent_index)
     {
-        BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
+        {
+            BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
+
+            m_MaxSize = (std::min)(m_MaxSize, max_size);
+            m_MinFreeSpace = (std::max)(m_MinFreeSpace, min_free_space);
+            m_MaxFiles = (std::min)(m_MaxFiles, max_files);
 
-        m_MaxSize = (std::min)(m_MaxSize, max_size);
-        m_MinFreeSpace = (std::max)(m_MinFreeSpace, min_free_space);
-        m_MaxFiles = (std::min)(m_MaxFiles, max_files);
+            if (persistent_index && !m_UseIndex)
+            {
+                // The files that have already been stored are not in the index, so it can only be used
+                // if it is still up to date with the directory contents.
+                m_UseIndex = true;
+                m_Index.open(m_StorageDir);
+            }
+        }
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        if (async_collection)
+        {
+            std::lock_guard< std::mutex > lock(m_PendingMutex);
+            m_Asynchronous = true;
+        }
+#else
+        (void)async_collection;
+#endif // !defined(BOOST_LOG_NO_THREADS)
     }
 
 
     //! Finds or creates a file collector
     shared_ptr< file::collector > file_collector_repository::get_collector(
-        filesystem::path const& target_dir, uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files)
+        filesystem::path const& target_dir, uintmax_t max_size, uintmax_t min_free_space, uintmax_t max_files, bool async_collection, bool persistent_index)
     {
         BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
 
@@ -1076,7 +1830,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         {
             // This may throw if the collector is being currently destroyed
             p = it->shared_from_this();
-            p->update(max_size, min_free_space, max_files);
+            p->update(max_size, min_free_space, max_files, async_collection, persistent_index);
         }
         catch (bad_weak_ptr&)
         {
@@ -1085,7 +1839,7 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         if (!p)
         {
             p = boost::make_shared< file_collector >(
-                file_collector_repository::get(), target_dir, max_size, min_free_space, max_files);
+                file_collector_repository::get(), target_dir, max_size, min_free_space, max_files, async_collection, persistent_index);
             m_Collectors.push_back(*p);
         }
 
@@ -1122,12 +1876,501 @@ BOOST_LOG_ANONYMOUS_NAMESPACE {
         }
     }
 
+    /*!
+     * Converts the local time to the calendar time. If the local time does not exist because of a daylight saving time
+     * transition, the earliest valid local time after it is used. Returns -1 if no valid local time was found.
+     */
+    std::time_t local_time_to_time_t(posix_time::ptime local_time)
+    {
+        // Daylight saving time transitions don't skip more than a few hours
+        for (unsigned int i = 0u; i < 24u * 60u; ++i, local_time += posix_time::minutes(1))
+        {
+            std::tm requested_tm = posix_time::to_tm(local_time);
+            std::tm tm = requested_tm;
+            tm.tm_isdst = -1;
+            const std::time_t t = std::mktime(&tm);
+            // mktime normalizes non-existent local times, so the time is only valid if it was not changed
+            if (t != static_cast< std::time_t >(-1) && tm.tm_mday == requested_tm.tm_mday &&
+                tm.tm_hour == requested_tm.tm_hour && tm.tm_min == requested_tm.tm_min)
+            {
+                return t;
+            }
+
+            // Look for the next valid time from the beginning of the next minute
+            local_time -= posix_time::seconds(local_time.time_of_day().seconds());
+        }
+
+        return static_cast< std::time_t >(-1);
+    }
+
+    //! A handle of the written file used to commit the written data to the storage
+    class file_sync_handle
+    {
+    private:
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+        int m_Fd;
+#endif
+
+    public:
+        file_sync_handle() BOOST_NOEXCEPT
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+            : m_Fd(-1)
+#endif
+        {
+        }
+
+        ~file_sync_handle()
+        {
+            close();
+        }
+
+        //! Opens the file that is already open by the file stream, returns 0 on success or the system error code
+        int open(filesystem::path const& file_name)
+        {
+            close();
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+            // Note: Committing the file data does not depend on the file descriptor it is invoked on
+            m_Fd = ::open(file_name.c_str(), O_WRONLY | O_CLOEXEC);
+            if (BOOST_UNLIKELY(m_Fd < 0))
+                return errno;
+#else
+            (void)file_name;
+#endif
+            return 0;
+        }
+
+        void close() BOOST_NOEXCEPT
+        {
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+            if (m_Fd >= 0)
+            {
+                ::close(m_Fd);
+                m_Fd = -1;
+            }
+#endif
+        }
+
+        bool is_open() const BOOST_NOEXCEPT
+        {
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+            return m_Fd >= 0;
+#else
+            return false;
+#endif
+        }
+
+        //! Commits the data written to the file to the storage, returns 0 on success or the system error code
+        int sync() BOOST_NOEXCEPT
+        {
+#if defined(BOOST_LOG_HAS_FILE_SYNC)
+            if (m_Fd >= 0)
+            {
+                while (true)
+                {
+#if defined(BOOST_LOG_HAS_FDATASYNC)
+                    const int res = ::fdatasync(m_Fd);
+#else
+                    const int res = ::fsync(m_Fd);
+#endif
+                    if (res == 0)
+                        break;
+                    const int err = errno;
+                    if (err != EINTR)
+                        return err;
+                }
+            }
+#endif
+            return 0;
+        }
+
+        BOOST_DELETED_FUNCTION(file_sync_handle(file_sync_handle const&))
+        BOOST_DELETED_FUNCTION(file_sync_handle& operator= (file_sync_handle const&))
+    };
+
+    //! Group commit implementation
+    /*!
+     * Every written record is assigned a sequential number, which serves as the durability ticket for this record.
+     * The records are written to the file stream by the sink backend as usual, and the written data is flushed from
+     * the stream buffer and committed to the storage for a group of records at once. In multithreaded builds, flushing
+     * and committing is done in a dedicated thread, which allows the sink backend to keep writing records while
+     * the previous group is being committed.
+     *
+     * While the file stream is attached to the committer, the sink backend must only access the stream while holding
+     * the lock acquired with \c write_lock.
+     *
+     * If flushing or committing fails, the records included in the commit are not considered committed, and the error
+     * is thrown from \c commit and \c wait for these records. Once a commit fails, the data of the current file cannot be
+     * trusted to be durable even if a later commit succeeds, so all following commits of the file are considered failed
+     * until the next file is opened.
+     */
+    class group_committer
+    {
+    private:
+        typedef std::chrono::steady_clock clock_type;
+
+    private:
+        //! The maximum number of records in a group
+        const uintmax_t m_GroupSize;
+        //! The maximum time a record can stay uncommitted
+        const clock_type::duration m_Interval;
+        //! File handle used to commit data
+        file_sync_handle m_Handle;
+        //! The attached file stream, which is flushed before committing data
+        std::ostream* m_Stream;
+        //! Ticket of the last written record
+        uintmax_t m_Written;
+        //! Ticket of the last record included in a commit that has been started
+        uintmax_t m_Dispatched;
+        //! Ticket of the last committed record
+        uintmax_t m_Committed;
+        //! The time when the first not dispatched record was written
+        clock_type::time_point m_FirstPending;
+        //! The last commit error
+        system::error_code m_Error;
+        //! The failed records have tickets greater than this ticket and not greater than \c m_FailedLast
+        uintmax_t m_FailedAfter;
+        //! Ticket of the last record of the failed commits
+        uintmax_t m_FailedLast;
+        //! The flag indicates that a commit of the current file has failed or the file could not be opened for committing
+        bool m_FileFailed;
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! Synchronization mutex
+        std::mutex m_Mutex;
+        //! Condition variable used to wake the commit thread
+        std::condition_variable m_WorkCond;
+        //! Condition variable used to notify threads waiting for commits
+        std::condition_variable m_DoneCond;
+        //! The number of threads waiting for their records to be committed
+        unsigned int m_Waiters;
+        //! The flag indicates that the commit thread is committing data
+        bool m_CommitInProgress;
+        //! The flag indicates that the commit thread should terminate
+        bool m_Stop;
+        //! The commit thread
+        std::thread m_Thread;
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+    public:
+        group_committer(uintmax_t group_size, clock_type::duration interval) :
+            m_GroupSize(group_size > 0u ? group_size : static_cast< uintmax_t >(1u)),
+            m_Interval(interval),
+            m_Stream(NULL),
+            m_Written(0u),
+            m_Dispatched(0u),
+            m_Committed(0u),
+            m_FailedAfter(0u),
+            m_FailedLast(0u),
+            m_FileFailed(false)
+#if !defined(BOOST_LOG_NO_THREADS)
+            , m_Waiters(0u),
+            m_CommitInProgress(false),
+            m_Stop(false)
+#endif // !defined(BOOST_LOG_NO_THREADS)
+        {
+#if !defined(BOOST_LOG_NO_THREADS)
+            m_Thread = std::thread([this]() { this->run(); });
+#endif // !defined(BOOST_LOG_NO_THREADS)
+        }
+
+        ~group_committer()
+        {
+            close();
+#if !defined(BOOST_LOG_NO_THREADS)
+            {
+                std::lock_guard< std::mutex > lock(m_Mutex);
+                m_Stop = true;
+                m_WorkCond.notify_one();
+                m_DoneCond.notify_all();
+            }
+            m_Thread.join();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+        }
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! The lock that must be held while writing records to the attached file stream
+        class write_lock
+        {
+        private:
+            std::lock_guard< std::mutex > m_Lock;
+
+        public:
+            explicit write_lock(group_committer& committer) : m_Lock(committer.m_Mutex)
+            {
+            }
+
+            BOOST_DELETED_FUNCTION(write_lock(write_lock const&))
+            BOOST_DELETED_FUNCTION(write_lock& operator= (write_lock const&))
+        };
+#else
+        //! The lock that must be held while writing records to the attached file stream
+        class write_lock
+        {
+        public:
+            explicit write_lock(group_committer&) BOOST_NOEXCEPT
+            {
+            }
+
+            BOOST_DELETED_FUNCTION(write_lock(write_lock const&))
+            BOOST_DELETED_FUNCTION(write_lock& operator= (write_lock const&))
+        };
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+        /*!
+         * Starts committing data of the newly opened file. The file stream is attached to the committer. If the file
+         * cannot be opened for committing, the stream is still attached, so that the written records are flushed,
+         * but the commits of the file fail.
+         */
+        void open(filesystem::path const& file_name, std::ostream& strm)
+        {
+            BOOST_LOG_EXPR_IF_MT(std::unique_lock< std::mutex > lock(m_Mutex);)
+            BOOST_LOG_EXPR_IF_MT(wait_for_commit(lock);)
+            const int err = m_Handle.open(file_name);
+            m_Stream = &strm;
+            m_FileFailed = err != 0;
+            if (BOOST_UNLIKELY(m_FileFailed))
+            {
+                m_Error.assign(err, system::system_category());
+                BOOST_THROW_EXCEPTION(filesystem_error("Failed to open file for committing", file_name, m_Error));
+            }
+        }
+
+        /*!
+         * Detaches the file stream from the committer, so that the stream can be accessed without the lock.
+         * The records written so far will be committed by \c close or \c commit.
+         */
+        void detach()
+        {
+            BOOST_LOG_EXPR_IF_MT(std::unique_lock< std::mutex > lock(m_Mutex);)
+            BOOST_LOG_EXPR_IF_MT(wait_for_commit(lock);)
+            m_Stream = NULL;
+        }
+
+        /*!
+         * Commits all written records and stops committing the current file. Must be called before closing the file.
+         * If the file stream is detached, the written data must be flushed to the file prior to calling this method.
+         * Commit errors are not thrown, they are reported to the threads waiting for the failed records.
+         */
+        void close()
+        {
+            BOOST_LOG_EXPR_IF_MT(std::unique_lock< std::mutex > lock(m_Mutex);)
+            BOOST_LOG_EXPR_IF_MT(wait_for_commit(lock);)
+            commit_all();
+            m_Stream = NULL;
+            m_Handle.close();
+        }
+
+        /*!
+         * Commits all written records. If the file stream is detached, the written data must be flushed to the file
+         * prior to calling this method. Throws if the written records could not be committed.
+         */
+        void commit()
+        {
+            BOOST_LOG_EXPR_IF_MT(std::unique_lock< std::mutex > lock(m_Mutex);)
+            BOOST_LOG_EXPR_IF_MT(wait_for_commit(lock);)
+            commit_all();
+            check_failed(m_Written);
+        }
+
+        //! Registers a record that has been written to the attached file stream. Must be called with the write lock held.
+        void on_record_written(write_lock&)
+        {
+            if (m_Written == m_Dispatched)
+                m_FirstPending = clock_type::now();
+            ++m_Written;
+
+#if !defined(BOOST_LOG_NO_THREADS)
+            // Wake the commit thread to start waiting for the interval to pass or to commit the complete group
+            const uintmax_t pending = m_Written - m_Dispatched;
+            if (pending == 1u || pending == m_GroupSize)
+                m_WorkCond.notify_one();
+#else
+            if (m_Written - m_Dispatched >= m_GroupSize || clock_type::now() - m_FirstPending >= m_Interval)
+                commit_all();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+        }
+
+        //! Returns \c true if the file stream is attached to the committer
+        bool is_attached() const BOOST_NOEXCEPT
+        {
+            return m_Stream != NULL;
+        }
+
+        //! Returns the ticket of the last written record
+        uintmax_t get_last_ticket()
+        {
+            BOOST_LOG_EXPR_IF_MT(std::lock_guard< std::mutex > lock(m_Mutex);)
+            return m_Written;
+        }
+
+        //! Blocks until the record with the specified ticket is committed. Throws if the record could not be committed.
+        void wait(uintmax_t ticket)
+        {
+#if !defined(BOOST_LOG_NO_THREADS)
+            std::unique_lock< std::mutex > lock(m_Mutex);
+            // Don't wait for records that haven't been written yet
+            ticket = (std::min)(ticket, m_Written);
+            if (m_Committed < ticket && !is_failed(ticket))
+            {
+                ++m_Waiters;
+                m_WorkCond.notify_one();
+                while (m_Committed < ticket && !is_failed(ticket) && !m_Stop)
+                    m_DoneCond.wait(lock);
+                --m_Waiters;
+            }
+#else
+            ticket = (std::min)(ticket, m_Written);
+            if (m_Committed < ticket)
+                commit_all();
+#endif // !defined(BOOST_LOG_NO_THREADS)
+            check_failed(ticket);
+        }
+
+        BOOST_DELETED_FUNCTION(group_committer(group_committer const&))
+        BOOST_DELETED_FUNCTION(group_committer& operator= (group_committer const&))
+
+    private:
+        //! Flushes the written records from the attached file stream buffer, returns 0 on success or the system error code
+        int flush_stream()
+        {
+            if (m_Stream)
+            {
+                m_Stream->flush();
+                if (BOOST_UNLIKELY(!m_Stream->good()))
+                    return EIO;
+            }
+            return 0;
+        }
+
+        //! Commits the written data to the storage, returns 0 on success or the system error code
+        int sync()
+        {
+            // A failed commit may have discarded the data, a subsequent commit of the same file cannot be trusted
+            if (BOOST_UNLIKELY(m_FileFailed))
+                return m_Error.value();
+            return m_Handle.sync();
+        }
+
+        //! Completes the commit of the records up to the ticket. Must be called with the lock held.
+        void complete_commit(uintmax_t ticket, int err)
+        {
+            if (BOOST_LIKELY(err == 0))
+            {
+                if (m_Committed < ticket)
+                    m_Committed = ticket;
+            }
+            else
+            {
+                // Extend the range of the failed records. If there was a successful commit since the previous failure,
+                // the records committed by it are also reported as failed, which is safe for the waiting threads.
+                if (m_FailedLast == m_FailedAfter)
+                    m_FailedAfter = m_Committed;
+                if (m_FailedLast < ticket)
+                    m_FailedLast = ticket;
+                m_Error.assign(err, system::system_category());
+                m_FileFailed = true;
+            }
+            BOOST_LOG_EXPR_IF_MT(m_DoneCond.notify_all();)
+        }
+
+        //! Checks if the record with the ticket could not be committed
+        bool is_failed(uintmax_t ticket) const BOOST_NOEXCEPT
+        {
+            return ticket > m_FailedAfter && ticket <= m_FailedLast;
+        }
+
+        //! Throws if the record with the ticket could not be committed
+        void check_failed(uintmax_t ticket) const
+        {
+            if (BOOST_UNLIKELY(is_failed(ticket)))
+                BOOST_THROW_EXCEPTION(system::system_error(m_Error, "Failed to commit log records to the storage"));
+        }
+
+        //! Commits all written records in the current thread
+        void commit_all()
+        {
+            if (m_Committed != m_Written && m_FailedLast != m_Written)
+            {
+                const uintmax_t ticket = m_Written;
+                int err = flush_stream();
+                if (err == 0)
+                    err = sync();
+                m_Dispatched = ticket;
+                complete_commit(ticket, err);
+            }
+        }
+
+#if !defined(BOOST_LOG_NO_THREADS)
+        //! Waits for the commit thread to complete committing data, if it is in progress
+        void wait_for_commit(std::unique_lock< std::mutex >& lock)
+        {
+            while (m_CommitInProgress)
+                m_DoneCond.wait(lock);
+        }
+
+        //! The commit thread function
+        void run()
+        {
+            std::unique_lock< std::mutex > lock(m_Mutex);
+            while (true)
+            {
+                if (m_Written != m_Dispatched)
+                {
+                    if (m_Waiters > 0u || m_Written - m_Dispatched >= m_GroupSize || clock_type::now() - m_FirstPending >= m_Interval)
+                    {
+                        // Pass the whole group of records to the OS at once. The sink backend cannot write to the stream
+                        // while we're holding the lock.
+                        int err = flush_stream();
+                        const uintmax_t ticket = m_Written;
+                        m_Dispatched = ticket;
+                        if (err == 0)
+                        {
+                            m_CommitInProgress = true;
+                            lock.unlock();
+
+                            // The sink backend is free to write more records while we're committing
+                            err = sync();
+
+                            lock.lock();
+                            m_CommitInProgress = false;
+                        }
+                        complete_commit(ticket, err);
+                    }
+                    else
+                    {
+                        m_WorkCond.wait_until(lock, m_FirstPending + m_Interval);
+                    }
+                }
+                else if (m_Stop)
+                {
+                    break;
+                }
+                else
+                {
+                    m_WorkCond.wait(lock);
+                }
+            }
+        }
+#endif // !defined(BOOST_LOG_NO_THREADS)
+    };
+
 } // namespace
 
 namespace file {
 
 namespace aux {
 
+    //! Creates and returns a file collector with the specified parameters
+    BOOST_LOG_API shared_ptr< collector > make_collector(
+        filesystem::path const& target_dir,
+        uintmax_t max_size,
+        uintmax_t min_free_space,
+        uintmax_t max_files,
+        bool async_collection,
+        bool persistent_index)
+    {
+        return file_collector_repository::get()->get_collector(target_dir, max_size, min_free_space, max_files, async_collection, persistent_index);
+    }
+
     //! Creates and returns a file collector with the specified parameters
     BOOST_LOG_API shared_ptr< collector > make_collector(
         filesystem::path const& target_dir,
@@ -1135,7 +2378,7 @@ namespace aux {
         uintmax_t min_free_space,
         uintmax_t max_files)
     {
-        return file_collector_repository::get()->get_collector(target_dir, max_size, min_free_space, max_files);
+        return aux::make_collector(target_dir, max_size, min_free_space, max_files, false, false);
     }
 
 } // namespace aux
@@ -1151,7 +2394,7 @@ BOOST_LOG_API rotation_at_time_point::rotation_at_time_point(
     m_Hour(hour),
     m_Minute(minute),
     m_Second(second),
-    m_Previous(date_time::not_a_date_time)
+    m_NextRotation((std::numeric_limits< std::time_t >::min)())
 {
     check_time_point_validity(hour, minute, second);
 }
@@ -1168,7 +2411,7 @@ BOOST_LOG_API rotation_at_time_point::rotation_at_time_point(
     m_Hour(hour),
     m_Minute(minute),
     m_Second(second),
-    m_Previous(date_time::not_a_date_time)
+    m_NextRotation((std::numeric_limits< std::time_t >::min)())
 {
     check_time_point_validity(hour, minute, second);
 }
@@ -1185,99 +2428,86 @@ BOOST_LOG_API rotation_at_time_point::rotation_at_time_point(
     m_Hour(hour),
     m_Minute(minute),
     m_Second(second),
-    m_Previous(date_time::not_a_date_time)
+    m_NextRotation((std::numeric_limits< std::time_t >::min)())
 {
     check_time_point_validity(hour, minute, second);
 }
 
-//! Checks if it's time to rotate the file
-BOOST_LOG_API bool rotation_at_time_point::operator()() const
+//! Calculates the next rotation time
+BOOST_LOG_API bool rotation_at_time_point::update_next_rotation(std::time_t now) const
 {
-    bool result = false;
+    const bool result = m_NextRotation != (std::numeric_limits< std::time_t >::min)();
+
     posix_time::time_duration rotation_time(
         static_cast< posix_time::time_duration::hour_type >(m_Hour),
         static_cast< posix_time::time_duration::min_type >(m_Minute),
         static_cast< posix_time::time_duration::sec_type >(m_Second));
-    posix_time::ptime now = posix_time::second_clock::local_time();
+    const posix_time::ptime local_now = date_time::c_local_adjustor< posix_time::ptime >::utc_to_local(posix_time::from_time_t(now));
+    gregorian::date current_date = local_now.date();
+    bool time_of_day_passed = rotation_time.total_seconds() <= local_now.time_of_day().total_seconds();
 
-    if (m_Previous.is_special())
+    std::time_t next;
+    while (true)
     {
-        m_Previous = now;
-        return false;
-    }
-
-    const bool time_of_day_passed = rotation_time.total_seconds() <= m_Previous.time_of_day().total_seconds();
-    switch (static_cast< day_kind >(m_DayKind))
-    {
-    case not_specified:
+        gregorian::date next_date = current_date;
+        switch (static_cast< day_kind >(m_DayKind))
         {
-            // The rotation takes place every day at the specified time
-            gregorian::date previous_date = m_Previous.date();
-            if (time_of_day_passed)
-                previous_date += gregorian::days(1);
-            posix_time::ptime next(previous_date, rotation_time);
-            result = (now >= next);
-        }
-        break;
-
-    case weekday:
-        {
-            // The rotation takes place on the specified week day at the specified time
-            gregorian::date previous_date = m_Previous.date(), next_date = previous_date;
-            int weekday = m_Day, previous_weekday = static_cast< int >(previous_date.day_of_week().as_number());
-            next_date += gregorian::days(weekday - previous_weekday);
-            if (weekday < previous_weekday || (weekday == previous_weekday && time_of_day_passed))
+        case not_specified:
             {
-                next_date += gregorian::weeks(1);
+                // The rotation takes place every day at the specified time
+                if (time_of_day_passed)
+                    next_date += gregorian::days(1);
             }
+            break;
 
-            posix_time::ptime next(next_date, rotation_time);
-            result = (now >= next);
-        }
-        break;
+        case weekday:
+            {
+                // The rotation takes place on the specified week day at the specified time
+                int weekday = m_Day, current_weekday = static_cast< int >(current_date.day_of_week().as_number());
+                next_date += gregorian::days(weekday - current_weekday);
+                if (weekday < current_weekday || (weekday == current_weekday && time_of_day_passed))
+                {
+                    next_date += gregorian::weeks(1);
+                }
+            }
+            break;
 
-    case monthday:
-        {
-            // The rotation takes place on the specified day of month at the specified time
-            gregorian::date previous_date = m_Previous.date();
-            gregorian::date::day_type monthday = static_cast< gregorian::date::day_type >(m_Day),
-                previous_monthday = previous_date.day();
-            gregorian::date next_date(previous_date.year(), previous_date.month(), monthday);
-            if (monthday < previous_monthday || (monthday == previous_monthday && time_of_day_passed))
+        case monthday:
             {
-                next_date += gregorian::months(1);
+                // The rotation takes place on the specified day of month at the specified time
+                gregorian::date::day_type monthday = static_cast< gregorian::date::day_type >(m_Day),
+                    current_monthday = current_date.day();
+                next_date = gregorian::date(current_date.year(), current_date.month(), monthday);
+                if (monthday < current_monthday || (monthday == current_monthday && time_of_day_passed))
+                {
+                    next_date += gregorian::months(1);
+                }
             }
+            break;
 
-            posix_time::ptime next(next_date, rotation_time);
-            result = (now >= next);
+        default:
+            break;
         }
-        break;
 
-    default:
-        break;
-    }
-
-    if (result)
-        m_Previous = now;
+        // Convert the local time of the next rotation to the calendar time
+        next = local_time_to_time_t(posix_time::ptime(next_date, rotation_time));
+        if (BOOST_UNLIKELY(next == static_cast< std::time_t >(-1)))
+        {
+            // The local time cannot be represented, disable further rotations
+            next = (std::numeric_limits< std::time_t >::max)();
+            break;
+        }
 
-    return result;
-}
+        if (BOOST_LIKELY(next > now))
+            break;
 
-//! Checks if it's time to rotate the file
-BOOST_LOG_API bool rotation_at_time_interval::operator()() const
-{
-    bool result = false;
-    posix_time::ptime now = posix_time::second_clock::universal_time();
-    if (m_Previous.is_special())
-    {
-        m_Previous = now;
-        return false;
+        // The local time of the rotation is ambiguous because of a daylight saving time transition and its
+        // first occurrence has already passed. The rotation has already happened then, skip to the next time point.
+        current_date = next_date;
+        time_of_day_passed = true;
     }
 
-    result = (now - m_Previous) >= m_Interval;
-
-    if (result)
-        m_Previous = now;
+    m_NextRotation = next;
 
     return result;
 }
@@ -1342,6 +2572,9 @@ struct text_file_backend::implementation
     //! The flag indicates whether the next opened file will be the first file opened by this backend
     bool m_IsFirstFile;
 
+    //! Group commit implementation, if group commit is enabled
+    std::unique_ptr< group_committer > m_pGroupCommitter;
+
     implementation(uintmax_t rotation_size, auto_newline_mode auto_newline, bool auto_flush, bool enable_final_rotation) :
         m_FileNamePatternHasCounter(false),
         m_FileCounter(0u),
@@ -1376,6 +2609,9 @@ BOOST_LOG_API text_file_backend::~text_file_backend()
     {
     }
 
+    // Make sure the records written since the last commit are committed before the file is closed
+    m_pImpl->m_pGroupCommitter.reset();
+
     delete m_pImpl;
 }
 
@@ -1430,8 +2666,6 @@ BOOST_LOG_API void text_file_backend::set_auto_newline_mode(auto_newline_mode mo
 //! The method writes the message to the sink
 BOOST_LOG_API void text_file_backend::consume(record_view const& rec, string_type const& formatted_message)
 {
-    typedef file_char_traits< string_type::value_type > traits_t;
-
     filesystem::path prev_file_name;
     bool use_prev_file_name = false;
     if (BOOST_UNLIKELY(!m_pImpl->m_File.good()))
@@ -1567,9 +2801,33 @@ BOOST_LOG_API void text_file_backend::consume(record_view const& rec, string_typ
             m_pImpl->m_CharactersWritten = static_cast< std::streamoff >(m_pImpl->m_File.tellp());
         }
 
+        // From now on the group committer flushes the file stream, so the stream can only be accessed under its lock
+        if (!!m_pImpl->m_pGroupCommitter)
+            m_pImpl->m_pGroupCommitter->open(m_pImpl->m_FileName, m_pImpl->m_File);
+
         break;
     }
 
+    if (!!m_pImpl->m_pGroupCommitter)
+    {
+        // The committer will flush the record along with the rest of the group
+        group_committer::write_lock lock(*m_pImpl->m_pGroupCommitter);
+        write_formatted_message(formatted_message);
+        m_pImpl->m_pGroupCommitter->on_record_written(lock);
+    }
+    else
+    {
+        write_formatted_message(formatted_message);
+        if (m_pImpl->m_AutoFlush)
+            m_pImpl->m_File.flush();
+    }
+}
+
+//! Writes the formatted log record to the file
+void text_file_backend::write_formatted_message(string_type const& formatted_message)
+{
+    typedef file_char_traits< string_type::value_type > traits_t;
+
     m_pImpl->m_File.write(formatted_message.data(), static_cast< std::streamsize >(formatted_message.size()));
     m_pImpl->m_CharactersWritten += formatted_message.size();
 
@@ -1581,16 +2839,53 @@ BOOST_LOG_API void text_file_backend::consume(record_view const& rec, string_typ
             ++m_pImpl->m_CharactersWritten;
         }
     }
-
-    if (m_pImpl->m_AutoFlush)
-        m_pImpl->m_File.flush();
 }
 
 //! The method flushes the currently open log file
 BOOST_LOG_API void text_file_backend::flush()
 {
     if (m_pImpl->m_File.is_open())
-        m_pImpl->m_File.flush();
+    {
+        if (!!m_pImpl->m_pGroupCommitter && m_pImpl->m_pGroupCommitter->is_attached())
+        {
+            // The committer flushes the stream before committing
+            m_pImpl->m_pGroupCommitter->commit();
+        }
+        else
+        {
+            m_pImpl->m_File.flush();
+            if (!!m_pImpl->m_pGroupCommitter)
+                m_pImpl->m_pGroupCommitter->commit();
+        }
+    }
+}
+
+//! The method enables or disables group commit
+BOOST_LOG_API void text_file_backend::set_group_commit(uintmax_t max_group_size, std::chrono::microseconds max_delay)
+{
+    m_pImpl->m_pGroupCommitter.reset();
+
+    if (max_group_size > 0u)
+    {
+        m_pImpl->m_pGroupCommitter.reset(new group_committer(max_group_size, max_delay));
+        if (m_pImpl->m_File.is_open())
+            m_pImpl->m_pGroupCommitter->open(m_pImpl->m_FileName, m_pImpl->m_File);
+    }
+}
+
+//! Returns the durability ticket of the last record written to the file
+BOOST_LOG_API uintmax_t text_file_backend::get_durability_ticket() const
+{
+    if (!!m_pImpl->m_pGroupCommitter)
+        return m_pImpl->m_pGroupCommitter->get_last_ticket();
+    return 0u;
+}
+
+//! Blocks until the record with the specified durability ticket is committed to the storage
+BOOST_LOG_API void text_file_backend::wait_until_durable(uintmax_t ticket)
+{
+    if (!!m_pImpl->m_pGroupCommitter)
+        m_pImpl->m_pGroupCommitter->wait(ticket);
 }
 
 //! The method sets file name pattern
@@ -1629,6 +2924,10 @@ void text_file_backend::close_file()
 {
     if (m_pImpl->m_File.is_open())
     {
+        // Stop the group committer from accessing the file stream, as the close handler may write to it
+        if (!!m_pImpl->m_pGroupCommitter)
+            m_pImpl->m_pGroupCommitter->detach();
+
         if (!m_pImpl->m_CloseHandler.empty())
         {
             // Rationale: We should call the close handler even if the stream is !good() because
@@ -1641,6 +2940,12 @@ void text_file_backend::close_file()
             m_pImpl->m_CloseHandler(m_pImpl->m_File);
         }
 
+        if (!!m_pImpl->m_pGroupCommitter)
+        {
+            m_pImpl->m_File.flush();
+            m_pImpl->m_pGroupCommitter->close();
+        }
+
         m_pImpl->m_File.close();
     }
 
@@ -15,6 +15,10 @@
 
 #include <boost/log/detail/config.hpp>
 #include <ios>
+#include <list>
+#include <chrono>
+#include <cstddef>
+#include <unordered_map>
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/operations.hpp>
@@ -32,6 +36,31 @@ namespace sinks {
 //! Sink implementation data
 struct text_multifile_backend::implementation
 {
+    //! Clock used to track file idle time
+    typedef std::chrono::steady_clock clock_type;
+    //! File path string type
+    typedef filesystem::path::string_type path_string_type;
+
+    //! An open file kept in the cache
+    struct open_file
+    {
+        //! Absolute file path
+        const path_string_type m_Path;
+        //! File stream
+        filesystem::ofstream m_File;
+        //! The time point when the file was last written to
+        clock_type::time_point m_LastUsed;
+
+        explicit open_file(path_string_type const& p) : m_Path(p)
+        {
+        }
+    };
+
+    //! Open files, ordered from the most recently to the least recently used
+    typedef std::list< open_file > open_file_list;
+    //! Open files lookup by absolute path
+    typedef std::unordered_map< path_string_type, open_file_list::iterator > open_file_lookup;
+
     //! File name composer
     file_name_composer_type m_FileNameComposer;
     //! Base path for absolute path composition
@@ -40,10 +69,24 @@ struct text_multifile_backend::implementation
     filesystem::ofstream m_File;
     //! Indicates whether to append a trailing newline after every log record
     auto_newline_mode m_AutoNewlineMode;
+    //! The flag indicates whether the open files should be flushed after every record
+    bool m_fAutoFlush;
 
-    explicit implementation(auto_newline_mode auto_newline) :
+    //! The maximum number of open files to keep, 0 if the files should not be kept open
+    std::size_t m_MaxOpenFiles;
+    //! The time after which an unused file is closed, zero if unlimited
+    clock_type::duration m_IdleTimeout;
+    //! Open files
+    open_file_list m_OpenFiles;
+    //! Open files lookup
+    open_file_lookup m_OpenFileLookup;
+
+    implementation(auto_newline_mode auto_newline, std::size_t max_open_files, bool auto_flush) :
         m_BasePath(filesystem::current_path()),
-        m_AutoNewlineMode(auto_newline)
+        m_AutoNewlineMode(auto_newline),
+        m_fAutoFlush(auto_flush),
+        m_MaxOpenFiles(max_open_files),
+        m_IdleTimeout(std::chrono::seconds(60))
     {
     }
 
@@ -52,6 +95,89 @@ struct text_multifile_backend::implementation
     {
         return filesystem::absolute(p, m_BasePath);
     }
+
+    //! Writes the formatted log record to the stream
+    void write(std::ostream& strm, string_type const& formatted_message)
+    {
+        strm.write(formatted_message.data(), static_cast< std::streamsize >(formatted_message.size()));
+        if (m_AutoNewlineMode != disabled_auto_newline)
+        {
+            if (m_AutoNewlineMode == always_insert || formatted_message.empty() || *formatted_message.rbegin() != static_cast< string_type::value_type >('\n'))
+                strm.put(static_cast< string_type::value_type >('\n'));
+        }
+    }
+
+    //! Returns an open file for the given path, opening it if needed. Returns \c NULL if the file cannot be opened.
+    filesystem::ofstream* get_open_file(filesystem::path const& file_name, clock_type::time_point now)
+    {
+        open_file_lookup::iterator it = m_OpenFileLookup.find(file_name.native());
+        if (it != m_OpenFileLookup.end())
+        {
+            open_file_list::iterator file = it->second;
+            if (file != m_OpenFiles.begin())
+                m_OpenFiles.splice(m_OpenFiles.begin(), m_OpenFiles, file);
+            file->m_LastUsed = now;
+            return &file->m_File;
+        }
+
+        while (m_OpenFiles.size() >= m_MaxOpenFiles)
+            close_least_recently_used();
+
+        filesystem::create_directories(file_name.parent_path());
+
+        m_OpenFiles.emplace_front(file_name.native());
+        open_file& file = m_OpenFiles.front();
+        file.m_File.open(file_name, std::ios_base::out | std::ios_base::app);
+        if (BOOST_UNLIKELY(!file.m_File.is_open()))
+        {
+            m_OpenFiles.pop_front();
+            return NULL;
+        }
+
+        try
+        {
+            m_OpenFileLookup.emplace(file.m_Path, m_OpenFiles.begin());
+        }
+        catch (...)
+        {
+            m_OpenFiles.pop_front();
+            throw;
+        }
+
+        file.m_LastUsed = now;
+        return &file.m_File;
+    }
+
+    //! Closes the most recently used file, which must be the one that was last returned by \c get_open_file
+    void close_most_recently_used()
+    {
+        m_OpenFileLookup.erase(m_OpenFiles.front().m_Path);
+        m_OpenFiles.pop_front();
+    }
+
+    //! Closes the least recently used file
+    void close_least_recently_used()
+    {
+        m_OpenFileLookup.erase(m_OpenFiles.back().m_Path);
+        m_OpenFiles.pop_back();
+    }
+
+    //! Closes files that have not been used for longer than the idle timeout
+    void close_idle_files(clock_type::time_point now)
+    {
+        if (m_IdleTimeout != clock_type::duration::zero())
+        {
+            while (!m_OpenFiles.empty() && (now - m_OpenFiles.back().m_LastUsed) >= m_IdleTimeout)
+                close_least_recently_used();
+        }
+    }
+
+    //! Closes files that exceed the open files limit
+    void close_excess_files()
+    {
+        while (m_OpenFiles.size() > m_MaxOpenFiles)
+            close_least_recently_used();
+    }
 };
 
 //! Default constructor
@@ -61,9 +187,9 @@ BOOST_LOG_API text_multifile_backend::text_multifile_backend()
 }
 
 //! Constructor implementation
-BOOST_LOG_API void text_multifile_backend::construct(auto_newline_mode auto_newline)
+BOOST_LOG_API void text_multifile_backend::construct(auto_newline_mode auto_newline, std::size_t max_open_files, bool auto_flush)
 {
-    m_pImpl = new implementation(auto_newline);
+    m_pImpl = new implementation(auto_newline, max_open_files, auto_flush);
 }
 
 //! Destructor
@@ -84,23 +210,78 @@ BOOST_LOG_API void text_multifile_backend::set_auto_newline_mode(auto_newline_mo
     m_pImpl->m_AutoNewlineMode = mode;
 }
 
+//! Sets the limits of the open file cache
+BOOST_LOG_API void text_multifile_backend::set_file_cache(std::size_t max_open_files, std::chrono::milliseconds idle_timeout)
+{
+    m_pImpl->m_MaxOpenFiles = max_open_files;
+    m_pImpl->m_IdleTimeout = idle_timeout.count() > 0 ? std::chrono::duration_cast< implementation::clock_type::duration >(idle_timeout) : implementation::clock_type::duration::zero();
+    m_pImpl->close_excess_files();
+    if (!m_pImpl->m_OpenFiles.empty())
+        m_pImpl->close_idle_files(implementation::clock_type::now());
+}
+
+//! Sets the flag to automatically flush the file buffer after each written log record
+BOOST_LOG_API void text_multifile_backend::auto_flush(bool f)
+{
+    m_pImpl->m_fAutoFlush = f;
+}
+
 //! The method writes the message to the sink
 BOOST_LOG_API void text_multifile_backend::consume(record_view const& rec, string_type const& formatted_message)
 {
     if (BOOST_LIKELY(!m_pImpl->m_FileNameComposer.empty()))
     {
         filesystem::path file_name = m_pImpl->make_absolute(m_pImpl->m_FileNameComposer(rec));
-        filesystem::create_directories(file_name.parent_path());
-        m_pImpl->m_File.open(file_name, std::ios_base::out | std::ios_base::app);
-        if (BOOST_LIKELY(m_pImpl->m_File.is_open()))
+        if (m_pImpl->m_MaxOpenFiles == 0u)
+        {
+            filesystem::create_directories(file_name.parent_path());
+            m_pImpl->m_File.open(file_name, std::ios_base::out | std::ios_base::app);
+            if (BOOST_LIKELY(m_pImpl->m_File.is_open()))
+            {
+                m_pImpl->write(m_pImpl->m_File, formatted_message);
+                m_pImpl->m_File.close();
+            }
+        }
+        else
         {
-            m_pImpl->m_File.write(formatted_message.data(), static_cast< std::streamsize >(formatted_message.size()));
-            if (m_pImpl->m_AutoNewlineMode != disabled_auto_newline)
+            const implementation::clock_type::time_point now = implementation::clock_type::now();
+            m_pImpl->close_idle_files(now);
+
+            filesystem::ofstream* const file = m_pImpl->get_open_file(file_name, now);
+            if (BOOST_LIKELY(file != NULL))
+            {
+                m_pImpl->write(*file, formatted_message);
+                if (m_pImpl->m_fAutoFlush)
+                    file->flush();
+
+                // Don't keep a failed stream open so that the file is reopened for the next record
+                if (BOOST_UNLIKELY(!file->good()))
+                    m_pImpl->close_most_recently_used();
+            }
+        }
+    }
+}
+
+//! The method flushes the open files
+BOOST_LOG_API void text_multifile_backend::flush()
+{
+    if (!m_pImpl->m_OpenFiles.empty())
+    {
+        m_pImpl->close_idle_files(implementation::clock_type::now());
+
+        implementation::open_file_list::iterator it = m_pImpl->m_OpenFiles.begin(), end = m_pImpl->m_OpenFiles.end();
+        while (it != end)
+        {
+            it->m_File.flush();
+            if (BOOST_LIKELY(it->m_File.good()))
+            {
+                ++it;
+            }
+            else
             {
-                if (m_pImpl->m_AutoNewlineMode == always_insert || formatted_message.empty() || *formatted_message.rbegin() != static_cast< string_type::value_type >('\n'))
-                    m_pImpl->m_File.put(static_cast< string_type::value_type >('\n'));
+                m_pImpl->m_OpenFileLookup.erase(it->m_Path);
+                it = m_pImpl->m_OpenFiles.erase(it);
             }
-            m_pImpl->m_File.close();
         }
     }
 }
@@ -23,6 +23,7 @@
 #include <new>
 #include <limits>
 #include <string>
+#include <vector>
 #include <algorithm>
 #include <stdexcept>
 #include <boost/assert.hpp>
@@ -66,6 +67,9 @@ private:
         // Element data alignment, in bytes
         enum { data_alignment = 32u };
 
+        //! Element size value that marks the unused blocks at the end of the queue storage. The element follows at the beginning of the storage.
+        static BOOST_CONSTEXPR_OR_CONST size_type padding_size = 0xFFFFFFFFu;
+
         //! Size of the element data, in bytes
         size_type m_size;
 
@@ -86,7 +90,7 @@ private:
     struct header
     {
         // Increment this constant whenever you change the binary layout of the queue (apart from this header structure)
-        enum { abi_version = 0 };
+        enum { abi_version = 1 };
 
         // !!! Whenever you add/remove members in this structure, also modify get_abi_tag() function accordingly !!!
 
@@ -284,13 +288,10 @@ public:
 
     operation_result send(void const* message_data, size_type message_size)
     {
-        const uint32_t block_count = estimate_block_count(message_size);
+        const uint32_t block_count = get_block_count(message_size);
 
         header* const hdr = get_header();
 
-        if (BOOST_UNLIKELY(block_count > hdr->m_capacity))
-            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
-
         if (!lock_queue())
             return aborted;
 
@@ -318,13 +319,10 @@ public:
 
     bool try_send(void const* message_data, size_type message_size)
     {
-        const uint32_t block_count = estimate_block_count(message_size);
+        const uint32_t block_count = get_block_count(message_size);
 
         header* const hdr = get_header();
 
-        if (BOOST_UNLIKELY(block_count > hdr->m_capacity))
-            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
-
         if (!lock_queue())
             return false;
 
@@ -338,6 +336,49 @@ public:
         return true;
     }
 
+    void* try_reserve(size_type message_size, uint64_t& pos, uint32_t& reserved_block_count)
+    {
+        const uint32_t block_count = get_block_count(message_size);
+
+        // The queue remains locked until commit() is called
+        if (!lock_queue())
+            return NULL;
+
+        header* const hdr = get_header();
+
+        uint32_t index = hdr->m_put_pos;
+        uint32_t total_block_count = get_padding_block_count(index, block_count) + block_count;
+        if (BOOST_UNLIKELY(total_block_count > hdr->m_capacity) && hdr->m_size == 0u)
+        {
+            // The message can only be stored at the beginning of the storage, which is possible when the queue is empty
+            hdr->m_put_pos = hdr->m_get_pos = index = 0u;
+            total_block_count = block_count;
+        }
+
+        if ((hdr->m_capacity - hdr->m_size) < total_block_count)
+        {
+            m_mutex.unlock();
+            return NULL;
+        }
+
+        pos = index;
+        reserved_block_count = total_block_count;
+        return prepare_reservation(index, message_size);
+    }
+
+    operation_result commit(uint64_t, uint32_t block_count)
+    {
+        boost::log::ipc::aux::interprocess_mutex::auto_unlock unlock(m_mutex);
+        publish_blocks(block_count);
+        return succeeded;
+    }
+
+    void cancel(uint64_t, uint32_t)
+    {
+        // The reserved blocks are not published, so just unlock the queue
+        m_mutex.unlock();
+    }
+
     operation_result receive(receive_handler handler, void* state)
     {
         if (!lock_queue())
@@ -366,6 +407,50 @@ public:
         return succeeded;
     }
 
+    operation_result receive_batch(receive_handler handler, void* state, uint32_t max_messages, bool blocking)
+    {
+        BOOST_ASSERT(max_messages > 0u);
+
+        if (!lock_queue())
+            return aborted;
+
+        boost::log::ipc::aux::interprocess_mutex::optional_unlock unlock(m_mutex);
+
+        header* const hdr = get_header();
+
+        while (true)
+        {
+            if (hdr->m_size > 0u)
+                break;
+
+            if (!blocking)
+                return no_space;
+
+            m_mutex.unlock();
+            unlock.disengage();
+
+            if (!m_nonempty_queue.wait(m_stop.get()) || !lock_queue())
+                return aborted;
+
+            unlock.engage(m_mutex);
+        }
+
+        uint32_t block_count = 0u;
+        try
+        {
+            read_messages(hdr->m_get_pos, hdr->m_size, max_messages, handler, state, block_count);
+        }
+        catch (...)
+        {
+            release_blocks(block_count);
+            throw;
+        }
+
+        release_blocks(block_count);
+
+        return succeeded;
+    }
+
     bool try_receive(receive_handler handler, void* state)
     {
         if (!lock_queue())
@@ -549,7 +634,40 @@ private:
     uint32_t estimate_block_count(size_type size) const BOOST_NOEXCEPT
     {
         // ceil((size + get_header_overhead()) / block_size)
-        return static_cast< uint32_t >((size + block_header::get_header_overhead() + m_block_size_mask) >> m_block_size_log2);
+        return static_cast< uint32_t >((static_cast< uint64_t >(size) + block_header::get_header_overhead() + m_block_size_mask) >> m_block_size_log2);
+    }
+
+    //! Returns the number of allocation blocks that are required to store a message of the specified size. Throws if the message cannot be stored in the queue.
+    uint32_t get_block_count(size_type size) const
+    {
+        const uint32_t block_count = estimate_block_count(size);
+        if (BOOST_UNLIKELY(block_count > get_header()->m_capacity || size == block_header::padding_size))
+            BOOST_LOG_THROW_DESCR(logic_error, "Message size exceeds the interprocess queue capacity");
+        return block_count;
+    }
+
+    //! Returns the number of unused blocks that have to be skipped at the end of the queue storage to store a message contiguously starting at the specified block
+    uint32_t get_padding_block_count(uint32_t pos, uint32_t block_count) const BOOST_NOEXCEPT
+    {
+        const uint32_t tail_block_count = get_header()->m_capacity - pos;
+        return tail_block_count < block_count ? tail_block_count : 0u;
+    }
+
+    //! Writes the header of the message reserved starting at the specified block and returns the pointer to the message data
+    void* prepare_reservation(uint32_t pos, size_type message_size) const BOOST_NOEXCEPT
+    {
+        header* const hdr = get_header();
+
+        block_header* block = hdr->get_block(pos);
+        if (get_padding_block_count(pos, estimate_block_count(message_size)) > 0u)
+        {
+            // Mark the blocks at the end of the storage as unused and place the message at the beginning
+            block->m_size = block_header::padding_size;
+            block = hdr->get_block(0u);
+        }
+
+        block->m_size = message_size;
+        return block->get_data();
     }
 
     //! Puts the message to the back of the queue
@@ -559,7 +677,7 @@ private:
 
         const uint32_t capacity = hdr->m_capacity;
         const size_type block_size = hdr->m_block_size;
-        uint32_t pos = hdr->m_put_pos;
+        const uint32_t pos = hdr->m_put_pos;
         BOOST_ASSERT(pos < capacity);
 
         block_header* block = hdr->get_block(pos);
@@ -568,17 +686,25 @@ private:
         size_type write_size = (std::min)(static_cast< size_type >((capacity - pos) * block_size - block_header::get_header_overhead()), message_size);
         std::memcpy(block->get_data(), message_data, write_size);
 
-        pos += block_count;
-        if (BOOST_UNLIKELY(pos >= capacity))
+        if (BOOST_UNLIKELY(write_size < message_size))
         {
             // Write the rest of the message at the beginning of the queue
-            pos -= capacity;
-            message_data = static_cast< const unsigned char* >(message_data) + write_size;
-            write_size = message_size - write_size;
-            if (write_size > 0u)
-                std::memcpy(hdr->get_block(0u), message_data, write_size);
+            std::memcpy(hdr->get_block(0u), static_cast< const unsigned char* >(message_data) + write_size, message_size - write_size);
         }
 
+        publish_blocks(block_count);
+    }
+
+    //! Makes the written blocks available to the reader
+    void publish_blocks(uint32_t block_count)
+    {
+        header* const hdr = get_header();
+
+        const uint32_t capacity = hdr->m_capacity;
+        uint32_t pos = hdr->m_put_pos + block_count;
+        if (BOOST_UNLIKELY(pos >= capacity))
+            pos -= capacity;
+
         hdr->m_put_pos = pos;
 
         const uint32_t old_queue_size = hdr->m_size;
@@ -598,23 +724,88 @@ private:
         BOOST_ASSERT(pos < capacity);
 
         block_header* block = hdr->get_block(pos);
-        size_type message_size = block->m_size;
-        uint32_t block_count = estimate_block_count(message_size);
+        uint32_t padding_block_count = 0u;
+        if (BOOST_UNLIKELY(block->m_size == block_header::padding_size))
+        {
+            // The message was placed at the beginning of the storage by try_reserve
+            padding_block_count = capacity - pos;
+            pos = 0u;
+            block = hdr->get_block(0u);
+        }
 
-        BOOST_ASSERT(block_count <= hdr->m_size);
+        size_type message_size = block->m_size;
 
         size_type read_size = (std::min)(static_cast< size_type >((capacity - pos) * block_size - block_header::get_header_overhead()), message_size);
         handler(state, block->get_data(), read_size);
 
-        pos += block_count;
-        if (BOOST_UNLIKELY(pos >= capacity))
+        if (BOOST_UNLIKELY(read_size < message_size))
         {
             // Read the tail of the message
-            pos -= capacity;
-            read_size = message_size - read_size;
-            if (read_size > 0u)
-                handler(state, hdr->get_block(0u), read_size);
+            handler(state, hdr->get_block(0u), message_size - read_size);
+        }
+
+        release_blocks(padding_block_count + estimate_block_count(message_size));
+    }
+
+    //! Invokes the handler for up to \a max_messages messages that start at the specified allocation block and occupy up to \a available_block_count blocks.
+    //! Accumulates the number of blocks occupied by the messages for which the handler returned in \a block_count.
+    void read_messages(uint32_t pos, uint32_t available_block_count, uint32_t max_messages, receive_handler handler, void* state, uint32_t& block_count) const
+    {
+        header* const hdr = get_header();
+
+        const uint32_t capacity = hdr->m_capacity;
+        const size_type block_size = hdr->m_block_size;
+        BOOST_ASSERT(pos < capacity);
+
+        // Used to make the messages that wrap around the end of the queue storage contiguous
+        std::vector< unsigned char > buffer;
+        for (uint32_t i = 0u; i < max_messages && block_count < available_block_count; ++i)
+        {
+            uint32_t index = pos + block_count;
+            if (index >= capacity)
+                index -= capacity;
+
+            block_header* block = hdr->get_block(index);
+            uint32_t padding_block_count = 0u;
+            if (BOOST_UNLIKELY(block->m_size == block_header::padding_size))
+            {
+                padding_block_count = capacity - index;
+                index = 0u;
+                block = hdr->get_block(0u);
+            }
+
+            const size_type message_size = block->m_size;
+            const size_type read_size = (std::min)(static_cast< size_type >((capacity - index) * block_size - block_header::get_header_overhead()), message_size);
+            if (BOOST_LIKELY(read_size == message_size))
+            {
+                handler(state, block->get_data(), message_size);
+            }
+            else
+            {
+                const unsigned char* p = static_cast< const unsigned char* >(block->get_data());
+                buffer.assign(p, p + read_size);
+                p = reinterpret_cast< const unsigned char* >(hdr->get_block(0u));
+                buffer.insert(buffer.end(), p, p + (message_size - read_size));
+                handler(state, &buffer[0], message_size);
+            }
+
+            block_count += padding_block_count + estimate_block_count(message_size);
         }
+    }
+
+    //! Releases the blocks that were read by the reader
+    void release_blocks(uint32_t block_count)
+    {
+        header* const hdr = get_header();
+        BOOST_ASSERT(block_count <= hdr->m_size);
+
+        if (block_count == 0u)
+            return;
+
+        const uint32_t capacity = hdr->m_capacity;
+        uint32_t pos = hdr->m_get_pos + block_count;
+        if (BOOST_UNLIKELY(pos >= capacity))
+            pos -= capacity;
 
         hdr->m_get_pos = pos;
         hdr->m_size -= block_count;
@@ -623,11 +814,14 @@ private:
     }
 };
 
-BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms)
+BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms, queue_mode mode)
 {
     BOOST_ASSERT(m_impl == NULL);
     if (!boost::log::aux::is_power_of_2(block_size))
         BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue block size is not a power of 2"));
+    // Lock-free modes are not supported on Windows, the queue always operates in locking mode
+    if (mode > multi_producer_mode)
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue mode is not supported"));
     try
     {
         m_impl = new implementation(open_mode::create_only, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms);
@@ -639,11 +833,14 @@ BOOST_LOG_API void reliable_message_queue::create(object_name const& name, uint3
     }
 }
 
-BOOST_LOG_API void reliable_message_queue::open_or_create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms)
+BOOST_LOG_API void reliable_message_queue::open_or_create(object_name const& name, uint32_t capacity, size_type block_size, overflow_policy oflow_policy, permissions const& perms, queue_mode mode)
 {
     BOOST_ASSERT(m_impl == NULL);
     if (!boost::log::aux::is_power_of_2(block_size))
         BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue block size is not a power of 2"));
+    // Lock-free modes are not supported on Windows, the queue always operates in locking mode
+    if (mode > multi_producer_mode)
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Interprocess message queue mode is not supported"));
     try
     {
         m_impl = new implementation(open_mode::open_or_create, name, capacity, static_cast< size_type >(boost::alignment::align_up(block_size, BOOST_LOG_CPU_CACHE_LINE_SIZE)), oflow_policy, perms);
@@ -701,6 +898,12 @@ BOOST_LOG_API reliable_message_queue::size_type reliable_message_queue::block_si
     return m_impl->block_size();
 }
 
+BOOST_LOG_API reliable_message_queue::queue_mode reliable_message_queue::mode() const
+{
+    BOOST_ASSERT(m_impl != NULL);
+    return locking_mode;
+}
+
 BOOST_LOG_API void reliable_message_queue::stop_local()
 {
     BOOST_ASSERT(m_impl != NULL);
@@ -763,6 +966,60 @@ BOOST_LOG_API bool reliable_message_queue::try_send(void const* message_data, si
     }
 }
 
+BOOST_LOG_API bool reliable_message_queue::try_reserve(size_type message_size, reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data == NULL);
+    try
+    {
+        void* p = m_impl->try_reserve(message_size, res.m_pos, res.m_block_count);
+        if (!p)
+            return false;
+
+        res.m_data = p;
+        res.m_size = message_size;
+        return true;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::commit(reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data != NULL);
+    try
+    {
+        const operation_result result = m_impl->commit(res.m_pos, res.m_block_count);
+        res = reservation();
+        return result;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API void reliable_message_queue::cancel(reservation& res)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    BOOST_ASSERT(res.m_data != NULL);
+    try
+    {
+        m_impl->cancel(res.m_pos, res.m_block_count);
+        res = reservation();
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
 BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::do_receive(receive_handler handler, void* state)
 {
     BOOST_ASSERT(m_impl != NULL);
@@ -791,6 +1048,34 @@ BOOST_LOG_API bool reliable_message_queue::do_try_receive(receive_handler handle
     }
 }
 
+BOOST_LOG_API reliable_message_queue::operation_result reliable_message_queue::do_receive_batch(receive_handler handler, void* state, uint32_t max_messages)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    try
+    {
+        return m_impl->receive_batch(handler, state, max_messages, true);
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
+BOOST_LOG_API bool reliable_message_queue::do_try_receive_batch(receive_handler handler, void* state, uint32_t max_messages)
+{
+    BOOST_ASSERT(m_impl != NULL);
+    try
+    {
+        return m_impl->receive_batch(handler, state, max_messages, false) == succeeded;
+    }
+    catch (boost::exception& e)
+    {
+        e << boost::log::ipc::object_name_info(m_impl->name());
+        throw;
+    }
+}
+
 //! Fixed buffer receive handler
 BOOST_LOG_API void reliable_message_queue::fixed_buffer_receive_handler(void* state, const void* data, size_type size)
 {
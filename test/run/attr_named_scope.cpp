@@ -158,6 +158,53 @@ BOOST_AUTO_TEST_CASE(detaching_from_thread)
     BOOST_CHECK_EQUAL(sc2->size(), 2UL);
 }
 
+// The test checks that values detached within the same scope share the scope stack snapshot
+BOOST_AUTO_TEST_CASE(detached_values_sharing)
+{
+    typedef attrs::named_scope named_scope;
+    typedef named_scope::sentry sentry;
+    typedef attrs::named_scope_list scopes;
+    typedef attrs::named_scope_entry scope;
+    typedef scope_test_data< char > scope_data;
+
+    named_scope attr;
+
+    sentry scope1(scope_data::scope1(), scope_data::file(), __LINE__);
+    logging::attribute_value val1 = attr.get_value();
+    val1.detach_from_thread();
+    logging::attribute_value val2 = attr.get_value();
+    val2.detach_from_thread();
+
+    logging::value_ref< scopes > sc1 = val1.extract< scopes >(), sc2 = val2.extract< scopes >();
+    BOOST_REQUIRE(!!sc1);
+    BOOST_REQUIRE(!!sc2);
+    BOOST_CHECK_EQUAL(&sc1.get(), &sc2.get());
+
+    logging::attribute_value val3;
+    {
+        scope new_scope(scope_data::scope2(), scope_data::file(), __LINE__);
+        named_scope::push_scope(new_scope);
+        val3 = attr.get_value();
+        val3.detach_from_thread();
+        named_scope::pop_scope();
+    }
+
+    logging::value_ref< scopes > sc3 = val3.extract< scopes >();
+    BOOST_REQUIRE(!!sc3);
+    BOOST_CHECK_NE(&sc1.get(), &sc3.get());
+    BOOST_REQUIRE_EQUAL(sc3->size(), 2UL);
+    BOOST_CHECK(sc3->back().scope_name == scope_data::scope2());
+
+    // The previous snapshot is not reused after the scope stack has changed
+    logging::attribute_value val4 = attr.get_value();
+    val4.detach_from_thread();
+    logging::value_ref< scopes > sc4 = val4.extract< scopes >();
+    BOOST_REQUIRE(!!sc4);
+    BOOST_CHECK_NE(&sc3.get(), &sc4.get());
+    BOOST_CHECK_EQUAL(sc4->size(), 1UL);
+    BOOST_CHECK_EQUAL(sc1->size(), 1UL);
+}
+
 // The test checks that output streaming is possible
 BOOST_AUTO_TEST_CASE(ostreaming)
 {
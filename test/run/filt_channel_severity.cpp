@@ -0,0 +1,133 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   filt_channel_severity.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the \c channel_severity_filter filter.
+ */
+
+#define BOOST_TEST_MODULE filt_channel_severity
+
+#include <string>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/expressions/predicates/channel_severity_filter.hpp>
+#include <boost/log/expressions/predicates/hierarchical_channel_severity_filter.hpp>
+
+namespace logging = boost::log;
+namespace attrs = logging::attributes;
+namespace expr = logging::expressions;
+
+namespace {
+
+typedef logging::trivial::severity_level severity_level;
+
+logging::attribute_value_set make_values(std::string const& channel, severity_level level)
+{
+    logging::attribute_set set1, set2, set3;
+    set1["Channel"] = attrs::make_constant(channel);
+    set1["Severity"] = attrs::make_constant(level);
+    logging::attribute_value_set values(set1, set2, set3);
+    values.freeze();
+    return values;
+}
+
+template< typename FilterT >
+void check_filter(FilterT& flt)
+{
+    flt["net"] = logging::trivial::error;
+    flt["gui"] = logging::trivial::info;
+    flt.add("net", logging::trivial::warning);
+    for (unsigned int i = 0u; i < 100u; ++i)
+    {
+        std::ostringstream strm;
+        strm << "channel" << i;
+        flt[strm.str()] = (i % 2u) == 0u ? logging::trivial::debug : logging::trivial::fatal;
+    }
+
+    logging::filter f = flt;
+    BOOST_CHECK(f(make_values("net", logging::trivial::warning)));
+    BOOST_CHECK(!f(make_values("net", logging::trivial::info)));
+    BOOST_CHECK(f(make_values("gui", logging::trivial::info)));
+    BOOST_CHECK(!f(make_values("gui", logging::trivial::debug)));
+    BOOST_CHECK(f(make_values("channel42", logging::trivial::debug)));
+    BOOST_CHECK(!f(make_values("channel43", logging::trivial::error)));
+    BOOST_CHECK(f(make_values("channel43", logging::trivial::fatal)));
+
+    // Unknown channels use the default result
+    BOOST_CHECK(!f(make_values("unknown", logging::trivial::fatal)));
+    flt.set_default(true);
+    f = flt;
+    BOOST_CHECK(f(make_values("unknown", logging::trivial::trace)));
+}
+
+} // namespace
+
+// The test checks the filter with the default channel ordering
+BOOST_AUTO_TEST_CASE(ordered_channels)
+{
+    expr::channel_severity_filter_actor< std::string, severity_level > flt =
+        expr::channel_severity_filter< std::string, severity_level >("Channel", "Severity");
+    check_filter(flt);
+}
+
+// The test checks the filter with the channel hash table
+BOOST_AUTO_TEST_CASE(hashed_channels)
+{
+    expr::channel_severity_filter_actor< std::string, severity_level, logging::fallback_to_none, logging::fallback_to_none, expr::hashed_channel_lookup<> > flt =
+        expr::channel_severity_filter< std::string, severity_level >("Channel", "Severity", logging::greater_equal(), expr::hashed_channel_lookup<>());
+    check_filter(flt);
+}
+
+// The test checks the filter for hierarchical channels
+BOOST_AUTO_TEST_CASE(hierarchical_channels)
+{
+    expr::hierarchical_channel_severity_filter_actor< std::string, severity_level > flt =
+        expr::hierarchical_channel_severity_filter< std::string, severity_level >("Channel", "Severity");
+    flt["net.http"] = logging::trivial::debug;
+    flt["net"] = logging::trivial::warning;
+
+    logging::filter f = flt;
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+        BOOST_CHECK(f(make_values("net.http.client", logging::trivial::debug)));
+        BOOST_CHECK(!f(make_values("net.http.client", logging::trivial::trace)));
+        BOOST_CHECK(f(make_values("net.http", logging::trivial::debug)));
+        BOOST_CHECK(!f(make_values("net.dns", logging::trivial::info)));
+        BOOST_CHECK(f(make_values("net.dns", logging::trivial::warning)));
+        BOOST_CHECK(!f(make_values("net", logging::trivial::info)));
+        BOOST_CHECK(!f(make_values("network", logging::trivial::fatal)));
+        BOOST_CHECK(!f(make_values("gui", logging::trivial::fatal)));
+    }
+
+    // Modifying the filter does not affect the filter created before
+    flt[""] = logging::trivial::error;
+    flt["net.http.client"] = logging::trivial::info;
+    BOOST_CHECK(!f(make_values("gui", logging::trivial::fatal)));
+    BOOST_CHECK(f(make_values("net.http.client", logging::trivial::debug)));
+
+    logging::filter f2 = flt;
+    BOOST_CHECK(f2(make_values("gui", logging::trivial::error)));
+    BOOST_CHECK(!f2(make_values("gui", logging::trivial::warning)));
+    BOOST_CHECK(f2(make_values("network", logging::trivial::fatal)));
+    BOOST_CHECK(!f2(make_values("net.http.client", logging::trivial::debug)));
+    BOOST_CHECK(f2(make_values("net.http.client.tls", logging::trivial::info)));
+    BOOST_CHECK(f2(make_values("net.http.server", logging::trivial::debug)));
+
+    flt.set_separator('/');
+    logging::filter f3 = flt;
+    BOOST_CHECK(!f3(make_values("net.http.server", logging::trivial::warning)));
+    BOOST_CHECK(f3(make_values("net/http/server", logging::trivial::warning)));
+    BOOST_CHECK(!f3(make_values("net/http/server", logging::trivial::debug)));
+}
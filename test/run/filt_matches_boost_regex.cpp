@@ -24,6 +24,7 @@
 #endif
 
 #include <string>
+#include <cstddef>
 #include <boost/regex.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/log/attributes/constant.hpp>
@@ -32,6 +33,7 @@
 #include <boost/log/expressions.hpp>
 #include <boost/log/support/regex.hpp>
 #include <boost/log/utility/string_literal.hpp>
+#include <boost/log/detail/match_result_cache.hpp>
 #include "char_definitions.hpp"
 
 namespace logging = boost::log;
@@ -114,3 +116,78 @@ BOOST_AUTO_TEST_CASE(composition_check)
     BOOST_CHECK(!f(values2));
     BOOST_CHECK(f(values3));
 }
+
+// The test checks that matching with the results cache works
+BOOST_AUTO_TEST_CASE(memoized_check)
+{
+    typedef logging::attribute_set attr_set;
+    typedef logging::attribute_value_set attr_values;
+    typedef logging::filter filter;
+    typedef test_data< char > data;
+    typedef boost::regex regex_type;
+
+    attr_set set1, set2, set3;
+    set1[data::attr1()] = attrs::constant< std::string >("127.0.0.1");
+    set1[data::attr2()] = attrs::constant< logging::string_literal >(logging::str_literal("BIG brown FoX"));
+    attr_values values1(set1, set2, set3);
+    values1.freeze();
+
+    set1[data::attr1()] = attrs::constant< std::string >("localhost");
+    set1[data::attr2()] = attrs::constant< logging::string_literal >(logging::str_literal("big brown fox"));
+    attr_values values2(set1, set2, set3);
+    values2.freeze();
+
+    filter f = expr::memoized_matches< std::string >(data::attr1(), regex_type("\\d+\\.\\d+\\.\\d+\\.\\d+"));
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+    }
+
+    // The results that do not fit in the cache are still correct
+    f = expr::memoized_matches< logging::string_literal >(data::attr2(), regex_type("[A-Z]* [a-z]* [A-Za-z]*"), 1u);
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+    }
+
+    // Attribute value not present
+    f = expr::memoized_matches< std::string >(data::attr4(), regex_type(".*"));
+    BOOST_CHECK(!f(values1));
+}
+
+// The test checks that repeated insertions of the same string do not exhaust the results cache capacity
+BOOST_AUTO_TEST_CASE(memoized_cache_capacity)
+{
+    logging::aux::match_result_cache cache(4u);
+
+    const std::string hot = "hot";
+    for (unsigned int i = 0u; i < 1000u; ++i)
+        cache.insert(hot.data(), hot.size(), true);
+
+    bool result = false;
+    BOOST_CHECK(cache.find(hot.data(), hot.size(), result));
+    BOOST_CHECK(result);
+
+    // The remaining capacity is still available for other strings
+    std::size_t cached = 1u;
+    for (unsigned int i = 0u; i < 1000u && cached < cache.capacity(); ++i)
+    {
+        const std::string str = std::to_string(i);
+        cache.insert(str.data(), str.size(), false);
+        cache.insert(str.data(), str.size(), false);
+        if (cache.find(str.data(), str.size(), result))
+        {
+            BOOST_CHECK(!result);
+            ++cached;
+        }
+    }
+    BOOST_CHECK_EQUAL(cached, cache.capacity());
+
+    // No more strings are cached when the capacity is reached
+    const std::string extra = "extra";
+    cache.insert(extra.data(), extra.size(), true);
+    BOOST_CHECK(!cache.find(extra.data(), extra.size(), result));
+    BOOST_CHECK(cache.find(hot.data(), hot.size(), result));
+}
@@ -172,3 +172,77 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(zip_decorator_formatting, CharT, char_types)
         BOOST_CHECK(equal_strings(strm1.str(), strm2.str()));
     }
 }
+
+#ifdef BOOST_LOG_USE_CHAR
+
+namespace {
+
+//! Applies the decorations one by one, the same way as the decorator is specified to do
+std::string decorate(std::string str, std::vector< std::string > const& patterns, std::vector< std::string > const& replacements)
+{
+    for (std::size_t i = 0u; i < patterns.size(); ++i)
+    {
+        for (std::size_t pos = str.find(patterns[i]); pos != std::string::npos; pos = str.find(patterns[i], pos))
+        {
+            str.replace(pos, patterns[i].size(), replacements[i]);
+            pos += replacements[i].size();
+        }
+    }
+    return str;
+}
+
+//! Checks that the decorator produces the same result as applying the decorations one by one
+void check_decorations(std::vector< std::string > const& patterns, std::vector< std::string > const& replacements, std::string const& special)
+{
+    typedef logging::basic_formatting_ostream< char > osstream;
+
+    const std::string plain(100u, 'x');
+    for (std::size_t prefix_size = 0u; prefix_size < 70u; prefix_size += 5u)
+    {
+        const std::string value = plain.substr(0u, prefix_size) + special + plain.substr(0u, prefix_size / 2u);
+
+        logging::attribute_set set1;
+        set1["Value"] = attrs::make_constant(value);
+        logging::record_view rec = make_record_view(set1);
+
+        std::string str;
+        osstream strm(str);
+        // The characters written before the decorator must not be decorated
+        strm << special;
+        logging::formatter f = expr::stream << expr::char_decor(patterns, replacements)[ expr::stream << expr::attr< std::string >("Value") ];
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK(equal_strings(str, special + decorate(value, patterns, replacements)));
+    }
+}
+
+} // namespace
+
+// Decorations with single character patterns are applied in a single pass, check that the result is the same
+BOOST_AUTO_TEST_CASE(single_char_decorations)
+{
+    std::vector< std::string > patterns, replacements;
+    patterns.push_back("&"); replacements.push_back("&amp;");
+    patterns.push_back("<"); replacements.push_back("&lt;");
+    patterns.push_back("\xff"); replacements.push_back("\\xFF");
+    patterns.push_back("<"); replacements.push_back("duplicate");
+    check_decorations(patterns, replacements, "a&b<c\xff" "d&&<");
+    check_decorations(patterns, replacements, "");
+
+    // Replacements contain the characters of the subsequent patterns
+    patterns.clear(); replacements.clear();
+    patterns.push_back("a"); replacements.push_back("b");
+    patterns.push_back("b"); replacements.push_back("c");
+    check_decorations(patterns, replacements, "abcab");
+
+    // A large number of patterns
+    patterns.clear(); replacements.clear();
+    for (char c = 'A'; c <= 'Z'; ++c)
+    {
+        patterns.push_back(std::string(1u, c));
+        replacements.push_back(std::string(2u, static_cast< char >(c + ('a' - 'A'))));
+    }
+    check_decorations(patterns, replacements, "HeLLo WorLD");
+}
+
+#endif // BOOST_LOG_USE_CHAR
@@ -61,6 +61,7 @@ namespace {
         static string_literal_type time_format() { return logging::str_literal("%H.%M.%S"); }
         static string_literal_type date_time_format() { return logging::str_literal("%d/%m/%Y %H.%M.%S"); }
         static string_literal_type time_duration_format() { return logging::str_literal("%+%H.%M.%S.%f"); }
+        static string_literal_type subseconds_date_time_format() { return logging::str_literal("%Y-%m-%d %H:%M:%S.%f [%f]"); }
     };
 #endif // BOOST_LOG_USE_CHAR
 
@@ -79,6 +80,7 @@ namespace {
         static string_literal_type time_format() { return logging::str_literal(L"%H.%M.%S"); }
         static string_literal_type date_time_format() { return logging::str_literal(L"%d/%m/%Y %H.%M.%S"); }
         static string_literal_type time_duration_format() { return logging::str_literal(L"%+%H.%M.%S.%f"); }
+        static string_literal_type subseconds_date_time_format() { return logging::str_literal(L"%Y-%m-%d %H:%M:%S.%f [%f]"); }
     };
 #endif // BOOST_LOG_USE_WCHAR_T
 
@@ -125,6 +127,56 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(date_time, CharT, char_types)
     }
 }
 
+// The test checks that date_time formatting works when the same formatter is used for a sequence of time points
+BOOST_AUTO_TEST_CASE_TEMPLATE(date_time_sequence, CharT, char_types)
+{
+    typedef logging::attribute_set attr_set;
+    typedef std::basic_string< CharT > string;
+    typedef logging::basic_formatting_ostream< CharT > osstream;
+    typedef logging::record_view record_view;
+    typedef logging::basic_formatter< CharT > formatter;
+    typedef test_data< CharT > data;
+    typedef date_time_formats< CharT > formats;
+    typedef boost::date_time::time_facet< ptime, CharT > facet;
+
+    const ptime base_time(gdate(2009, 2, 7), ptime::time_duration_type(14, 40, 15));
+    const ptime times[] =
+    {
+        base_time,
+        base_time + boost::posix_time::microseconds(1),
+        base_time + boost::posix_time::microseconds(999999),
+        base_time + boost::posix_time::seconds(1),
+        base_time + boost::posix_time::seconds(1) + boost::posix_time::microseconds(120034),
+        base_time + boost::posix_time::microseconds(5),
+        base_time + boost::posix_time::hours(24 * 365) + boost::posix_time::microseconds(5),
+        base_time + boost::posix_time::microseconds(5)
+    };
+
+    const logging::basic_string_literal< CharT > formats_list[] =
+    {
+        formats::subseconds_date_time_format(),
+        formats::default_date_time_format()
+    };
+
+    for (unsigned int i = 0u; i < sizeof(formats_list) / sizeof(*formats_list); ++i)
+    {
+        formatter f = expr::stream << expr::format_date_time< ptime >(data::attr1(), formats_list[i].c_str());
+        for (unsigned int j = 0u; j < sizeof(times) / sizeof(*times); ++j)
+        {
+            attr_set set1;
+            set1[data::attr1()] = attrs::make_constant(times[j]);
+            record_view rec = make_record_view(set1);
+
+            string str1, str2;
+            osstream strm1(str1), strm2(str2);
+            f(rec, strm1);
+            strm2.imbue(std::locale(strm2.getloc(), new facet(formats_list[i].c_str())));
+            strm2 << times[j];
+            BOOST_CHECK_MESSAGE(equal_strings(strm1.str(), strm2.str()), "format " << i << ", time point " << j);
+        }
+    }
+}
+
 // The test checks that date formatting work
 BOOST_AUTO_TEST_CASE_TEMPLATE(date, CharT, char_types)
 {
@@ -0,0 +1,217 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   form_json.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header contains tests for the JSON formatter.
+ */
+
+#define BOOST_TEST_MODULE form_json
+
+#include <ios>
+#include <limits>
+#include <locale>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/date_time/gregorian/gregorian_types.hpp>
+#if !defined(BOOST_LOG_WITHOUT_SETTINGS_PARSERS) && !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+#include <boost/log/utility/setup/formatter_parser.hpp>
+#endif
+#include "char_definitions.hpp"
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace attrs = logging::attributes;
+namespace expr = logging::expressions;
+
+namespace {
+
+//! A user-defined type that is output as a string
+struct point
+{
+    int x, y;
+};
+
+template< typename CharT, typename TraitsT >
+inline std::basic_ostream< CharT, TraitsT >& operator<< (std::basic_ostream< CharT, TraitsT >& strm, point const& p)
+{
+    strm << "\"" << p.x << "\\" << p.y << "\"";
+    return strm;
+}
+
+//! Numeric punctuation with a comma as the decimal separator and digit grouping
+struct comma_numpunct :
+    public std::numpunct< char >
+{
+protected:
+    char do_decimal_point() const { return ','; }
+    char do_thousands_sep() const { return '.'; }
+    std::string do_grouping() const { return "\3"; }
+};
+
+//! Formats the record with the formatter
+template< typename CharT >
+std::basic_string< CharT > format_record(logging::basic_formatter< CharT > const& fmt, logging::record_view const& rec, std::locale const& loc = std::locale())
+{
+    std::basic_string< CharT > str;
+    logging::basic_formatting_ostream< CharT > strm(str);
+    strm.imbue(loc);
+    fmt(rec, strm);
+    strm.flush();
+    return str;
+}
+
+} // namespace
+
+// The test checks that attribute values are written with the correct JSON types
+BOOST_AUTO_TEST_CASE(value_types)
+{
+    const point p = { 1, 2 };
+    logging::attribute_set set1;
+    set1["Int"] = attrs::make_constant(-10);
+    set1["Unsigned"] = attrs::make_constant(42u);
+    set1["Double"] = attrs::make_constant(2.5);
+    set1["NaN"] = attrs::make_constant(std::numeric_limits< double >::quiet_NaN());
+    set1["Inf"] = attrs::make_constant(std::numeric_limits< float >::infinity());
+    set1["True"] = attrs::make_constant(true);
+    set1["Char"] = attrs::make_constant('"');
+    set1["String"] = attrs::make_constant(std::string("abc"));
+    set1["Literal"] = attrs::make_constant(logging::str_literal("def"));
+    set1["Unsupported"] = attrs::make_constant(p);
+    logging::record_view rec = make_record_view(set1);
+
+    const char* const names[] = { "Int", "Unsigned", "Double", "NaN", "Inf", "True", "Char", "String", "Literal", "Unsupported", "Missing" };
+    logging::formatter fmt = expr::stream << expr::format_json(std::vector< logging::attribute_name >(names, names + sizeof(names) / sizeof(*names)));
+    BOOST_CHECK(equal_strings(format_record(fmt, rec),
+        "{\"Int\":-10,\"Unsigned\":42,\"Double\":2.5,\"NaN\":null,\"Inf\":null,\"True\":true,\"Char\":\"\\\"\",\"String\":\"abc\",\"Literal\":\"def\",\"Unsupported\":null}"));
+}
+
+// The test checks that numbers are written in valid JSON notation regardless of the stream locale and formatting flags
+BOOST_AUTO_TEST_CASE(number_formatting)
+{
+    logging::attribute_set set1;
+    set1["Int"] = attrs::make_constant(-1234567);
+    set1["Unsigned"] = attrs::make_constant(1234567u);
+    set1["Min"] = attrs::make_constant((std::numeric_limits< boost::int64_t >::min)());
+    set1["Double"] = attrs::make_constant(1234.5);
+    set1["Third"] = attrs::make_constant(1.0 / 3.0);
+    set1["Float"] = attrs::make_constant(0.1f);
+    set1["Large"] = attrs::make_constant(1.0e100);
+    logging::record_view rec = make_record_view(set1);
+
+    const char* const names[] = { "Int", "Unsigned", "Min", "Double", "Third", "Float", "Large" };
+    logging::formatter fmt = expr::stream << std::hex << std::showpos << std::fixed << expr::format_json(std::vector< logging::attribute_name >(names, names + sizeof(names) / sizeof(*names)));
+    BOOST_CHECK(equal_strings(format_record(fmt, rec, std::locale(std::locale::classic(), new comma_numpunct())),
+        "{\"Int\":-1234567,\"Unsigned\":1234567,\"Min\":-9223372036854775808,\"Double\":1234.5,\"Third\":0.33333333333333331,\"Float\":0.100000001,\"Large\":1e+100}"));
+}
+
+// The test checks that strings are escaped
+BOOST_AUTO_TEST_CASE(string_escaping)
+{
+    const std::string plain(100u, 'x');
+    const std::string special = "quote\" backslash\\ control\b\f\n\r\t\x01\x1f end";
+    const std::string escaped_special = "quote\\\" backslash\\\\ control\\b\\f\\n\\r\\t\\u0001\\u001f end";
+
+    // Check various positions of the special characters relative to vector boundaries
+    for (std::size_t prefix_size = 0u; prefix_size < 70u; prefix_size += 3u)
+    {
+        logging::attribute_set set1;
+        set1["Plain"] = attrs::make_constant(plain);
+        set1["Special"] = attrs::make_constant(plain.substr(0u, prefix_size) + special + "\xd0\x96");
+        logging::record_view rec = make_record_view(set1);
+
+        const char* const names[] = { "Plain", "Special" };
+        logging::formatter fmt = expr::stream << expr::format_json(std::vector< logging::attribute_name >(names, names + 2));
+        BOOST_CHECK(equal_strings(format_record(fmt, rec),
+            "{\"Plain\":\"" + plain + "\",\"Special\":\"" + plain.substr(0u, prefix_size) + escaped_special + "\xd0\x96\"}"));
+    }
+}
+
+// The test checks that values of user-defined types are written as escaped strings
+BOOST_AUTO_TEST_CASE(user_defined_types)
+{
+    const point p = { 1, 2 };
+    logging::attribute_set set1;
+    set1["Point"] = attrs::make_constant(p);
+    set1["Int"] = attrs::make_constant(7);
+    logging::record_view rec = make_record_view(set1);
+
+    const char* const names[] = { "Point", "Int" };
+    typedef boost::mpl::vector< point, int > value_types;
+    logging::formatter fmt = expr::stream << "json: " << expr::format_json< value_types >(std::vector< logging::attribute_name >(names, names + 2)) << " " << expr::message;
+    BOOST_CHECK(equal_strings(format_record(fmt, rec), "json: {\"Point\":\"\\\"1\\\\2\\\"\",\"Int\":7} "));
+}
+
+// The test checks that all attribute values are written if no names are specified
+BOOST_AUTO_TEST_CASE(all_attribute_values)
+{
+    logging::attribute_set set1;
+    set1["A"] = attrs::make_constant(1);
+    set1["B\""] = attrs::make_constant(std::string("b"));
+    logging::record_view rec = make_record_view(set1);
+
+    logging::formatter fmt = expr::stream << expr::format_json();
+    const std::string str = format_record(fmt, rec);
+    BOOST_CHECK(str == "{\"A\":1,\"B\\\"\":\"b\"}" || str == "{\"B\\\"\":\"b\",\"A\":1}");
+
+    logging::attribute_set set2;
+    fmt = expr::stream << expr::format_json();
+    BOOST_CHECK(equal_strings(format_record(fmt, make_record_view(set2)), "{}"));
+}
+
+// The test checks that the default JSON formatter writes date/time and severity values the same way as the formatter parser
+BOOST_AUTO_TEST_CASE(default_value_types)
+{
+    logging::attribute_set set1;
+    set1["TimeStamp"] = attrs::make_constant(boost::posix_time::ptime(boost::gregorian::date(2026, 1, 2), boost::posix_time::time_duration(3, 4, 5)));
+    set1["Severity"] = attrs::make_constant(logging::trivial::warning);
+    set1["Int"] = attrs::make_constant(5);
+    logging::record_view rec = make_record_view(set1);
+
+    const char* const names[] = { "TimeStamp", "Severity", "Int" };
+    logging::formatter fmt = expr::stream << expr::format_json(std::vector< logging::attribute_name >(names, names + 3));
+    const std::string str = format_record(fmt, rec);
+    BOOST_CHECK(equal_strings(str, "{\"TimeStamp\":\"2026-01-02 03:04:05.000000\",\"Severity\":\"warning\",\"Int\":5}"));
+
+
+#if !defined(BOOST_LOG_WITHOUT_SETTINGS_PARSERS) && !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
+    logging::formatter parsed_fmt = logging::parse_formatter("%JSON(attributes=\"TimeStamp,Severity,Int\")%");
+    BOOST_CHECK(equal_strings(format_record(parsed_fmt, rec), str));
+#endif
+}
+
+#ifdef BOOST_LOG_USE_WCHAR_T
+
+// The test checks that the formatter works with wide character streams
+BOOST_AUTO_TEST_CASE(wide_streams)
+{
+    logging::attribute_set set1;
+    set1["Narrow"] = attrs::make_constant(std::string("a\"b"));
+    set1["Wide"] = attrs::make_constant(std::wstring(L"c\nd"));
+    set1["Int"] = attrs::make_constant(5);
+    logging::record_view rec = make_record_view(set1);
+
+    const char* const names[] = { "Narrow", "Wide", "Int" };
+    logging::wformatter fmt = expr::stream << expr::format_json(std::vector< logging::attribute_name >(names, names + 3));
+    BOOST_CHECK(equal_strings(format_record(fmt, rec), L"{\"Narrow\":\"a\\\"b\",\"Wide\":\"c\\nd\",\"Int\":5}"));
+}
+
+#endif // BOOST_LOG_USE_WCHAR_T
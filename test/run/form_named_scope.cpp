@@ -535,3 +535,44 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(function_name_does_not_affect_non_function_scopes,
         BOOST_CHECK(check_formatting(data::function_name_format(), rec, strm.str()));
     }
 }
+
+// The test checks that the same formatter produces consistent results when function and file names are formatted repeatedly
+BOOST_AUTO_TEST_CASE_TEMPLATE(repeated_function_name_formatting, CharT, char_types)
+{
+    typedef attrs::named_scope named_scope;
+    typedef named_scope::sentry sentry;
+
+    typedef logging::attribute_set attr_set;
+    typedef std::basic_string< CharT > string;
+    typedef logging::basic_formatting_ostream< CharT > osstream;
+    typedef logging::record_view record_view;
+    typedef logging::basic_formatter< CharT > formatter;
+    typedef named_scope_test_data< CharT > data;
+
+    named_scope attr;
+
+    const unsigned int line1 = __LINE__;
+
+    attr_set set1;
+    set1[data::attr1()] = attr;
+
+    record_view rec = make_record_view(set1);
+
+    const CharT format[] = { '%', 'c', '|', '%', 'C', '|', '%', 'F', 0 };
+    formatter f = expr::stream << expr::format_named_scope(data::attr1(), keywords::format = format);
+    for (unsigned int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int i = 0; i < sizeof(named_scope_test_cases) / sizeof(*named_scope_test_cases); ++i)
+        {
+            sentry scope1(named_scope_test_cases[i].scope_name, data::posix_file(), line1, attrs::named_scope_entry::function);
+            string str;
+            osstream strm(str);
+            f(rec, strm);
+
+            string expected_str;
+            osstream expected(expected_str);
+            expected << named_scope_test_cases[i].function_name << "|" << named_scope_test_cases[i].function_name_no_scope << "|posix_file.cpp";
+            BOOST_CHECK_MESSAGE(equal_strings(strm.str(), expected.str()), "Scope name: " << named_scope_test_cases[i].scope_name << ", pass: " << pass);
+        }
+    }
+}
@@ -0,0 +1,328 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_binary_file_backend.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the binary file sink backend and the binary log reader.
+ */
+
+#define BOOST_TEST_MODULE sink_binary_file_backend
+
+#include <ios>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <boost/config.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/exceptions.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/keywords/file_name.hpp>
+#include <boost/log/keywords/open_mode.hpp>
+#include <boost/log/keywords/block_size.hpp>
+#include <boost/log/sinks/binary_file_backend.hpp>
+#include <boost/log/sources/deferred_logging.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include <boost/log/utility/binary_log_reader.hpp>
+#include <boost/log/utility/binary_string_conversion.hpp>
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace attrs = logging::attributes;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+
+namespace {
+
+//! The test file that is removed at the end of the test
+struct test_file
+{
+    boost::filesystem::path path;
+
+    explicit test_file(const char* name) : path(boost::filesystem::temp_directory_path() / name)
+    {
+        boost::filesystem::remove(path);
+    }
+
+    ~test_file()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove(path, ec);
+    }
+};
+
+//! Creates a record with a string message and a counter
+logging::record_view make_counter_record(int counter)
+{
+    logging::attribute_set attrs;
+    attrs["Counter"] = attrs::make_constant(counter);
+    attrs["Message"] = attrs::make_constant(std::string("message"));
+    return make_record_view(attrs);
+}
+
+//! A user-defined severity level type
+enum custom_severity_level
+{
+    custom_debug,
+    custom_alert
+};
+
+std::ostream& operator<< (std::ostream& strm, custom_severity_level level)
+{
+    strm << (level == custom_alert ? "ALERT" : "DEBUG");
+    return strm;
+}
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+//! A logger that passes deferred messages to the sink backend
+struct backend_logger
+{
+    sinks::binary_file_backend& backend;
+
+    explicit backend_logger(sinks::binary_file_backend& b) : backend(b)
+    {
+    }
+
+    logging::record open_record()
+    {
+        return make_record();
+    }
+
+    void push_record(BOOST_RV_REF(logging::record) rec)
+    {
+        backend.consume(rec.lock());
+    }
+};
+
+#endif // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+} // namespace
+
+// The test checks that attribute values are written and read back
+BOOST_AUTO_TEST_CASE(value_types)
+{
+    test_file file("boost_log_test_binary_file_value_types.blog");
+    const boost::posix_time::ptime now(boost::gregorian::date(2026, 10, 17), boost::posix_time::microseconds(123456789));
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path);
+
+        logging::attribute_set attrs;
+        attrs["Bool"] = attrs::make_constant(true);
+        attrs["Char"] = attrs::make_constant('x');
+        attrs["Int"] = attrs::make_constant(-123456);
+        attrs["UInt64"] = attrs::make_constant(static_cast< unsigned long long >(0xFEDCBA9876543210ull));
+        attrs["Double"] = attrs::make_constant(0.125);
+        attrs["String"] = attrs::make_constant(std::string("string value"));
+        attrs["Literal"] = attrs::make_constant(logging::str_literal("literal"));
+        attrs["Severity"] = attrs::make_constant(logging::trivial::warning);
+        attrs["TimeStamp"] = attrs::make_constant(now);
+        attrs["Special"] = attrs::make_constant(boost::posix_time::ptime(boost::posix_time::pos_infin));
+        attrs["Unsupported"] = attrs::make_constant(std::vector< int >(2u, 1));
+        backend.consume(make_record_view(attrs));
+    }
+
+    logging::binary_log_reader reader(file.path);
+    logging::attribute_value_set values;
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(values.size(), 10u);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< bool >("Bool", values), true);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< char >("Char", values), 'x');
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Int", values), -123456);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< unsigned long long >("UInt64", values), 0xFEDCBA9876543210ull);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< double >("Double", values), 0.125);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< std::string >("String", values), "string value");
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< std::string >("Literal", values), "literal");
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< logging::trivial::severity_level >("Severity", values), logging::trivial::warning);
+    BOOST_CHECK(logging::extract_or_throw< boost::posix_time::ptime >("TimeStamp", values) == now);
+    BOOST_CHECK(logging::extract_or_throw< boost::posix_time::ptime >("Special", values).is_pos_infinity());
+
+    logging::attribute_value_set more_values;
+    BOOST_CHECK(!reader.read(more_values));
+}
+
+// The test checks that values of the types with a registered string conversion are written as strings
+BOOST_AUTO_TEST_CASE(registered_string_conversion)
+{
+    test_file file("boost_log_test_binary_file_string_conversion.blog");
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path);
+
+        logging::attribute_set attrs;
+        attrs["Severity"] = attrs::make_constant(custom_debug);
+
+        // Values of unsupported types are not written until a conversion is registered
+        backend.consume(make_record_view(attrs));
+        logging::register_binary_string_conversion< custom_severity_level >();
+        backend.consume(make_record_view(attrs));
+    }
+
+    logging::binary_log_reader reader(file.path);
+    logging::attribute_value_set values;
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(values.size(), 0u);
+
+    logging::attribute_value_set converted_values;
+    BOOST_REQUIRE(reader.read(converted_values));
+    BOOST_CHECK_EQUAL(converted_values.size(), 1u);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< std::string >("Severity", converted_values), "DEBUG");
+}
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+// The test checks that deferred messages are written and can be formatted after reading
+BOOST_AUTO_TEST_CASE(deferred_messages)
+{
+    test_file file("boost_log_test_binary_file_deferred.blog");
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path);
+        backend_logger lg(backend);
+        for (int i = 0; i < 2; ++i)
+            BOOST_LOG_DEFERRED(lg, "%1%: %2% %3% %4% %5%", i, -7, std::string("str"), logging::str_literal("lit"), 1.5);
+    }
+
+    std::vector< logging::attribute_value_set > records;
+    {
+        logging::binary_log_reader reader(file.path);
+        logging::attribute_value_set values;
+        while (reader.read(values))
+        {
+            records.push_back(values);
+            values = logging::attribute_value_set();
+        }
+    }
+
+    // The decoded messages must be usable after the reader is destroyed
+    BOOST_REQUIRE_EQUAL(records.size(), 2u);
+    for (unsigned int i = 0u; i < records.size(); ++i)
+    {
+        logging::value_ref< logging::deferred_message > msg = logging::extract< logging::deferred_message >("Message", records[i]);
+        BOOST_REQUIRE(!!msg);
+        BOOST_CHECK(std::string(msg.get().site().file).find("sink_binary_file_backend.cpp") != std::string::npos);
+
+        std::string str;
+        logging::formatting_ostream strm(str);
+        strm << msg.get();
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, std::to_string(i) + ": -7 str lit 1.5");
+    }
+}
+
+#endif // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+// The test checks that records are split into blocks and appended to the existing file
+BOOST_AUTO_TEST_CASE(blocks_and_append)
+{
+    test_file file("boost_log_test_binary_file_append.blog");
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path, keywords::block_size = 64u);
+        for (int i = 0; i < 50; ++i)
+            backend.consume(make_counter_record(i));
+    }
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path, keywords::open_mode = std::ios_base::app);
+        for (int i = 50; i < 100; ++i)
+            backend.consume(make_counter_record(i));
+    }
+
+    logging::binary_log_reader reader(file.path);
+    int counter = 0;
+    logging::attribute_value_set values;
+    while (reader.read(values))
+    {
+        BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Counter", values), counter);
+        BOOST_CHECK_EQUAL(logging::extract_or_throw< std::string >("Message", values), "message");
+        values = logging::attribute_value_set();
+        ++counter;
+    }
+    BOOST_CHECK_EQUAL(counter, 100);
+}
+
+// The test checks that a damaged block is detected and skipped
+BOOST_AUTO_TEST_CASE(corruption)
+{
+    test_file file("boost_log_test_binary_file_corruption.blog");
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path);
+        backend.consume(make_counter_record(0));
+        backend.flush();
+        backend.consume(make_counter_record(1));
+        backend.flush();
+        backend.consume(make_counter_record(2));
+    }
+
+    // Damage the last byte of the second block
+    const boost::uintmax_t size = boost::filesystem::file_size(file.path);
+    {
+        std::fstream strm(file.path.string().c_str(), std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        const std::streamoff pos = static_cast< std::streamoff >(size - (size - 12u) / 3u - 1u);
+        strm.seekg(pos);
+        const char c = static_cast< char >(strm.get() ^ 0x55);
+        strm.seekp(pos);
+        strm.put(c);
+    }
+
+    logging::binary_log_reader reader(file.path);
+    logging::attribute_value_set values;
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Counter", values), 0);
+
+    values = logging::attribute_value_set();
+    BOOST_CHECK_THROW(reader.read(values), logging::parse_error);
+
+    values = logging::attribute_value_set();
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Counter", values), 2);
+
+    values = logging::attribute_value_set();
+    BOOST_CHECK(!reader.read(values));
+}
+
+// The test checks that garbage between segments is skipped
+BOOST_AUTO_TEST_CASE(resynchronization)
+{
+    test_file file("boost_log_test_binary_file_resync.blog");
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path);
+        backend.consume(make_counter_record(0));
+    }
+    {
+        std::ofstream strm(file.path.string().c_str(), std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+        strm << "\xFF\xFF\xFF\xFF garbage BLOG";
+    }
+    {
+        sinks::binary_file_backend backend(keywords::file_name = file.path, keywords::open_mode = std::ios_base::app);
+        backend.consume(make_counter_record(1));
+    }
+
+    logging::binary_log_reader reader(file.path);
+    logging::attribute_value_set values;
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Counter", values), 0);
+
+    values = logging::attribute_value_set();
+    BOOST_CHECK_THROW(reader.read(values), logging::parse_error);
+
+    values = logging::attribute_value_set();
+    BOOST_REQUIRE(reader.read(values));
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Counter", values), 1);
+
+    values = logging::attribute_value_set();
+    BOOST_CHECK(!reader.read(values));
+}
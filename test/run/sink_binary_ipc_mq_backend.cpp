@@ -0,0 +1,315 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_binary_ipc_mq_backend.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  The test verifies that \c binary_ipc_message_queue_backend and \c ipc::binary_record_receiver work as expected.
+ */
+
+#if !defined(BOOST_LOG_WITHOUT_IPC)
+
+#define BOOST_TEST_MODULE sink_binary_ipc_mq_backend
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/exceptions.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/basic_sink_backend.hpp>
+#include <boost/log/sinks/binary_ipc_message_queue_backend.hpp>
+#include <boost/log/utility/ipc/reliable_message_queue.hpp>
+#include <boost/log/utility/ipc/binary_record_receiver.hpp>
+#include <boost/log/utility/ipc/object_name.hpp>
+#include <boost/log/utility/open_mode.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/binary_string_conversion.hpp>
+#include <boost/test/unit_test.hpp>
+#if !defined(BOOST_WINDOWS)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <boost/log/sources/severity_channel_logger.hpp>
+#include <boost/log/sources/record_ostream.hpp>
+#include <boost/log/utility/setup/common_attributes.hpp>
+#endif
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace attrs = boost::log::attributes;
+namespace sinks = boost::log::sinks;
+
+typedef logging::ipc::reliable_message_queue queue_t;
+typedef sinks::binary_ipc_message_queue_backend< queue_t > backend_t;
+typedef logging::ipc::binary_record_receiver< queue_t > receiver_t;
+
+namespace {
+
+logging::ipc::object_name generate_ipc_queue_name()
+{
+    // Make sure IPC queue name is specific to the current process
+    std::ostringstream strm;
+    strm << "boost_log_test_binary_ipc_mq_backend"
+#if !defined(BOOST_WINDOWS)
+        << +getpid()
+#endif
+        ;
+    return logging::ipc::object_name(logging::ipc::object_name::session, strm.str());
+}
+
+const logging::ipc::object_name ipc_queue_name = generate_ipc_queue_name();
+const unsigned int capacity = 512;
+const unsigned int block_size = 1024;
+
+//! The backend stores the records received from the core
+class collecting_backend :
+    public sinks::basic_sink_backend< sinks::synchronized_feeding >
+{
+public:
+    std::vector< logging::record_view > m_records;
+
+    void consume(logging::record_view const& rec)
+    {
+        m_records.push_back(rec);
+    }
+};
+
+typedef sinks::synchronous_sink< collecting_backend > collecting_sink;
+
+//! A user-defined severity level type
+enum custom_severity_level
+{
+    custom_debug,
+    custom_alert
+};
+
+std::ostream& operator<< (std::ostream& strm, custom_severity_level level)
+{
+    strm << (level == custom_alert ? "ALERT" : "DEBUG");
+    return strm;
+}
+
+//! Adds the collecting sink to the core and removes it on destruction
+struct collecting_sink_guard
+{
+    boost::shared_ptr< collecting_sink > m_sink;
+
+    collecting_sink_guard() : m_sink(boost::make_shared< collecting_sink >())
+    {
+        logging::core::get()->add_sink(m_sink);
+    }
+
+    ~collecting_sink_guard()
+    {
+        logging::core::get()->remove_sink(m_sink);
+    }
+
+    std::vector< logging::record_view >& records()
+    {
+        return m_sink->locked_backend()->m_records;
+    }
+};
+
+} // namespace
+
+// The test checks that attribute values are transferred with their types preserved
+BOOST_AUTO_TEST_CASE(attribute_values_transfer)
+{
+    // Do a remove in case if a previous test failed
+    queue_t::remove(ipc_queue_name);
+
+    backend_t backend(logging::open_mode::create_only, ipc_queue_name, capacity, block_size);
+    receiver_t receiver(logging::open_mode::open_only, ipc_queue_name);
+    BOOST_CHECK(backend.is_open());
+    BOOST_CHECK(receiver.is_open());
+
+    const boost::posix_time::ptime time_stamp(boost::gregorian::date(2026, 10, 16), boost::posix_time::time_duration(12, 34, 56, 789012));
+    logging::attribute_set src_attrs;
+    src_attrs["Severity"] = attrs::make_constant(logging::trivial::warning);
+    src_attrs["Channel"] = attrs::make_constant(std::string("network"));
+    src_attrs["LineID"] = attrs::make_constant(42u);
+    src_attrs["Ratio"] = attrs::make_constant(0.25);
+    src_attrs["Offset"] = attrs::make_constant(-7L);
+    src_attrs["Flag"] = attrs::make_constant(true);
+    src_attrs["Literal"] = attrs::make_constant(logging::str_literal("literal"));
+    src_attrs["Precise"] = attrs::make_constant(0.5L);
+    src_attrs["TimeStamp"] = attrs::make_constant(time_stamp);
+    src_attrs["NotATime"] = attrs::make_constant(boost::posix_time::ptime());
+    src_attrs["Unsupported"] = attrs::make_constant(std::vector< int >(3u, 1));
+    logging::record_view rec = make_record_view(src_attrs);
+    backend.consume(rec);
+
+    collecting_sink_guard sink;
+
+    BOOST_REQUIRE(receiver.try_receive());
+    BOOST_REQUIRE_EQUAL(sink.records().size(), 1u);
+
+    logging::record_view const& received = sink.records()[0];
+    BOOST_CHECK_EQUAL(logging::extract< logging::trivial::severity_level >("Severity", received), logging::trivial::warning);
+    BOOST_CHECK_EQUAL(logging::extract< std::string >("Channel", received), "network");
+    BOOST_CHECK_EQUAL(logging::extract< unsigned int >("LineID", received), 42u);
+    BOOST_CHECK_EQUAL(logging::extract< double >("Ratio", received), 0.25);
+    BOOST_CHECK_EQUAL(logging::extract< long >("Offset", received), -7L);
+    BOOST_CHECK_EQUAL(logging::extract< bool >("Flag", received), true);
+    // String literals are received as strings, long double values keep their type
+    BOOST_CHECK_EQUAL(logging::extract< std::string >("Literal", received), "literal");
+    BOOST_CHECK_EQUAL(logging::extract< long double >("Precise", received), 0.5L);
+    BOOST_CHECK(logging::extract< boost::posix_time::ptime >("TimeStamp", received) == time_stamp);
+    BOOST_CHECK(logging::extract< boost::posix_time::ptime >("NotATime", received).get().is_not_a_date_time());
+    BOOST_CHECK(received.attribute_values().find("Unsupported") == received.attribute_values().end());
+
+    BOOST_CHECK(!receiver.try_receive());
+}
+
+// The test checks that values of the types with a registered string conversion are sent as strings
+BOOST_AUTO_TEST_CASE(registered_string_conversion)
+{
+    queue_t::remove(ipc_queue_name);
+
+    backend_t backend(logging::open_mode::create_only, ipc_queue_name, capacity, block_size);
+    receiver_t receiver(logging::open_mode::open_only, ipc_queue_name);
+
+    logging::attribute_set src_attrs;
+    src_attrs["Severity"] = attrs::make_constant(custom_alert);
+    logging::record_view rec = make_record_view(src_attrs);
+
+    collecting_sink_guard sink;
+
+    // Values of unsupported types are not sent until a conversion is registered
+    backend.consume(rec);
+    BOOST_REQUIRE(receiver.try_receive());
+    BOOST_REQUIRE_EQUAL(sink.records().size(), 1u);
+    BOOST_CHECK(sink.records()[0].attribute_values().find("Severity") == sink.records()[0].attribute_values().end());
+
+    logging::register_binary_string_conversion< custom_severity_level >();
+    backend.consume(rec);
+    BOOST_REQUIRE(receiver.try_receive());
+    BOOST_REQUIRE_EQUAL(sink.records().size(), 2u);
+    BOOST_CHECK_EQUAL(logging::extract< std::string >("Severity", sink.records()[1]), "ALERT");
+}
+
+// The test checks that only the selected attribute values are sent
+BOOST_AUTO_TEST_CASE(selected_attribute_values)
+{
+    queue_t::remove(ipc_queue_name);
+
+    backend_t backend(logging::open_mode::create_only, ipc_queue_name, capacity, block_size);
+    receiver_t receiver(logging::open_mode::open_only, ipc_queue_name);
+    backend.add_attribute("Channel");
+    backend.add_attribute("Missing");
+
+    logging::attribute_set src_attrs;
+    src_attrs["Severity"] = attrs::make_constant(logging::trivial::error);
+    src_attrs["Channel"] = attrs::make_constant(std::string("disk"));
+    logging::record_view rec = make_record_view(src_attrs);
+    backend.consume(rec);
+
+    collecting_sink_guard sink;
+
+    BOOST_REQUIRE(receiver.try_receive());
+    BOOST_REQUIRE_EQUAL(sink.records().size(), 1u);
+    BOOST_CHECK_EQUAL(logging::extract< std::string >("Channel", sink.records()[0]), "disk");
+    BOOST_CHECK(sink.records()[0].attribute_values().find("Severity") == sink.records()[0].attribute_values().end());
+}
+
+// The test checks that malformed messages are reported and removed from the queue
+BOOST_AUTO_TEST_CASE(malformed_messages)
+{
+    queue_t::remove(ipc_queue_name);
+
+    queue_t queue(logging::open_mode::create_only, ipc_queue_name, capacity, block_size);
+    receiver_t receiver(logging::open_mode::open_only, ipc_queue_name);
+
+    const char garbage[] = "garbage";
+    BOOST_CHECK(queue.try_send(garbage, sizeof(garbage)));
+
+    collecting_sink_guard sink;
+
+    BOOST_CHECK_THROW(receiver.try_receive(), logging::parse_error);
+    BOOST_CHECK(sink.records().empty());
+    BOOST_CHECK(!receiver.try_receive());
+}
+
+#if !defined(BOOST_WINDOWS)
+
+// The test checks that records logged in one process are received in another process
+BOOST_AUTO_TEST_CASE(interprocess_transfer)
+{
+    queue_t::remove(ipc_queue_name);
+
+    const unsigned int record_count = 100u;
+    receiver_t receiver(logging::open_mode::create_only, ipc_queue_name, capacity, block_size);
+
+    pid_t pid = fork();
+    BOOST_REQUIRE(pid >= 0);
+    if (pid == 0)
+    {
+        // Child process: send the records through the logging core and exit
+        int status = 0;
+        try
+        {
+            typedef sinks::synchronous_sink< backend_t > sink_t;
+            boost::shared_ptr< sink_t > sink = boost::make_shared< sink_t >(logging::open_mode::open_only, ipc_queue_name);
+            logging::core::get()->remove_all_sinks();
+            logging::core::get()->add_sink(sink);
+            logging::add_common_attributes();
+
+            logging::sources::severity_channel_logger< logging::trivial::severity_level, std::string > lg(logging::keywords::channel = "child");
+            for (unsigned int i = 0u; i < record_count; ++i)
+                BOOST_LOG_SEV(lg, logging::trivial::info) << "Record " << i;
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        _exit(status);
+    }
+
+    collecting_sink_guard sink;
+    while (sink.records().size() < record_count)
+    {
+        BOOST_REQUIRE_EQUAL(receiver.receive(), queue_t::succeeded);
+    }
+
+    int status = 0;
+    BOOST_REQUIRE_EQUAL(waitpid(pid, &status, 0), pid);
+    BOOST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    std::vector< logging::record_view > const& records = sink.records();
+    BOOST_REQUIRE_EQUAL(records.size(), record_count);
+    for (unsigned int i = 0u; i < record_count; ++i)
+    {
+        std::ostringstream strm;
+        strm << "Record " << i;
+        BOOST_CHECK_EQUAL(logging::extract< std::string >("Message", records[i]), strm.str());
+        BOOST_CHECK_EQUAL(logging::extract< std::string >("Channel", records[i]), "child");
+        BOOST_CHECK_EQUAL(logging::extract< logging::trivial::severity_level >("Severity", records[i]), logging::trivial::info);
+        BOOST_CHECK_EQUAL(logging::extract< unsigned int >("LineID", records[i]), i + 1u);
+        BOOST_CHECK(logging::extract< logging::attributes::current_process_id::value_type >("ProcessID", records[i]).get().native_id() == static_cast< unsigned long >(pid));
+    }
+}
+
+#endif // !defined(BOOST_WINDOWS)
+
+#else // !defined(BOOST_LOG_WITHOUT_IPC)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_LOG_WITHOUT_IPC)
@@ -0,0 +1,274 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_syslog_stream_backend.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  The test verifies that \c syslog_backend sends log records over local stream sockets as expected.
+ */
+
+#include <boost/log/detail/config.hpp>
+
+#if !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO)
+#include <boost/asio/local/stream_protocol.hpp>
+#endif
+
+#if !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO) && defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+#define BOOST_TEST_MODULE sink_syslog_stream_backend
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/log/exceptions.hpp>
+#include <boost/log/sinks/syslog_backend.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/test/unit_test.hpp>
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace sinks = boost::log::sinks;
+namespace keywords = boost::log::keywords;
+namespace asio = boost::asio;
+
+namespace {
+
+const char socket_path[] = "boost_log_test_syslog_stream_backend.sock";
+
+//! A stream socket listener that receives syslog messages
+template< typename ProtocolT >
+struct basic_listener
+{
+    asio::io_context m_IOContext;
+    typename ProtocolT::acceptor m_Acceptor;
+    typename ProtocolT::socket m_Socket;
+    std::string m_Buffer;
+
+    explicit basic_listener(typename ProtocolT::endpoint const& ep) :
+        m_Acceptor(m_IOContext),
+        m_Socket(m_IOContext)
+    {
+        m_Acceptor.open(ep.protocol());
+        m_Acceptor.bind(ep);
+        m_Acceptor.listen();
+    }
+
+    ~basic_listener()
+    {
+        boost::system::error_code ec;
+        m_Socket.close(ec);
+        m_Acceptor.close(ec);
+    }
+
+    void accept()
+    {
+        boost::system::error_code ec;
+        m_Socket.close(ec);
+        m_Buffer.clear();
+        m_Acceptor.accept(m_Socket);
+    }
+
+    void disconnect()
+    {
+        m_Socket.close();
+    }
+
+    //! Receives the specified number of messages and strips RFC6587 framing
+    std::vector< std::string > receive(std::size_t count)
+    {
+        std::vector< std::string > messages;
+        while (messages.size() < count)
+        {
+            std::string::size_type pos = m_Buffer.find(' ');
+            if (pos != std::string::npos)
+            {
+                std::size_t size = std::stoul(m_Buffer.substr(0u, pos));
+                if (m_Buffer.size() >= pos + 1u + size)
+                {
+                    messages.push_back(m_Buffer.substr(pos + 1u, size));
+                    m_Buffer.erase(0u, pos + 1u + size);
+                    continue;
+                }
+            }
+
+            char buf[1024];
+            std::size_t n = m_Socket.read_some(asio::buffer(buf));
+            m_Buffer.append(buf, n);
+        }
+
+        return messages;
+    }
+};
+
+//! A local socket listener
+struct listener :
+    public basic_listener< asio::local::stream_protocol >
+{
+    listener() :
+        basic_listener< asio::local::stream_protocol >(make_endpoint())
+    {
+    }
+
+    ~listener()
+    {
+        std::remove(socket_path);
+    }
+
+    static asio::local::stream_protocol::endpoint make_endpoint()
+    {
+        std::remove(socket_path);
+        return asio::local::stream_protocol::endpoint(socket_path);
+    }
+};
+
+//! A TCP listener on the loopback interface
+struct tcp_listener :
+    public basic_listener< asio::ip::tcp >
+{
+    tcp_listener() :
+        basic_listener< asio::ip::tcp >(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0u))
+    {
+    }
+
+    unsigned short port() const
+    {
+        return m_Acceptor.local_endpoint().port();
+    }
+};
+
+//! Checks that the message has RFC5424 format and returns the MSG part
+std::string check_message(std::string const& msg, const char* app_name)
+{
+    // <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA MSG
+    BOOST_CHECK_EQUAL(msg.compare(0u, 6u, "<14>1 "), 0);
+
+    std::string::size_type pos = 5u;
+    std::vector< std::string > fields;
+    for (unsigned int i = 0u; i < 6u; ++i)
+    {
+        std::string::size_type next = msg.find(' ', pos + 1u);
+        BOOST_REQUIRE(next != std::string::npos);
+        fields.push_back(msg.substr(pos + 1u, next - pos - 1u));
+        pos = next;
+    }
+
+    BOOST_CHECK_EQUAL(fields[0].size(), 27u); // YYYY-MM-DDThh:mm:ss.uuuuuuZ
+    BOOST_CHECK_EQUAL(fields[0][fields[0].size() - 1u], 'Z');
+    BOOST_CHECK_EQUAL(fields[2], app_name);
+    BOOST_CHECK_EQUAL(fields[4], "-");
+    BOOST_CHECK_EQUAL(fields[5], "-");
+
+    return msg.substr(pos + 1u);
+}
+
+} // namespace
+
+// The test checks that the messages are framed and formatted correctly
+BOOST_AUTO_TEST_CASE(message_format)
+{
+    listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::local_socket_based, keywords::ident = "test app");
+    backend.set_target_path(socket_path);
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "Hello, world!");
+
+    srv.accept();
+    std::vector< std::string > messages = srv.receive(1u);
+    BOOST_CHECK_EQUAL(check_message(messages[0], "test_app"), "Hello, world!");
+}
+
+// The test checks that batched messages are sent when the backend is flushed
+BOOST_AUTO_TEST_CASE(batching)
+{
+    listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::local_socket_based);
+    backend.set_target_path(socket_path);
+    backend.set_max_batch_size(10u);
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "message 1");
+    backend.consume(rec, "message 2");
+    backend.consume(rec, "message 3");
+    backend.flush();
+
+    srv.accept();
+    std::vector< std::string > messages = srv.receive(3u);
+    BOOST_CHECK_EQUAL(check_message(messages[0], "-"), "message 1");
+    BOOST_CHECK_EQUAL(check_message(messages[1], "-"), "message 2");
+    BOOST_CHECK_EQUAL(check_message(messages[2], "-"), "message 3");
+}
+
+// The test checks that the backend reconnects if the connection is closed by the server
+BOOST_AUTO_TEST_CASE(reconnection)
+{
+    listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::local_socket_based);
+    backend.set_target_path(socket_path);
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "message 1");
+
+    srv.accept();
+    std::vector< std::string > messages = srv.receive(1u);
+    BOOST_CHECK_EQUAL(check_message(messages[0], "-"), "message 1");
+
+    srv.disconnect();
+
+    backend.consume(rec, "message 2");
+
+    srv.accept();
+    messages = srv.receive(1u);
+    BOOST_CHECK_EQUAL(check_message(messages[0], "-"), "message 2");
+}
+
+// The test checks that the local socket path must be specified
+BOOST_AUTO_TEST_CASE(target_path_required)
+{
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::local_socket_based);
+
+    logging::record_view rec = make_record_view();
+    BOOST_CHECK_THROW(backend.consume(rec, "message"), logging::setup_error);
+}
+
+// The test checks that the messages are sent over TCP
+BOOST_AUTO_TEST_CASE(tcp_transport)
+{
+    tcp_listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::tcp_socket_based, keywords::ident = "test_app");
+    backend.set_target_address("127.0.0.1", srv.port());
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "message 1");
+    backend.consume(rec, "message 2");
+
+    // The connection may still be in progress after sending the records, flushing waits for it
+    backend.flush();
+
+    srv.accept();
+    std::vector< std::string > messages = srv.receive(2u);
+    BOOST_CHECK_EQUAL(check_message(messages[0], "test_app"), "message 1");
+    BOOST_CHECK_EQUAL(check_message(messages[1], "test_app"), "message 2");
+}
+
+#else // !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO) && defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO) && defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
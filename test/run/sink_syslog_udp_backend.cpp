@@ -0,0 +1,275 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_syslog_udp_backend.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  The test verifies that \c syslog_backend sends log records over UDP as expected.
+ */
+
+#include <boost/log/detail/config.hpp>
+
+#if !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO)
+
+#define BOOST_TEST_MODULE sink_syslog_udp_backend
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/log/sinks/syslog_backend.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/test/unit_test.hpp>
+#include "make_record.hpp"
+
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/log/core/core.hpp>
+#include <boost/log/sources/logger.hpp>
+#include <boost/log/sources/record_ostream.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#endif
+
+namespace logging = boost::log;
+namespace sinks = boost::log::sinks;
+namespace keywords = boost::log::keywords;
+namespace asio = boost::asio;
+
+namespace {
+
+//! The number of packets that exceeds the maximum number of messages the kernel sends in one \c sendmmsg call
+const std::size_t large_batch_size = 1100u;
+
+//! A UDP socket that receives syslog packets
+struct listener
+{
+    asio::io_context m_IOContext;
+    asio::ip::udp::socket m_Socket;
+
+    listener() :
+        m_Socket(m_IOContext, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0u))
+    {
+        boost::system::error_code ec;
+        m_Socket.set_option(asio::socket_base::receive_buffer_size(4 * 1024 * 1024), ec);
+    }
+
+    unsigned short port() const
+    {
+        return m_Socket.local_endpoint().port();
+    }
+
+    //! Returns the size of the socket receive buffer
+    std::size_t receive_buffer_size() const
+    {
+        asio::socket_base::receive_buffer_size opt;
+        m_Socket.get_option(opt);
+        return static_cast< std::size_t >(opt.value());
+    }
+
+    //! Returns \c true if a packet can be received within the specified time
+    bool wait(std::chrono::milliseconds timeout)
+    {
+        m_IOContext.restart();
+        bool received = false;
+        m_Socket.async_wait(asio::socket_base::wait_read, [&received](boost::system::error_code const& ec) { received = !ec; });
+        m_IOContext.run_for(timeout);
+        if (!received)
+        {
+            m_Socket.cancel();
+            m_IOContext.restart();
+            m_IOContext.run();
+        }
+        return received;
+    }
+
+    //! Receives the specified number of packets
+    std::vector< std::string > receive(std::size_t count)
+    {
+        std::vector< std::string > packets;
+        while (packets.size() < count && wait(std::chrono::seconds(5)))
+        {
+            char buf[2048];
+            std::size_t n = m_Socket.receive(asio::buffer(buf));
+            packets.push_back(std::string(buf, n));
+        }
+        return packets;
+    }
+
+    //! Returns \c true if there are no packets pending to be received
+    bool is_empty()
+    {
+        return !wait(std::chrono::milliseconds(100));
+    }
+};
+
+//! Checks that the packet has RFC3164 format and returns the MSG part
+std::string check_packet(std::string const& packet)
+{
+    // <PRI>Mmm dd hh:mm:ss HOSTNAME MSG
+    BOOST_CHECK_EQUAL(packet.compare(0u, 4u, "<14>"), 0);
+
+    static const char* const months[12] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+    bool month_found = false;
+    for (unsigned int i = 0u; i < 12u && !month_found; ++i)
+        month_found = packet.compare(4u, 3u, months[i]) == 0;
+    BOOST_CHECK(month_found);
+
+    const std::string time_stamp = packet.substr(7u, 13u);
+    BOOST_REQUIRE_EQUAL(time_stamp.size(), 13u);
+    BOOST_CHECK_EQUAL(time_stamp[0], ' ');
+    BOOST_CHECK(time_stamp[1] == ' ' || (time_stamp[1] >= '1' && time_stamp[1] <= '3'));
+    BOOST_CHECK(time_stamp[2] >= '0' && time_stamp[2] <= '9');
+    BOOST_CHECK_EQUAL(time_stamp[3], ' ');
+    BOOST_CHECK_EQUAL(time_stamp[6], ':');
+    BOOST_CHECK_EQUAL(time_stamp[9], ':');
+    BOOST_CHECK_EQUAL(time_stamp[12], ' ');
+
+    const std::string host_name = asio::ip::host_name();
+    BOOST_CHECK_EQUAL(packet.compare(20u, host_name.size(), host_name), 0);
+    BOOST_REQUIRE_GT(packet.size(), 20u + host_name.size());
+    BOOST_CHECK_EQUAL(packet[20u + host_name.size()], ' ');
+
+    return packet.substr(21u + host_name.size());
+}
+
+} // namespace
+
+// The test checks that the packets are formatted correctly
+BOOST_AUTO_TEST_CASE(packet_format)
+{
+    listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::udp_socket_based);
+    backend.set_target_address("127.0.0.1", srv.port());
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "Hello, world!");
+    backend.consume(rec, "Second message");
+
+    std::vector< std::string > packets = srv.receive(2u);
+    BOOST_REQUIRE_EQUAL(packets.size(), 2u);
+    BOOST_CHECK_EQUAL(check_packet(packets[0]), "Hello, world!");
+    BOOST_CHECK_EQUAL(check_packet(packets[1]), "Second message");
+
+    // Long messages are truncated to the maximum packet size
+    backend.consume(rec, std::string(2000u, 'x'));
+    packets = srv.receive(1u);
+    BOOST_REQUIRE_EQUAL(packets.size(), 1u);
+    BOOST_CHECK_EQUAL(packets[0].size(), 1024u);
+}
+
+// The test checks that the packets are sent in batches
+BOOST_AUTO_TEST_CASE(batching)
+{
+    listener srv;
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::udp_socket_based);
+    backend.set_target_address("127.0.0.1", srv.port());
+    backend.set_max_batch_size(3u);
+
+    logging::record_view rec = make_record_view();
+    backend.consume(rec, "1");
+    backend.consume(rec, "2");
+    BOOST_CHECK(srv.is_empty());
+
+    // The batch is sent when complete
+    backend.consume(rec, "3");
+    std::vector< std::string > packets = srv.receive(3u);
+    BOOST_REQUIRE_EQUAL(packets.size(), 3u);
+    BOOST_CHECK_EQUAL(check_packet(packets[0]), "1");
+    BOOST_CHECK_EQUAL(check_packet(packets[1]), "2");
+    BOOST_CHECK_EQUAL(check_packet(packets[2]), "3");
+
+    // An incomplete batch is sent on flush
+    backend.consume(rec, "4");
+    BOOST_CHECK(srv.is_empty());
+    backend.flush();
+    packets = srv.receive(1u);
+    BOOST_REQUIRE_EQUAL(packets.size(), 1u);
+    BOOST_CHECK_EQUAL(check_packet(packets[0]), "4");
+
+    // Reducing the batch size sends the buffered packets
+    backend.consume(rec, "5");
+    backend.consume(rec, "6");
+    backend.set_max_batch_size(1u);
+    packets = srv.receive(2u);
+    BOOST_REQUIRE_EQUAL(packets.size(), 2u);
+    BOOST_CHECK_EQUAL(check_packet(packets[1]), "6");
+}
+
+// The test checks that all packets of a batch are sent if the batch cannot be sent in one system call
+BOOST_AUTO_TEST_CASE(large_batch)
+{
+    listener srv;
+    if (srv.receive_buffer_size() < large_batch_size * 1024u)
+    {
+        BOOST_TEST_MESSAGE("The socket receive buffer is too small to receive the batch, skipping the test");
+        return;
+    }
+
+    sinks::syslog_backend backend(keywords::use_impl = sinks::syslog::udp_socket_based);
+    backend.set_target_address("127.0.0.1", srv.port());
+    backend.set_max_batch_size(large_batch_size);
+
+    logging::record_view rec = make_record_view();
+    for (std::size_t i = 0u; i < large_batch_size; ++i)
+        backend.consume(rec, std::to_string(i));
+
+    std::vector< std::string > packets = srv.receive(large_batch_size);
+    BOOST_REQUIRE_EQUAL(packets.size(), large_batch_size);
+    for (std::size_t i = 0u; i < large_batch_size; ++i)
+        BOOST_CHECK_EQUAL(check_packet(packets[i]), std::to_string(i));
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that the asynchronous frontend sends the batch when its queue is drained
+BOOST_AUTO_TEST_CASE(async_frontend_flush)
+{
+    typedef sinks::asynchronous_sink< sinks::syslog_backend > sink_type;
+
+    listener srv;
+
+    boost::shared_ptr< sinks::syslog_backend > backend = boost::make_shared< sinks::syslog_backend >(keywords::use_impl = sinks::syslog::udp_socket_based);
+    backend->set_target_address("127.0.0.1", srv.port());
+    backend->set_max_batch_size(100u);
+
+    boost::shared_ptr< sink_type > sink = boost::make_shared< sink_type >(backend);
+    logging::core::get()->add_sink(sink);
+
+    logging::sources::logger lg;
+    for (unsigned int i = 0u; i < 5u; ++i)
+        BOOST_LOG(lg) << i;
+
+    // The records are sent without flushing the sink, even though the batch is not complete
+    std::vector< std::string > packets = srv.receive(5u);
+    BOOST_CHECK_EQUAL(packets.size(), 5u);
+    for (std::size_t i = 0u; i < packets.size(); ++i)
+        BOOST_CHECK_EQUAL(check_packet(packets[i]), std::to_string(i));
+
+    logging::core::get()->remove_sink(sink);
+    sink->stop();
+}
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+#else // !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO)
+
+int main()
+{
+    return 0;
+}
+
+#endif // !defined(BOOST_LOG_WITHOUT_SYSLOG) && !defined(BOOST_LOG_NO_ASIO)
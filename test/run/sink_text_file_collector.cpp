@@ -0,0 +1,259 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_text_file_collector.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the file collector of the text file backend.
+ */
+
+#define BOOST_TEST_MODULE sink_text_file_collector
+
+#include <string>
+#include <cstddef>
+#include <chrono>
+#include <thread>
+#include <boost/cstdint.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+
+namespace logging = boost::log;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+namespace fs = boost::filesystem;
+
+namespace {
+
+//! Creates a temporary directory for the test and removes it on destruction
+struct temp_directory
+{
+    fs::path m_Path;
+
+    temp_directory() : m_Path(fs::temp_directory_path() / fs::unique_path("boost_log_test_%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(m_Path);
+    }
+
+    ~temp_directory()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(m_Path, ec);
+    }
+};
+
+void create_file(fs::path const& p, std::size_t size)
+{
+    fs::ofstream strm(p);
+    strm << std::string(size, 'x');
+}
+
+std::size_t count_files(fs::path const& dir)
+{
+    std::size_t n = 0u;
+    for (fs::directory_iterator it(dir), end; it != end; ++it)
+        ++n;
+    return n;
+}
+
+} // namespace
+
+// The test checks that the pending files are stored on the collector destruction
+BOOST_AUTO_TEST_CASE(async_collection)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+
+    {
+        boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+        (
+            keywords::target = target,
+            keywords::max_files = 3u,
+            keywords::async_collection = true
+        );
+
+        for (unsigned int i = 0u; i < 5u; ++i)
+        {
+            const fs::path file = dir.m_Path / ("file" + std::to_string(i) + ".log");
+            create_file(file, 10u);
+            collector->store_file(file);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(count_files(target), 3u);
+    BOOST_CHECK(!fs::exists(dir.m_Path / "file4.log"));
+    BOOST_CHECK(fs::exists(target / "file4.log"));
+    BOOST_CHECK(fs::exists(target / "file2.log"));
+    BOOST_CHECK(!fs::exists(target / "file1.log"));
+}
+
+// The test checks that the file name can be reused right after the file is passed to the collector in asynchronous mode
+BOOST_AUTO_TEST_CASE(async_collection_same_name)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+
+    {
+        boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+        (
+            keywords::target = target,
+            keywords::async_collection = true
+        );
+
+        for (unsigned int i = 0u; i < 3u; ++i)
+        {
+            create_file(dir.m_Path / "file.log", 10u * (i + 1u));
+            collector->store_file(dir.m_Path / "file.log");
+        }
+    }
+
+    BOOST_CHECK(!fs::exists(dir.m_Path / "file.log"));
+    BOOST_CHECK_EQUAL(count_files(dir.m_Path), 1u);
+    BOOST_CHECK_EQUAL(count_files(target), 3u);
+    boost::uintmax_t total_size = 0u;
+    for (fs::directory_iterator it(target), end; it != end; ++it)
+        total_size += fs::file_size(it->path());
+    BOOST_CHECK_EQUAL(total_size, 60u);
+    BOOST_CHECK_EQUAL(fs::file_size(target / "file.log"), 10u);
+}
+
+// The test checks that the files found by scanning are tracked by the collector
+BOOST_AUTO_TEST_CASE(scan_for_files)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+    fs::create_directories(target);
+    create_file(target / "file1.log", 10u);
+    create_file(target / "file2.log", 10u);
+
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+        const bool use_index = i > 0u;
+        boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+        (
+            // The trailing separator must not affect the identification of the stored files
+            keywords::target = (dir.m_Path / "." / "stored" / "").string(),
+            keywords::max_files = 2u,
+            keywords::persistent_index = use_index
+        );
+
+        sinks::file::scan_result res = collector->scan_for_files(sinks::file::scan_all);
+        BOOST_CHECK_EQUAL(res.found_count, 2u);
+
+        // The files that are already tracked are not found again
+        res = collector->scan_for_files(sinks::file::scan_all);
+        BOOST_CHECK_EQUAL(res.found_count, 0u);
+
+        // Storing a new file deletes the oldest tracked file to maintain the limit
+        create_file(dir.m_Path / "file.log", 10u);
+        collector->store_file(dir.m_Path / "file.log");
+        BOOST_CHECK_EQUAL(count_files(target) - (use_index ? 1u : 0u), 2u);
+        BOOST_CHECK(fs::exists(target / "file.log"));
+        BOOST_CHECK(!fs::exists(target / "file1.log") || !fs::exists(target / "file2.log"));
+
+        fs::remove(target / "file.log");
+        create_file(target / "file1.log", 10u);
+        create_file(target / "file2.log", 10u);
+    }
+}
+
+// The test checks that the persistent index is not trusted if the indexed files were modified in place
+BOOST_AUTO_TEST_CASE(persistent_index_validation)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+    // Non-ASCII file names must be preserved in the index
+#if defined(BOOST_WINDOWS_API)
+    const fs::path non_ascii_name(L"file\u0416.log");
+#else
+    const fs::path non_ascii_name("file\xd0\x96.log");
+#endif
+
+    {
+        boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+        (
+            keywords::target = target,
+            keywords::persistent_index = true
+        );
+
+        // The index is created by scanning
+        collector->scan_for_files(sinks::file::scan_all);
+        create_file(dir.m_Path / "file1.log", 10u);
+        collector->store_file(dir.m_Path / "file1.log");
+        create_file(dir.m_Path / non_ascii_name, 10u);
+        collector->store_file(dir.m_Path / non_ascii_name);
+    }
+
+    // Rewriting a file in place does not change the directory modification time
+    create_file(target / "file1.log", 100u);
+
+    boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+    (
+        keywords::target = target,
+        keywords::max_size = 150u,
+        keywords::persistent_index = true
+    );
+
+    sinks::file::scan_result res = collector->scan_for_files(sinks::file::scan_all);
+    BOOST_CHECK_EQUAL(res.found_count, 2u);
+
+    // The new size of the rewritten file must be accounted for, so storing one more file exceeds the limit
+    create_file(dir.m_Path / "file2.log", 50u);
+    collector->store_file(dir.m_Path / "file2.log");
+    BOOST_CHECK_EQUAL(count_files(target) - 1u, 2u);
+    BOOST_CHECK(fs::exists(target / "file2.log"));
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that the errors in the collection thread are reported to the caller
+BOOST_AUTO_TEST_CASE(async_collection_error)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+
+    boost::shared_ptr< sinks::file::collector > collector = sinks::file::make_collector
+    (
+        keywords::target = target,
+        keywords::async_collection = true
+    );
+
+    // The file does not exist, so storing it fails
+    collector->store_file(dir.m_Path / "missing.log");
+    BOOST_CHECK_THROW(collector->scan_for_files(sinks::file::scan_all), std::exception);
+
+    // The error is only reported once
+    BOOST_CHECK_NO_THROW(collector->scan_for_files(sinks::file::scan_all));
+
+    // The error is also reported by store_file once the failed file is processed. The file passed to that call is still stored.
+    collector->store_file(dir.m_Path / "missing.log");
+    bool thrown = false;
+    try
+    {
+        for (unsigned int i = 0u; i < 10000u; ++i)
+        {
+            const fs::path other = dir.m_Path / ("other" + std::to_string(i) + ".log");
+            create_file(other, 10u);
+            collector->store_file(other);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    catch (std::exception&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+
+    BOOST_CHECK_NO_THROW(collector->scan_for_files(sinks::file::scan_all));
+    BOOST_CHECK(fs::exists(target / "other0.log"));
+}
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
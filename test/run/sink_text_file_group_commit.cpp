@@ -0,0 +1,210 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_text_file_group_commit.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the group commit mode of the text file backend.
+ */
+
+#define BOOST_TEST_MODULE sink_text_file_group_commit
+
+#include <chrono>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/system/system_error.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+namespace fs = boost::filesystem;
+
+namespace {
+
+//! Creates a temporary directory for the test and removes it on destruction
+struct temp_directory
+{
+    fs::path m_Path;
+
+    temp_directory() : m_Path(fs::temp_directory_path() / fs::unique_path("boost_log_test_%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(m_Path);
+    }
+
+    ~temp_directory()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(m_Path, ec);
+    }
+};
+
+//! Each record takes 4 bytes in the file, including the trailing newline
+const boost::uintmax_t record_size = 4u;
+
+struct group_commit_fixture
+{
+    temp_directory m_Dir;
+    boost::shared_ptr< sinks::text_file_backend > m_Backend;
+    logging::record_view m_Record;
+
+    group_commit_fixture() :
+        m_Backend(boost::make_shared< sinks::text_file_backend >
+        (
+            keywords::file_name = m_Dir.m_Path / "file.log",
+            keywords::enable_final_rotation = false
+        )),
+        m_Record(make_record_view())
+    {
+    }
+
+    void write(unsigned int count)
+    {
+        for (unsigned int i = 0u; i < count; ++i)
+            m_Backend->consume(m_Record, "rec");
+    }
+
+    //! Returns the number of records that were passed to the OS
+    boost::uintmax_t written_records() const
+    {
+        return fs::file_size(m_Dir.m_Path / "file.log") / record_size;
+    }
+
+    //! Waits until the specified number of records are passed to the OS
+    bool wait_for_written_records(boost::uintmax_t count) const
+    {
+        for (unsigned int i = 0u; i < 10000u; ++i)
+        {
+            if (written_records() >= count)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+// The test checks that durability tickets are assigned to records in the order they are written
+BOOST_FIXTURE_TEST_CASE(tickets, group_commit_fixture)
+{
+    BOOST_CHECK_EQUAL(m_Backend->get_durability_ticket(), 0u);
+
+    m_Backend->set_group_commit(3u, std::chrono::hours(1));
+    boost::uintmax_t prev_ticket = m_Backend->get_durability_ticket();
+    for (unsigned int i = 0u; i < 10u; ++i)
+    {
+        write(1u);
+        const boost::uintmax_t ticket = m_Backend->get_durability_ticket();
+        BOOST_CHECK_EQUAL(ticket, prev_ticket + 1u);
+        prev_ticket = ticket;
+    }
+
+    // Waiting for a ticket commits all records up to and including the one the ticket was issued for
+    m_Backend->wait_until_durable(prev_ticket);
+    BOOST_CHECK_EQUAL(written_records(), 10u);
+
+    // Waiting for an already committed ticket does not block
+    m_Backend->wait_until_durable(prev_ticket - 5u);
+}
+
+// The test checks that the written records are committed when the group is complete
+BOOST_FIXTURE_TEST_CASE(group_size, group_commit_fixture)
+{
+    m_Backend->set_group_commit(3u, std::chrono::hours(1));
+
+    // The records are not flushed before the group is complete
+    write(2u);
+    BOOST_CHECK_EQUAL(written_records(), 0u);
+
+    write(1u);
+    BOOST_CHECK(wait_for_written_records(3u));
+    BOOST_CHECK_EQUAL(written_records(), 3u);
+
+    write(1u);
+    BOOST_CHECK_EQUAL(written_records(), 3u);
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that the written records are committed when the commit interval expires
+BOOST_FIXTURE_TEST_CASE(group_interval, group_commit_fixture)
+{
+    m_Backend->set_group_commit(1000u, std::chrono::milliseconds(100));
+
+    write(2u);
+    BOOST_CHECK(wait_for_written_records(2u));
+    BOOST_CHECK_EQUAL(written_records(), 2u);
+}
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that flushing the backend commits the outstanding records
+BOOST_FIXTURE_TEST_CASE(flush, group_commit_fixture)
+{
+    m_Backend->set_group_commit(1000u, std::chrono::hours(1));
+
+    write(5u);
+    BOOST_CHECK_EQUAL(written_records(), 0u);
+
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records(), 5u);
+
+    // Disabling group commit also commits the outstanding records
+    write(2u);
+    m_Backend->set_group_commit(0u);
+    BOOST_CHECK_EQUAL(written_records(), 7u);
+    BOOST_CHECK_EQUAL(m_Backend->get_durability_ticket(), 0u);
+}
+
+// The test checks that the outstanding records are committed on file rotation
+BOOST_FIXTURE_TEST_CASE(rotation, group_commit_fixture)
+{
+    m_Backend->set_group_commit(1000u, std::chrono::hours(1));
+    m_Backend->set_close_handler([](sinks::text_file_backend::stream_type& strm) { strm << "end\n"; });
+
+    write(5u);
+    m_Backend->rotate_file();
+    BOOST_CHECK_EQUAL(written_records(), 6u);
+}
+
+#if defined(__linux__)
+
+// The test checks that commit errors are reported to the threads waiting for the records and to flush
+BOOST_AUTO_TEST_CASE(commit_errors)
+{
+    // Writing to /dev/full always fails with ENOSPC
+    boost::shared_ptr< sinks::text_file_backend > backend = boost::make_shared< sinks::text_file_backend >
+    (
+        keywords::file_name = "/dev/full",
+        keywords::enable_final_rotation = false
+    );
+    backend->set_group_commit(1000u, std::chrono::hours(1));
+
+    const logging::record_view rec = make_record_view();
+    backend->consume(rec, "rec");
+    backend->consume(rec, "rec");
+    const boost::uintmax_t ticket = backend->get_durability_ticket();
+    BOOST_CHECK_THROW(backend->wait_until_durable(ticket), boost::system::system_error);
+    BOOST_CHECK_THROW(backend->wait_until_durable(ticket - 1u), boost::system::system_error);
+
+    // The error persists for the records written later to the same file
+    backend->consume(rec, "rec");
+    BOOST_CHECK_THROW(backend->flush(), boost::system::system_error);
+    BOOST_CHECK_THROW(backend->wait_until_durable(backend->get_durability_ticket()), boost::system::system_error);
+}
+
+#endif // defined(__linux__)
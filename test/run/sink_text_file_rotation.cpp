@@ -0,0 +1,155 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_text_file_rotation.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the time-based file rotation predicates of the text file backend.
+ */
+
+#define BOOST_TEST_MODULE sink_text_file_rotation
+
+#include <ctime>
+#include <cstddef>
+#include <chrono>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/date_time/posix_time/conversion.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+namespace fs = boost::filesystem;
+namespace posix_time = boost::posix_time;
+
+namespace {
+
+//! Creates a temporary directory for the test and removes it on destruction
+struct temp_directory
+{
+    fs::path m_Path;
+
+    temp_directory() : m_Path(fs::temp_directory_path() / fs::unique_path("boost_log_test_%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(m_Path);
+    }
+
+    ~temp_directory()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(m_Path, ec);
+    }
+};
+
+std::size_t count_files(fs::path const& dir)
+{
+    std::size_t n = 0u;
+    for (fs::directory_iterator it(dir), end; it != end; ++it)
+        ++n;
+    return n;
+}
+
+//! Returns the local time a few seconds from now
+posix_time::time_duration local_time_of_day_from_now(unsigned int seconds)
+{
+    const posix_time::ptime utc = posix_time::from_time_t(std::time(NULL) + seconds);
+    return boost::date_time::c_local_adjustor< posix_time::ptime >::utc_to_local(utc).time_of_day();
+}
+
+} // namespace
+
+// The test checks that the time interval rotation predicate triggers after the interval passes
+BOOST_AUTO_TEST_CASE(time_interval)
+{
+    sinks::file::rotation_at_time_interval pred(posix_time::seconds(1));
+
+    // The first call only starts measuring the interval
+    BOOST_CHECK(!pred());
+    BOOST_CHECK(!pred());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    BOOST_CHECK(pred());
+
+    // The interval starts anew after the rotation
+    BOOST_CHECK(!pred());
+}
+
+// The test checks that the time point rotation predicate triggers when the time point is reached
+BOOST_AUTO_TEST_CASE(time_point)
+{
+    const posix_time::time_duration tod = local_time_of_day_from_now(2u);
+    sinks::file::rotation_at_time_point pred(
+        static_cast< unsigned char >(tod.hours()),
+        static_cast< unsigned char >(tod.minutes()),
+        static_cast< unsigned char >(tod.seconds()));
+
+    BOOST_CHECK(!pred());
+    BOOST_CHECK(!pred());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3100));
+    BOOST_CHECK(pred());
+
+    // The next rotation is scheduled for the next day
+    BOOST_CHECK(!pred());
+}
+
+// The test checks that the time point rotation predicates for a specific day do not trigger prematurely
+BOOST_AUTO_TEST_CASE(time_point_day)
+{
+    const posix_time::time_duration tod = local_time_of_day_from_now(3600u);
+    const unsigned char hour = static_cast< unsigned char >(tod.hours());
+
+    sinks::file::rotation_at_time_point weekday_pred(boost::date_time::Monday, hour);
+    BOOST_CHECK(!weekday_pred());
+    BOOST_CHECK(!weekday_pred());
+
+    sinks::file::rotation_at_time_point monthday_pred(boost::gregorian::greg_day(1), hour);
+    BOOST_CHECK(!monthday_pred());
+    BOOST_CHECK(!monthday_pred());
+}
+
+// The test checks that the backend rotates the file with a time-based rotation predicate
+BOOST_AUTO_TEST_CASE(backend_rotation)
+{
+    temp_directory dir;
+    const fs::path target = dir.m_Path / "stored";
+
+    {
+        boost::shared_ptr< sinks::text_file_backend > backend = boost::make_shared< sinks::text_file_backend >
+        (
+            keywords::file_name = dir.m_Path / "file%N.log",
+            keywords::time_based_rotation = sinks::file::rotation_at_time_interval(posix_time::seconds(1)),
+            keywords::enable_final_rotation = false
+        );
+        backend->set_file_collector(sinks::file::make_collector(keywords::target = target));
+
+        logging::attribute_set attrs;
+        logging::record_view rec = make_record_view(attrs);
+
+        backend->consume(rec, "first");
+        backend->consume(rec, "second");
+        BOOST_CHECK_EQUAL(count_files(target), 0u);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        backend->consume(rec, "third");
+        BOOST_CHECK_EQUAL(count_files(target), 1u);
+    }
+
+    BOOST_CHECK_EQUAL(count_files(target), 1u);
+    BOOST_CHECK(fs::exists(dir.m_Path / "file1.log"));
+}
@@ -0,0 +1,203 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   sink_text_multifile_backend.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the open file cache of the text multi-file backend.
+ */
+
+#define BOOST_TEST_MODULE sink_text_multifile_backend
+
+#include <string>
+#include <chrono>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/sinks/text_multifile_backend.hpp>
+#include "make_record.hpp"
+
+namespace logging = boost::log;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+namespace fs = boost::filesystem;
+
+namespace {
+
+//! Creates a temporary directory for the test and removes it on destruction
+struct temp_directory
+{
+    fs::path m_Path;
+
+    temp_directory() : m_Path(fs::temp_directory_path() / fs::unique_path("boost_log_test_%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(m_Path);
+    }
+
+    ~temp_directory()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(m_Path, ec);
+    }
+};
+
+//! Each record takes 4 bytes in the file, including the trailing newline
+const boost::uintmax_t record_size = 4u;
+
+//! File name composer that returns the file name selected by the test
+struct file_name_composer
+{
+    typedef fs::path result_type;
+
+    fs::path const* m_FileName;
+
+    explicit file_name_composer(fs::path const& file_name) : m_FileName(&file_name)
+    {
+    }
+
+    result_type operator() (logging::record_view const&) const
+    {
+        return *m_FileName;
+    }
+};
+
+struct multifile_fixture
+{
+    temp_directory m_Dir;
+    fs::path m_FileName;
+    boost::shared_ptr< sinks::text_multifile_backend > m_Backend;
+    logging::record_view m_Record;
+
+    multifile_fixture() :
+        m_Backend(boost::make_shared< sinks::text_multifile_backend >()),
+        m_Record(make_record_view())
+    {
+        m_Backend->set_file_name_composer(file_name_composer(m_FileName));
+    }
+
+    void write(const char* file_name)
+    {
+        m_FileName = m_Dir.m_Path / file_name;
+        m_Backend->consume(m_Record, "rec");
+    }
+
+    //! Returns the number of records that were passed to the OS
+    boost::uintmax_t written_records(const char* file_name) const
+    {
+        const fs::path p = m_Dir.m_Path / file_name;
+        if (!fs::exists(p))
+            return 0u;
+        return fs::file_size(p) / record_size;
+    }
+};
+
+} // namespace
+
+// The test checks that files are closed after every record by default
+BOOST_FIXTURE_TEST_CASE(no_cache, multifile_fixture)
+{
+    write("a.log");
+    write("b.log");
+    write("a.log");
+    BOOST_CHECK_EQUAL(written_records("a.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 1u);
+}
+
+// The test checks that the least recently used file is closed when the cache is full and reopened for appending
+BOOST_FIXTURE_TEST_CASE(eviction, multifile_fixture)
+{
+    m_Backend->set_file_cache(2u, std::chrono::milliseconds::zero());
+
+    write("a.log");
+    write("b.log");
+    write("a.log");
+    // The records are kept in the buffers of the open files
+    BOOST_CHECK_EQUAL(written_records("a.log"), 0u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 0u);
+
+    // b.log is the least recently used file, so it is closed
+    write("c.log");
+    BOOST_CHECK_EQUAL(written_records("a.log"), 0u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 1u);
+    BOOST_CHECK_EQUAL(written_records("c.log"), 0u);
+
+    // b.log is reopened and the new record is appended, a.log is closed
+    write("b.log");
+    BOOST_CHECK_EQUAL(written_records("a.log"), 2u);
+
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records("a.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("c.log"), 1u);
+
+    // Reducing the cache size closes the excess files
+    write("c.log");
+    m_Backend->set_file_cache(1u, std::chrono::milliseconds::zero());
+    BOOST_CHECK_EQUAL(written_records("c.log"), 1u);
+    write("b.log");
+    BOOST_CHECK_EQUAL(written_records("b.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("c.log"), 2u);
+
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records("b.log"), 3u);
+}
+
+// The test checks that the files that were not used for the idle timeout are closed
+BOOST_FIXTURE_TEST_CASE(idle_close, multifile_fixture)
+{
+    m_Backend->set_file_cache(10u, std::chrono::milliseconds(100));
+
+    write("a.log");
+    write("b.log");
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // Writing a record closes the idle files
+    write("c.log");
+    BOOST_CHECK_EQUAL(written_records("a.log"), 1u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 1u);
+    BOOST_CHECK_EQUAL(written_records("c.log"), 0u);
+
+    // Writing to a closed file reopens it for appending
+    write("a.log");
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // Flushing the backend also closes the idle files
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records("a.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("c.log"), 1u);
+
+    // The file is kept open again, so the new record stays in the file buffer until flushed
+    write("c.log");
+    BOOST_CHECK_EQUAL(written_records("c.log"), 1u);
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records("c.log"), 2u);
+}
+
+// The test checks that the records are flushed after every record with auto_flush
+BOOST_FIXTURE_TEST_CASE(auto_flush, multifile_fixture)
+{
+    m_Backend = boost::make_shared< sinks::text_multifile_backend >(keywords::max_open_files = 2u, keywords::auto_flush = true);
+    m_Backend->set_file_name_composer(file_name_composer(m_FileName));
+
+    write("a.log");
+    write("b.log");
+    write("a.log");
+    BOOST_CHECK_EQUAL(written_records("a.log"), 2u);
+    BOOST_CHECK_EQUAL(written_records("b.log"), 1u);
+
+    m_Backend->auto_flush(false);
+    write("b.log");
+    BOOST_CHECK_EQUAL(written_records("b.log"), 1u);
+    m_Backend->flush();
+    BOOST_CHECK_EQUAL(written_records("b.log"), 2u);
+}
@@ -0,0 +1,190 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   src_deferred_logging.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header contains tests for the deferred logging macros.
+ */
+
+#define BOOST_TEST_MODULE src_deferred_logging
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <sstream>
+#include <boost/config.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/string_view.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/core/record_view.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/attribute_set.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/expressions/formatter.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include <boost/log/sources/deferred_logging.hpp>
+#include <boost/log/utility/deferred_message.hpp>
+#include <boost/log/utility/string_literal.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include "char_definitions.hpp"
+#include "make_record.hpp"
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+namespace logging = boost::log;
+namespace attrs = logging::attributes;
+namespace keywords = logging::keywords;
+
+namespace {
+
+//! A user-defined type that is formatted by the caller
+struct point
+{
+    int x, y;
+};
+
+template< typename CharT, typename TraitsT >
+inline std::basic_ostream< CharT, TraitsT >& operator<< (std::basic_ostream< CharT, TraitsT >& strm, point const& p)
+{
+    strm << "(" << p.x << ", " << p.y << ")";
+    return strm;
+}
+
+//! A logger that saves the pushed records
+struct test_logger
+{
+    std::vector< logging::record_view > records;
+
+    logging::record open_record()
+    {
+        return make_record();
+    }
+
+    template< typename ArgsT >
+    logging::record open_record(ArgsT const& args)
+    {
+        logging::attribute_set attrs;
+        attrs["Severity"] = attrs::make_constant(static_cast< int >(args[keywords::severity]));
+        return make_record(attrs);
+    }
+
+    void push_record(BOOST_RV_REF(logging::record) rec)
+    {
+        records.push_back(rec.lock());
+    }
+};
+
+//! Formats the record with the default formatter
+template< typename CharT >
+std::basic_string< CharT > format_record(logging::record_view const& rec)
+{
+    std::basic_string< CharT > str;
+    logging::basic_formatting_ostream< CharT > strm(str);
+    logging::basic_formatter< CharT > fmt;
+    fmt(rec, strm);
+    strm.flush();
+    return str;
+}
+
+} // namespace
+
+// The test checks that the message is formatted from the format string and arguments
+BOOST_AUTO_TEST_CASE(message_formatting)
+{
+    test_logger lg;
+    const std::string str = "string";
+    const char* c_str = "c string";
+    BOOST_LOG_DEFERRED(lg, "no arguments");
+    BOOST_LOG_DEFERRED(lg, "int: %1%, unsigned: %2%, char: %3%, bool: %4%", -10, 20u, 'x', true);
+    BOOST_LOG_DEFERRED(lg, "%3% %2% %1% %2%", str, c_str, boost::string_view("view"));
+    BOOST_LOG_DEFERRED(lg, "double: %1%, literal: %2%", 2.5, logging::str_literal("literal"));
+    BOOST_LOG_DEFERRED(lg, "percent: 100%%, invalid: %0% %3% %x %", 1, 2);
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 5u);
+
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[0]), "no arguments"));
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[1]), "int: -10, unsigned: 20, char: x, bool: true"));
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[2]), "view c string string c string"));
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[3]), "double: 2.5, literal: literal"));
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[4]), "percent: 100%, invalid: %0% %3% %x %"));
+}
+
+// The test checks that the statement description is available from the record
+BOOST_AUTO_TEST_CASE(message_site)
+{
+    test_logger lg;
+    const unsigned int line = __LINE__ + 1;
+    BOOST_LOG_DEFERRED(lg, "%1% and %2%", 1, "two");
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 1u);
+
+    logging::value_ref< logging::deferred_message > msg = logging::extract< logging::deferred_message >("Message", lg.records[0]);
+    BOOST_REQUIRE(!!msg);
+    logging::deferred_message_site const& site = msg.get().site();
+    BOOST_CHECK_EQUAL(std::string(site.format, site.format_size), std::string("%1% and %2%"));
+    BOOST_CHECK_EQUAL(site.line, line);
+    BOOST_CHECK(std::string(site.file).find("src_deferred_logging.cpp") != std::string::npos);
+    BOOST_REQUIRE_EQUAL(site.argument_count, 2u);
+    BOOST_CHECK_EQUAL(site.argument_types[0], static_cast< unsigned char >(logging::deferred_argument::signed_integer));
+    BOOST_CHECK_EQUAL(site.argument_types[1], static_cast< unsigned char >(logging::deferred_argument::string));
+    BOOST_CHECK_EQUAL(site.argument_types[2], static_cast< unsigned char >(logging::deferred_argument::end_of_arguments));
+    BOOST_CHECK_EQUAL(msg.get().arguments_size(), 8u + 4u + 3u);
+}
+
+// The test checks that arguments of types that cannot be stored in the binary form are formatted by the caller
+BOOST_AUTO_TEST_CASE(user_defined_types)
+{
+    test_logger lg;
+    const point p = { 1, 2 };
+    BOOST_LOG_DEFERRED(lg, "point: %1%, long double: %2%", p, 0.5L);
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 1u);
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[0]), "point: (1, 2), long double: 0.5"));
+
+    // The message must be retained after the argument is destroyed
+    {
+        std::string str = "temporary";
+        BOOST_LOG_DEFERRED(lg, "%1%", str);
+        str = "changed";
+    }
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 2u);
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[1]), "temporary"));
+
+    std::ostringstream strm;
+    strm << logging::extract_or_throw< logging::deferred_message >("Message", lg.records[1]);
+    BOOST_CHECK_EQUAL(strm.str(), std::string("temporary"));
+}
+
+// The test checks that named arguments are passed to the logger
+BOOST_AUTO_TEST_CASE(severity_level)
+{
+    test_logger lg;
+    BOOST_LOG_DEFERRED_SEV(lg, 3, "with severity %1%", 3);
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 1u);
+    BOOST_CHECK_EQUAL(logging::extract_or_throw< int >("Severity", lg.records[0]), 3);
+    BOOST_CHECK(equal_strings(format_record< char >(lg.records[0]), "with severity 3"));
+}
+
+#ifdef BOOST_LOG_USE_WCHAR_T
+
+// The test checks that the deferred message can be formatted into a wide stream
+BOOST_AUTO_TEST_CASE(wide_formatting)
+{
+    test_logger lg;
+    BOOST_LOG_DEFERRED(lg, "%1%: %2%", "abc", 42);
+    BOOST_REQUIRE_EQUAL(lg.records.size(), 1u);
+    BOOST_CHECK(equal_strings(format_record< wchar_t >(lg.records[0]), L"abc: 42"));
+}
+
+#endif // BOOST_LOG_USE_WCHAR_T
+
+#else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
+
+BOOST_AUTO_TEST_CASE(deferred_logging_not_supported)
+{
+}
+
+#endif // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_CXX11_VARIADIC_MACROS)
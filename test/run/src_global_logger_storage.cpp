@@ -0,0 +1,123 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   src_global_logger_storage.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the global logger storage.
+ */
+
+#define BOOST_TEST_MODULE src_global_logger_storage
+
+#include <boost/test/unit_test.hpp>
+#include <boost/log/sources/logger.hpp>
+#include <boost/log/sources/global_logger_storage.hpp>
+
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/thread/thread.hpp>
+#endif
+
+namespace logging = boost::log;
+namespace src = logging::sources;
+
+BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(my_logger, src::logger)
+
+namespace {
+
+//! Number of loggers to register
+const unsigned int logger_count = 100u;
+
+template< unsigned int N >
+struct numbered_tag
+{
+    typedef src::logger logger_type;
+    enum registration_line_t { registration_line = __LINE__ };
+    static const char* registration_file() { return __FILE__; }
+    static logger_type construct_logger() { return logger_type(); }
+};
+
+typedef src::logger* (*get_logger_t)();
+
+template< unsigned int N >
+src::logger* get_numbered_logger()
+{
+    return &src::aux::logger_singleton< numbered_tag< N > >::get();
+}
+
+template< unsigned int N >
+struct fill_getters
+{
+    static void fill(get_logger_t* getters)
+    {
+        getters[N - 1u] = &get_numbered_logger< N - 1u >;
+        fill_getters< N - 1u >::fill(getters);
+    }
+};
+
+template< >
+struct fill_getters< 0u >
+{
+    static void fill(get_logger_t*)
+    {
+    }
+};
+
+struct resolve_loggers
+{
+    get_logger_t const* m_Getters;
+    src::logger** m_Loggers;
+
+    resolve_loggers(get_logger_t const* getters, src::logger** loggers) : m_Getters(getters), m_Loggers(loggers)
+    {
+    }
+
+    void operator() () const
+    {
+        for (unsigned int i = 0u; i < logger_count; ++i)
+            m_Loggers[i] = m_Getters[i]();
+    }
+};
+
+} // namespace
+
+// The test checks that a global logger is a singleton
+BOOST_AUTO_TEST_CASE(global_logger)
+{
+    src::logger& lg1 = my_logger::get();
+    src::logger& lg2 = my_logger::get();
+    BOOST_CHECK_EQUAL(&lg1, &lg2);
+}
+
+// The test checks that multiple global loggers can be registered concurrently
+BOOST_AUTO_TEST_CASE(many_loggers)
+{
+    get_logger_t getters[logger_count];
+    fill_getters< logger_count >::fill(getters);
+
+    src::logger* loggers1[logger_count] = {};
+#if !defined(BOOST_LOG_NO_THREADS)
+    src::logger* loggers2[logger_count] = {};
+    boost::thread t1(resolve_loggers(getters, loggers1));
+    boost::thread t2(resolve_loggers(getters, loggers2));
+    t1.join();
+    t2.join();
+#else
+    resolve_loggers(getters, loggers1)();
+#endif
+
+    for (unsigned int i = 0u; i < logger_count; ++i)
+    {
+        BOOST_CHECK(loggers1[i] != static_cast< src::logger* >(NULL));
+        BOOST_CHECK_EQUAL(loggers1[i], getters[i]());
+#if !defined(BOOST_LOG_NO_THREADS)
+        BOOST_CHECK_EQUAL(loggers1[i], loggers2[i]);
+#endif
+        for (unsigned int j = 0u; j < i; ++j)
+            BOOST_CHECK_NE(loggers1[i], loggers1[j]);
+    }
+}
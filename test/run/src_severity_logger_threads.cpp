@@ -0,0 +1,119 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   src_severity_logger_threads.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  This header contains tests for the severity level storage of the severity logger in multiple threads.
+ */
+
+#define BOOST_TEST_MODULE src_severity_logger_threads
+
+#include <boost/test/unit_test.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/log/core/core.hpp>
+#include <boost/log/core/record.hpp>
+#include <boost/log/keywords/severity.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
+#include <boost/log/sources/severity_logger.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+
+#if !defined(BOOST_LOG_NO_THREADS)
+#include <boost/thread/thread.hpp>
+#endif
+
+namespace logging = boost::log;
+namespace src = logging::sources;
+namespace sinks = logging::sinks;
+namespace keywords = logging::keywords;
+
+namespace {
+
+struct logging_fixture
+{
+    typedef sinks::synchronous_sink< sinks::text_ostream_backend > sink_type;
+
+    boost::shared_ptr< sink_type > m_sink;
+
+    logging_fixture() : m_sink(boost::make_shared< sink_type >())
+    {
+        logging::core::get()->add_sink(m_sink);
+    }
+
+    ~logging_fixture()
+    {
+        logging::core::get()->remove_sink(m_sink);
+    }
+};
+
+int get_severity(logging::record const& rec)
+{
+    return logging::extract_or_default< int >("Severity", rec.attribute_values(), -1);
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+struct thread_body
+{
+    int m_level;
+    int& m_result;
+
+    thread_body(int level, int& result) : m_level(level), m_result(result)
+    {
+    }
+
+    void operator() () const
+    {
+        src::severity_logger< int > lg;
+        logging::record rec = lg.open_record(keywords::severity = m_level);
+        if (rec)
+            m_result = get_severity(rec);
+    }
+};
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
+
+} // namespace
+
+// The test checks that the severity level is attached to log records
+BOOST_FIXTURE_TEST_CASE(severity_level, logging_fixture)
+{
+    src::severity_logger< int > lg(keywords::severity = 2);
+
+    logging::record rec = lg.open_record(keywords::severity = 5);
+    BOOST_REQUIRE(!!rec);
+    BOOST_CHECK_EQUAL(get_severity(rec), 5);
+
+    rec = lg.open_record();
+    BOOST_REQUIRE(!!rec);
+    BOOST_CHECK_EQUAL(get_severity(rec), 2);
+}
+
+#if !defined(BOOST_LOG_NO_THREADS)
+
+// The test checks that the severity level set in one thread does not affect other threads
+BOOST_FIXTURE_TEST_CASE(severity_level_per_thread, logging_fixture)
+{
+    src::severity_logger< int > lg;
+    logging::record rec = lg.open_record(keywords::severity = 3);
+    BOOST_REQUIRE(!!rec);
+
+    int result1 = -1, result2 = -1;
+    boost::thread t1(thread_body(7, result1));
+    boost::thread t2(thread_body(9, result2));
+    t1.join();
+    t2.join();
+
+    BOOST_CHECK_EQUAL(result1, 7);
+    BOOST_CHECK_EQUAL(result2, 9);
+    BOOST_CHECK_EQUAL(get_severity(rec), 3);
+}
+
+#endif // !defined(BOOST_LOG_NO_THREADS)
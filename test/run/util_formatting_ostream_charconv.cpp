@@ -0,0 +1,221 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   util_formatting_ostream_charconv.cpp
+ * \author Andrey Semashev
+ * \date   16.10.2026
+ *
+ * \brief  This header contains tests for the formatting output stream wrapper with the fast numeric formatting enabled.
+ */
+
+#define BOOST_TEST_MODULE util_formatting_ostream_charconv
+
+// Enable formatting numbers with std::to_chars, when available
+#define BOOST_LOG_USE_STD_CHARCONV
+
+#include <locale>
+#include <limits>
+#include <string>
+#include <iomanip>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <boost/log/utility/formatting_ostream.hpp>
+#include "char_definitions.hpp"
+
+namespace logging = boost::log;
+
+namespace {
+
+//! Numeric punctuation facet with digit grouping
+template< typename CharT >
+struct grouping_numpunct :
+    public std::numpunct< CharT >
+{
+    std::string do_grouping() const { return "\3"; }
+    CharT do_thousands_sep() const { return static_cast< CharT >('\''); }
+};
+
+//! The function checks that the value is formatted the same way as the standard stream does
+template< typename CharT, typename T, typename ManipT >
+void check_output(T const& value, ManipT const& manip)
+{
+    typedef CharT char_type;
+    typedef std::basic_string< char_type > string_type;
+    typedef std::basic_ostringstream< char_type > ostream_type;
+    typedef logging::basic_formatting_ostream< char_type > formatting_ostream_type;
+
+    string_type str_fmt;
+    formatting_ostream_type strm_fmt(str_fmt);
+    manip(strm_fmt.stream());
+    strm_fmt << value << static_cast< char_type >('|') << value;
+    strm_fmt.flush();
+
+    ostream_type strm_correct;
+    strm_correct.flags(strm_fmt.flags());
+    strm_correct.precision(6);
+    manip(strm_correct);
+    strm_correct << value << static_cast< char_type >('|') << value;
+
+    BOOST_CHECK(str_fmt == strm_correct.str());
+}
+
+struct no_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT&) const {}
+};
+
+struct width_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::setw(12) << std::setfill(static_cast< typename StreamT::char_type >('0'));
+    }
+};
+
+struct left_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::left << std::setw(12);
+    }
+};
+
+struct hex_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::hex << std::showbase;
+    }
+};
+
+struct showpos_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::showpos;
+    }
+};
+
+struct precision_manip
+{
+    int m_precision;
+
+    explicit precision_manip(int precision) : m_precision(precision) {}
+
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::setprecision(m_precision);
+    }
+};
+
+struct fixed_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::fixed;
+    }
+};
+
+struct noboolalpha_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm << std::noboolalpha;
+    }
+};
+
+struct grouping_manip
+{
+    template< typename StreamT >
+    void operator() (StreamT& strm) const
+    {
+        strm.imbue(std::locale(std::locale::classic(), new grouping_numpunct< typename StreamT::char_type >()));
+    }
+};
+
+template< typename CharT, typename T >
+void check_integer(T value)
+{
+    check_output< CharT >(value, no_manip());
+    check_output< CharT >(value, width_manip());
+    check_output< CharT >(value, left_manip());
+    check_output< CharT >(value, hex_manip());
+    check_output< CharT >(value, showpos_manip());
+    check_output< CharT >(value, grouping_manip());
+}
+
+template< typename CharT, typename T >
+void check_floating_point(T value)
+{
+    check_output< CharT >(value, no_manip());
+    check_output< CharT >(value, width_manip());
+    check_output< CharT >(value, precision_manip(0));
+    check_output< CharT >(value, precision_manip(3));
+    check_output< CharT >(value, precision_manip(17));
+    check_output< CharT >(value, fixed_manip());
+    check_output< CharT >(value, showpos_manip());
+    check_output< CharT >(value, grouping_manip());
+}
+
+} // namespace
+
+// Integers are formatted the same way as by std::num_put
+BOOST_AUTO_TEST_CASE_TEMPLATE(integers, CharT, char_types)
+{
+    check_integer< CharT >(static_cast< short >(-12345));
+    check_integer< CharT >(static_cast< unsigned short >(65535u));
+    check_integer< CharT >(0);
+    check_integer< CharT >(1234567);
+    check_integer< CharT >((std::numeric_limits< int >::min)());
+    check_integer< CharT >(4000000000u);
+    check_integer< CharT >(-1234567890L);
+    check_integer< CharT >((std::numeric_limits< unsigned long >::max)());
+    check_integer< CharT >((std::numeric_limits< long long >::min)());
+    check_integer< CharT >((std::numeric_limits< unsigned long long >::max)());
+}
+
+// Floating point numbers are formatted the same way as by std::num_put
+BOOST_AUTO_TEST_CASE_TEMPLATE(floating_point, CharT, char_types)
+{
+    check_floating_point< CharT >(0.0);
+    check_floating_point< CharT >(-0.0);
+    check_floating_point< CharT >(0.1);
+    check_floating_point< CharT >(-2.5f);
+    check_floating_point< CharT >(123456.0);
+    check_floating_point< CharT >(1234567.0);
+    check_floating_point< CharT >(1.0e-5);
+    check_floating_point< CharT >(3.14159265358979);
+    check_floating_point< CharT >(-1.0e300);
+    check_floating_point< CharT >(2.5L);
+    check_floating_point< CharT >((std::numeric_limits< double >::min)());
+    check_floating_point< CharT >((std::numeric_limits< double >::infinity)());
+    check_floating_point< CharT >(-(std::numeric_limits< double >::infinity)());
+    check_floating_point< CharT >((std::numeric_limits< double >::quiet_NaN)());
+}
+
+// Booleans and pointers are formatted the same way as by std::num_put
+BOOST_AUTO_TEST_CASE_TEMPLATE(bools_and_pointers, CharT, char_types)
+{
+    check_output< CharT >(true, no_manip());
+    check_output< CharT >(false, width_manip());
+    check_output< CharT >(true, noboolalpha_manip());
+    check_output< CharT >(false, noboolalpha_manip());
+
+    int n = 0;
+    check_output< CharT >(static_cast< const void* >(&n), no_manip());
+    check_output< CharT >(static_cast< const void* >(&n), width_manip());
+    check_output< CharT >(static_cast< const void* >(&n), left_manip());
+    check_output< CharT >(static_cast< const void* >(0), no_manip());
+}
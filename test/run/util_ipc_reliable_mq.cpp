@@ -29,6 +29,8 @@
 #include <boost/winapi/get_current_process_id.hpp>
 #else
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 #endif
 #include <cstddef>
 #include <cstring>
@@ -325,6 +327,298 @@ BOOST_AUTO_TEST_CASE(message_passing)
     }
 }
 
+BOOST_AUTO_TEST_CASE(lock_free_message_passing)
+{
+    const queue_t::queue_mode modes[] = { queue_t::single_producer_mode, queue_t::multi_producer_mode };
+    for (unsigned int m = 0u; m < sizeof(modes) / sizeof(*modes); ++m)
+    {
+        const queue_t::queue_mode mode = modes[m];
+        BOOST_TEST_CHECKPOINT("mode = " << mode);
+#if defined(BOOST_WINDOWS)
+        // Lock-free modes are not supported on Windows
+        const queue_t::queue_mode expected_mode = queue_t::locking_mode;
+#else
+        const queue_t::queue_mode expected_mode = mode;
+#endif
+
+        // try_send() and try_receive()
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 1u, block_size, queue_t::block_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+            BOOST_CHECK_EQUAL(queue_a.mode(), expected_mode);
+            BOOST_CHECK_EQUAL(queue_b.mode(), expected_mode);
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(!queue_a.try_send(message2, sizeof(message2) - 1u));
+            char buffer[block_size] = {};
+            size_type message_size = 0u;
+            BOOST_CHECK(queue_b.try_receive(buffer, sizeof(buffer), message_size));
+            BOOST_CHECK_EQUAL(message_size, sizeof(message1) - 1u);
+            BOOST_CHECK(std::memcmp(buffer, message1, message_size) == 0);
+            BOOST_CHECK(!queue_b.try_receive(buffer, sizeof(buffer), message_size));
+
+            BOOST_CHECK(queue_a.send(message2, sizeof(message2) - 1u) == queue_t::succeeded);
+            std::string msg;
+            BOOST_CHECK(queue_b.receive(msg) == queue_t::succeeded);
+            BOOST_CHECK_EQUAL(msg, message2);
+        }
+
+        // send() with an error code and an exception on overflow
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 1u, block_size, queue_t::fail_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name, queue_t::throw_on_overflow);
+            BOOST_CHECK(queue_a.send(message1, sizeof(message1) - 1u) == queue_t::succeeded);
+            BOOST_CHECK_EQUAL(queue_a.send(message1, sizeof(message1) - 1u), queue_t::no_space);
+            BOOST_CHECK_THROW(queue_b.send(message1, sizeof(message1) - 1u), boost::log::capacity_limit_reached);
+        }
+
+        // send() and receive() for messages larger than block_size, with wrapping around the end of the queue storage
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 5u, block_size, queue_t::block_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+
+            const size_type message_size = block_size * 3u / 2u;
+            std::vector< unsigned char > send_data;
+            send_data.resize(message_size);
+            for (unsigned int i = 0; i < message_size; ++i)
+                send_data[i] = static_cast< unsigned char >(i & 0xFF);
+
+            BOOST_CHECK(queue_a.send(&send_data[0], static_cast< size_type >(send_data.size())) == queue_t::succeeded);
+
+            for (unsigned int i = 0; i < 5; ++i)
+            {
+                BOOST_CHECK(queue_a.send(&send_data[0], static_cast< size_type >(send_data.size())) == queue_t::succeeded);
+
+                std::vector< unsigned char > receive_data;
+                BOOST_CHECK(queue_b.receive(receive_data) == queue_t::succeeded);
+                BOOST_CHECK_EQUAL_COLLECTIONS(send_data.begin(), send_data.end(), receive_data.begin(), receive_data.end());
+            }
+
+            std::vector< unsigned char > receive_data;
+            BOOST_CHECK(queue_b.receive(receive_data) == queue_t::succeeded);
+            BOOST_CHECK_EQUAL_COLLECTIONS(send_data.begin(), send_data.end(), receive_data.begin(), receive_data.end());
+        }
+
+        // clear() by the reader
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 1u, block_size, queue_t::block_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(!queue_a.try_send(message2, sizeof(message2) - 1u));
+
+            queue_b.clear();
+
+            BOOST_CHECK(queue_a.try_send(message2, sizeof(message2) - 1u));
+            std::string msg;
+            BOOST_CHECK(queue_b.try_receive(msg));
+            BOOST_CHECK_EQUAL(msg, message2);
+        }
+    }
+}
+
+namespace {
+
+//! Stores the messages received by receive_batch() and try_receive_batch()
+struct batch_collector
+{
+    std::vector< std::string >& m_messages;
+
+    explicit batch_collector(std::vector< std::string >& messages) : m_messages(messages) {}
+
+    void operator() (const void* data, size_type size) const
+    {
+        m_messages.push_back(std::string(static_cast< const char* >(data), size));
+    }
+};
+
+std::string make_large_message(char c)
+{
+    // The message occupies two blocks
+    std::string msg(block_size * 3u / 2u, c);
+    for (std::string::size_type i = 0u; i < msg.size(); i += 7u)
+        msg[i] = static_cast< char >('a' + (i % 26u));
+    return msg;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(reserve_commit_and_batch_receive)
+{
+    const queue_t::queue_mode modes[] = { queue_t::locking_mode, queue_t::single_producer_mode, queue_t::multi_producer_mode };
+    for (unsigned int m = 0u; m < sizeof(modes) / sizeof(*modes); ++m)
+    {
+        const queue_t::queue_mode mode = modes[m];
+        BOOST_TEST_CHECKPOINT("mode = " << mode);
+
+        // try_reserve() and commit(), with skipping the free blocks at the end of the queue storage
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 4u, block_size, queue_t::fail_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+
+            queue_t::reservation res;
+            BOOST_CHECK(res.data() == NULL);
+            BOOST_REQUIRE(queue_a.try_reserve(sizeof(message1) - 1u, res));
+            BOOST_REQUIRE(res.data() != NULL);
+            BOOST_CHECK_EQUAL(res.size(), sizeof(message1) - 1u);
+            std::memcpy(res.data(), message1, res.size());
+            std::string msg;
+            // In locking mode the queue remains locked until the reservation is committed
+            if (queue_a.mode() != queue_t::locking_mode)
+                BOOST_CHECK(!queue_b.try_receive(msg));
+            queue_a.commit(res);
+            BOOST_CHECK(res.data() == NULL);
+            BOOST_CHECK(queue_b.try_receive(msg));
+            BOOST_CHECK_EQUAL(msg, message1);
+
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(queue_a.try_send(message2, sizeof(message2) - 1u));
+            BOOST_CHECK(queue_b.try_receive(msg));
+            BOOST_CHECK(queue_b.try_receive(msg));
+            msg.clear();
+
+            // The next message starts at the last block and has to be placed at the beginning of the queue storage
+            const std::string large_message = make_large_message('x');
+            BOOST_REQUIRE(queue_a.try_reserve(static_cast< size_type >(large_message.size()), res));
+            std::memcpy(res.data(), large_message.data(), large_message.size());
+            queue_a.commit(res);
+
+            // The skipped block is still in use until the message is received
+            BOOST_CHECK(!queue_a.try_reserve(static_cast< size_type >(large_message.size()), res));
+            BOOST_CHECK(res.data() == NULL);
+
+            BOOST_CHECK(queue_b.try_receive(msg));
+            BOOST_CHECK(msg == large_message);
+            msg.clear();
+
+            // Fill the queue and check that the reservation fails
+            for (unsigned int i = 0u; i < 4u; ++i)
+                BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(!queue_a.try_reserve(sizeof(message1) - 1u, res));
+            BOOST_CHECK(queue_b.try_receive(msg));
+            BOOST_CHECK_EQUAL(msg, message1);
+            BOOST_CHECK(queue_a.try_reserve(sizeof(message2) - 1u, res));
+            std::memcpy(res.data(), message2, res.size());
+            queue_a.commit(res);
+
+            const size_type max_message_size = 4u * block_size;
+            BOOST_CHECK_THROW(queue_a.try_reserve(max_message_size, res), std::logic_error);
+        }
+
+        // receive_batch() and try_receive_batch()
+        {
+            queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 4u, block_size, queue_t::fail_on_overflow, boost::log::permissions(), mode);
+            queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+
+            std::vector< std::string > messages;
+            BOOST_CHECK(!queue_b.try_receive_batch(batch_collector(messages), 10u));
+            BOOST_CHECK(messages.empty());
+
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(queue_a.try_send(message2, sizeof(message2) - 1u));
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+
+            BOOST_CHECK(queue_b.receive_batch(batch_collector(messages), 2u) == queue_t::succeeded);
+            BOOST_REQUIRE_EQUAL(messages.size(), 2u);
+            BOOST_CHECK_EQUAL(messages[0], message1);
+            BOOST_CHECK_EQUAL(messages[1], message2);
+
+            // The message sent with send() wraps around the end of the queue storage
+            const std::string large_message1 = make_large_message('y');
+            const std::string large_message2 = make_large_message('z');
+            BOOST_CHECK(queue_a.try_send(large_message1.data(), static_cast< size_type >(large_message1.size())));
+            BOOST_CHECK(!queue_a.try_send(large_message2.data(), static_cast< size_type >(large_message2.size())));
+
+            messages.clear();
+            BOOST_CHECK(queue_b.try_receive_batch(batch_collector(messages), 10u));
+            BOOST_REQUIRE_EQUAL(messages.size(), 2u);
+            BOOST_CHECK_EQUAL(messages[0], message1);
+            BOOST_CHECK(messages[1] == large_message1);
+
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+            BOOST_CHECK(queue_a.try_send(message2, sizeof(message2) - 1u));
+
+            messages.clear();
+            BOOST_CHECK(queue_b.try_receive_batch(batch_collector(messages), 1u));
+            BOOST_REQUIRE_EQUAL(messages.size(), 1u);
+            BOOST_CHECK_EQUAL(messages[0], message1);
+
+            // The message placed by try_reserve() after skipping the free block at the end of the queue storage
+            queue_t::reservation res;
+            BOOST_REQUIRE(queue_a.try_reserve(static_cast< size_type >(large_message2.size()), res));
+            std::memcpy(res.data(), large_message2.data(), large_message2.size());
+            queue_a.commit(res);
+
+            messages.clear();
+            BOOST_CHECK(queue_b.try_receive_batch(batch_collector(messages), 10u));
+            BOOST_REQUIRE_EQUAL(messages.size(), 2u);
+            BOOST_CHECK_EQUAL(messages[0], message2);
+            BOOST_CHECK(messages[1] == large_message2);
+
+            messages.clear();
+            BOOST_CHECK(!queue_b.try_receive_batch(batch_collector(messages), 10u));
+            BOOST_CHECK(messages.empty());
+
+            queue_b.stop_local();
+            BOOST_CHECK_EQUAL(queue_b.receive_batch(batch_collector(messages), 10u), queue_t::aborted);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(reserve_cancel)
+{
+    const queue_t::queue_mode modes[] = { queue_t::locking_mode, queue_t::single_producer_mode, queue_t::multi_producer_mode };
+    for (unsigned int m = 0u; m < sizeof(modes) / sizeof(*modes); ++m)
+    {
+        const queue_t::queue_mode mode = modes[m];
+        BOOST_TEST_CHECKPOINT("mode = " << mode);
+
+        queue_t queue_a(boost::log::open_mode::create_only, ipc_queue_name, 4u, block_size, queue_t::fail_on_overflow, boost::log::permissions(), mode);
+        queue_t queue_b(boost::log::open_mode::open_only, ipc_queue_name);
+
+        // The cancelled reservation is not received
+        queue_t::reservation res;
+        BOOST_REQUIRE(queue_a.try_reserve(sizeof(message1) - 1u, res));
+        queue_a.cancel(res);
+        BOOST_CHECK(res.data() == NULL);
+        std::string msg;
+        BOOST_CHECK(!queue_b.try_receive(msg));
+
+        BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+        BOOST_REQUIRE(queue_a.try_reserve(sizeof(message2) - 1u, res));
+        queue_a.cancel(res);
+        BOOST_CHECK(queue_a.try_send(message2, sizeof(message2) - 1u));
+
+        std::vector< std::string > messages;
+        BOOST_CHECK(queue_b.try_receive_batch(batch_collector(messages), 10u));
+        BOOST_REQUIRE_EQUAL(messages.size(), 2u);
+        BOOST_CHECK_EQUAL(messages[0], message1);
+        BOOST_CHECK_EQUAL(messages[1], message2);
+
+        // The released space can be reused
+        for (unsigned int i = 0u; i < 4u; ++i)
+            BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+        for (unsigned int i = 0u; i < 4u; ++i)
+            BOOST_CHECK(queue_b.try_receive(msg));
+        BOOST_CHECK(!queue_b.try_receive(msg));
+
+        // The message occupies the whole queue storage and does not fit after the free blocks at the end of the storage
+        BOOST_CHECK(queue_a.try_send(message1, sizeof(message1) - 1u));
+        BOOST_CHECK(queue_b.try_receive(msg));
+        const std::string huge_message(3u * block_size, 'h');
+        if (!queue_a.try_reserve(static_cast< size_type >(huge_message.size()), res))
+        {
+            // In the lock-free modes, the reader has to release the skipped blocks first
+            BOOST_CHECK_NE(queue_a.mode(), queue_t::locking_mode);
+            BOOST_CHECK(!queue_b.try_receive(msg));
+            BOOST_REQUIRE(queue_a.try_reserve(static_cast< size_type >(huge_message.size()), res));
+        }
+        std::memcpy(res.data(), huge_message.data(), huge_message.size());
+        queue_a.commit(res);
+        msg.clear();
+        BOOST_CHECK(queue_b.try_receive(msg));
+        BOOST_CHECK(msg == huge_message);
+    }
+}
+
 #if !defined(BOOST_LOG_NO_THREADS)
 
 namespace {
@@ -404,6 +698,81 @@ BOOST_AUTO_TEST_CASE(multithreaded_message_passing)
 
 namespace {
 
+void lock_free_message_passing_feeding_thread(queue_t::queue_mode mode, unsigned int id, unsigned int& failure_count)
+{
+    queue_t queue(boost::log::open_mode::open_or_create, ipc_queue_name, 8u, block_size, queue_t::block_on_overflow, boost::log::permissions(), mode);
+    for (unsigned int i = 0; i < message_count; ++i)
+    {
+        const unsigned int message[2] = { id, i };
+        failure_count += queue.send(message, sizeof(message)) != queue_t::succeeded;
+    }
+
+    boost::atomic_thread_fence(boost::memory_order_release);
+}
+
+void multithreaded_lock_free_message_passing_test(queue_t::queue_mode mode, unsigned int thread_count)
+{
+    // The queue is small so that the writers and the reader often have to block
+    queue_t queue(boost::log::open_mode::create_only, ipc_queue_name, 8u, block_size, queue_t::block_on_overflow, boost::log::permissions(), mode);
+
+    std::vector< unsigned int > failure_counts(thread_count, 0u);
+    boost::atomic_thread_fence(boost::memory_order_release);
+
+    std::vector< std::thread > threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        unsigned int& failure_count = failure_counts[i];
+        threads.emplace_back([mode, i, &failure_count]() { lock_free_message_passing_feeding_thread(mode, i, failure_count); });
+    }
+
+    BOOST_TEST_PASSPOINT();
+
+    unsigned int receive_failures = 0, receive_corruptions = 0;
+    std::vector< unsigned int > next_message_numbers(thread_count, 0u);
+    for (unsigned int i = 0; i < message_count * thread_count; ++i)
+    {
+        unsigned int message[2] = {};
+        size_type message_size = 0u;
+        if (queue.receive(message, sizeof(message), message_size) == queue_t::succeeded)
+        {
+            // Messages from every writer must be received in the order of sending
+            if (message_size != sizeof(message) || message[0] >= thread_count || message[1] != next_message_numbers[message[0]])
+                ++receive_corruptions;
+            else
+                ++next_message_numbers[message[0]];
+        }
+        else
+            ++receive_failures;
+    }
+
+    BOOST_TEST_PASSPOINT();
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        threads[i].join();
+
+    boost::atomic_thread_fence(boost::memory_order_acquire);
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        BOOST_CHECK_EQUAL(failure_counts[i], 0u);
+        BOOST_CHECK_EQUAL(next_message_numbers[i], message_count);
+    }
+    BOOST_CHECK_EQUAL(receive_failures, 0u);
+    BOOST_CHECK_EQUAL(receive_corruptions, 0u);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(multithreaded_lock_free_message_passing)
+{
+    BOOST_TEST_CHECKPOINT("single_producer_mode");
+    multithreaded_lock_free_message_passing_test(queue_t::single_producer_mode, 1u);
+    BOOST_TEST_CHECKPOINT("multi_producer_mode");
+    multithreaded_lock_free_message_passing_test(queue_t::multi_producer_mode, 3u);
+}
+
+namespace {
+
 void stop_reset_feeding_thread(queue_t& queue, queue_t::operation_result* results, unsigned int count)
 {
     for (unsigned int i = 0; i < count; ++i)
@@ -502,6 +871,208 @@ BOOST_AUTO_TEST_CASE(stop_reset_local)
     BOOST_CHECK_EQUAL(reader_results[1], queue_t::aborted);
 }
 
+// The test checks that a writer interrupted with stop_local() while waiting for the preceding writers does not block other writers
+BOOST_AUTO_TEST_CASE(stop_local_interrupted_publisher)
+{
+    queue_t queue(boost::log::open_mode::create_only, ipc_queue_name, 8u, block_size, queue_t::block_on_overflow, boost::log::permissions(), queue_t::multi_producer_mode);
+    if (queue.mode() != queue_t::multi_producer_mode)
+        return;
+
+    queue_t preceding_queue(boost::log::open_mode::open_only, ipc_queue_name);
+    queue_t interrupted_queue(boost::log::open_mode::open_only, ipc_queue_name);
+    queue_t following_queue(boost::log::open_mode::open_only, ipc_queue_name);
+
+    // The preceding writer reserves space and delays publishing its message
+    queue_t::reservation res;
+    BOOST_REQUIRE(preceding_queue.try_reserve(sizeof(message1) - 1u, res));
+    std::memcpy(res.data(), message1, res.size());
+
+    queue_t::operation_result interrupted_result = queue_t::succeeded, following_result = queue_t::aborted;
+    boost::atomic_thread_fence(boost::memory_order_release);
+
+    std::thread interrupted_thread([&interrupted_queue, &interrupted_result]() { interrupted_result = interrupted_queue.send(message2, sizeof(message2) - 1u); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    BOOST_TEST_PASSPOINT();
+
+    // The writer that reserved space after the interrupted writer waits for both preceding writers
+    std::thread following_thread([&following_queue, &following_result]() { following_result = following_queue.send(message1, sizeof(message1) - 1u); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    BOOST_TEST_PASSPOINT();
+
+    interrupted_queue.stop_local();
+    interrupted_thread.join();
+    BOOST_TEST_PASSPOINT();
+
+    BOOST_CHECK_EQUAL(preceding_queue.commit(res), queue_t::succeeded);
+    following_thread.join();
+
+    boost::atomic_thread_fence(boost::memory_order_acquire);
+
+    BOOST_CHECK_EQUAL(interrupted_result, queue_t::aborted);
+    BOOST_CHECK_EQUAL(following_result, queue_t::succeeded);
+
+    // Other writers keep sending messages, and the space of the interrupted writer is released
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+        BOOST_CHECK_EQUAL(preceding_queue.send(message2, sizeof(message2) - 1u), queue_t::succeeded);
+
+        std::string msg;
+        BOOST_CHECK(queue.try_receive(msg));
+        if (i == 0u)
+        {
+            BOOST_CHECK_EQUAL(msg, message1);
+            msg.clear();
+            BOOST_CHECK(queue.try_receive(msg));
+            BOOST_CHECK_EQUAL(msg, message1);
+            msg.clear();
+            BOOST_CHECK(queue.try_receive(msg));
+        }
+        BOOST_CHECK_EQUAL(msg, message2);
+    }
+
+    std::string msg;
+    BOOST_CHECK(!queue.try_receive(msg));
+
+    // The interrupted queue instance can be used after reset_local()
+    interrupted_queue.reset_local();
+    BOOST_CHECK_EQUAL(interrupted_queue.send(message2, sizeof(message2) - 1u), queue_t::succeeded);
+    BOOST_CHECK(queue.try_receive(msg));
+    BOOST_CHECK_EQUAL(msg, message2);
+}
+
+#if !defined(BOOST_WINDOWS)
+
+namespace {
+
+const unsigned int process_message_count = 10000;
+
+//! Sends messages to the queue from a child process and terminates the child process
+void multiprocess_feeding_process(unsigned int id)
+{
+    int status = 0;
+    try
+    {
+        queue_t queue(boost::log::open_mode::open_only, ipc_queue_name);
+        for (unsigned int i = 0; i < process_message_count; ++i)
+        {
+            const unsigned int message[2] = { id, i };
+            status |= queue.send(message, sizeof(message)) != queue_t::succeeded;
+        }
+    }
+    catch (...)
+    {
+        status = 1;
+    }
+    _exit(status);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(multiprocess_lock_free_message_passing)
+{
+    const unsigned int process_count = 3u;
+    queue_t queue(boost::log::open_mode::create_only, ipc_queue_name, 8u, block_size, queue_t::block_on_overflow, boost::log::permissions(), queue_t::multi_producer_mode);
+    if (queue.mode() != queue_t::multi_producer_mode)
+        return;
+
+    pid_t pids[process_count] = {};
+    for (unsigned int i = 0u; i < process_count; ++i)
+    {
+        pids[i] = fork();
+        BOOST_REQUIRE(pids[i] >= 0);
+        if (pids[i] == 0)
+            multiprocess_feeding_process(i);
+    }
+
+    BOOST_TEST_PASSPOINT();
+
+    unsigned int receive_failures = 0, receive_corruptions = 0;
+    unsigned int next_message_numbers[process_count] = {};
+    for (unsigned int i = 0; i < process_message_count * process_count; ++i)
+    {
+        unsigned int message[2] = {};
+        size_type message_size = 0u;
+        if (queue.receive(message, sizeof(message), message_size) == queue_t::succeeded)
+        {
+            // Messages from every writer must be received in the order of sending
+            if (message_size != sizeof(message) || message[0] >= process_count || message[1] != next_message_numbers[message[0]])
+                ++receive_corruptions;
+            else
+                ++next_message_numbers[message[0]];
+        }
+        else
+            ++receive_failures;
+    }
+
+    BOOST_TEST_PASSPOINT();
+
+    for (unsigned int i = 0u; i < process_count; ++i)
+    {
+        int status = 0;
+        BOOST_REQUIRE_EQUAL(waitpid(pids[i], &status, 0), pids[i]);
+        BOOST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        BOOST_CHECK_EQUAL(next_message_numbers[i], process_message_count);
+    }
+    BOOST_CHECK_EQUAL(receive_failures, 0u);
+    BOOST_CHECK_EQUAL(receive_corruptions, 0u);
+}
+
+// The test checks that the writers blocked by a terminated writer process can be released with stop_local()
+BOOST_AUTO_TEST_CASE(multiprocess_terminated_writer)
+{
+    queue_t queue(boost::log::open_mode::create_only, ipc_queue_name, 8u, block_size, queue_t::block_on_overflow, boost::log::permissions(), queue_t::multi_producer_mode);
+    if (queue.mode() != queue_t::multi_producer_mode)
+        return;
+
+    pid_t pid = fork();
+    BOOST_REQUIRE(pid >= 0);
+    if (pid == 0)
+    {
+        // Child process: reserve space for a message and terminate without committing it
+        int status = 0;
+        try
+        {
+            queue_t child_queue(boost::log::open_mode::open_only, ipc_queue_name);
+            queue_t::reservation res;
+            status = !child_queue.try_reserve(sizeof(message1) - 1u, res);
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        _exit(status);
+    }
+
+    int status = 0;
+    BOOST_REQUIRE_EQUAL(waitpid(pid, &status, 0), pid);
+    BOOST_REQUIRE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    BOOST_TEST_PASSPOINT();
+
+    queue_t feeder_queue(boost::log::open_mode::open_only, ipc_queue_name);
+    queue_t::operation_result feeder_result = queue_t::succeeded;
+    boost::atomic_thread_fence(boost::memory_order_release);
+
+    // The writer waits for the terminated writer to publish its message
+    std::thread feeder_thread([&feeder_queue, &feeder_result]() { feeder_result = feeder_queue.send(message2, sizeof(message2) - 1u); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    BOOST_TEST_PASSPOINT();
+
+    feeder_queue.stop_local();
+    feeder_thread.join();
+
+    boost::atomic_thread_fence(boost::memory_order_acquire);
+
+    BOOST_CHECK_EQUAL(feeder_result, queue_t::aborted);
+
+    // Neither message is published
+    std::string msg;
+    BOOST_CHECK(!queue.try_receive(msg));
+}
+
+#endif // !defined(BOOST_WINDOWS)
+
 #endif // !defined(BOOST_LOG_NO_THREADS)
 
 #else // !defined(BOOST_LOG_WITHOUT_IPC)
@@ -21,6 +21,7 @@
 #if !defined(BOOST_LOG_WITHOUT_SETTINGS_PARSERS) && !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/log/trivial.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/attributes/constant.hpp>
 #include <boost/log/attributes/attribute_set.hpp>
@@ -566,6 +567,48 @@ BOOST_AUTO_TEST_CASE(contains_relation)
     }
 }
 
+// Tests for relation filters applied to values of different types
+BOOST_AUTO_TEST_CASE(value_type_change)
+{
+    attrs::constant< int > attr1(10);
+    attrs::constant< std::string > attr2("10");
+    attrs::constant< double > attr3(10.5);
+    attr_set set1, set2, set3;
+
+    set1["MyAttr"] = attr1;
+    attr_values values1(set1, set2, set3);
+    values1.freeze();
+
+    set1["MyAttr"] = attr2;
+    attr_values values2(set1, set2, set3);
+    values2.freeze();
+
+    set1["MyAttr"] = attr3;
+    attr_values values3(set1, set2, set3);
+    values3.freeze();
+
+    logging::filter f = logging::parse_filter("%MyAttr% >= 10");
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(f(values2));
+        BOOST_CHECK(f(values3));
+        BOOST_CHECK(f(values1));
+    }
+
+    // The copy of the filter must behave the same as the original
+    logging::filter f2 = f;
+    BOOST_CHECK(f2(values3));
+    BOOST_CHECK(f2(values2));
+    BOOST_CHECK(f2(values1));
+
+    logging::filter f3 = logging::parse_filter("%MyAttr% = 10");
+    BOOST_CHECK(f3(values1));
+    BOOST_CHECK(f3(values2));
+    BOOST_CHECK(!f3(values3));
+    BOOST_CHECK(f3(values1));
+}
+
 // Tests for regex matching relation filter
 BOOST_AUTO_TEST_CASE(matches_relation)
 {
@@ -602,6 +645,65 @@ BOOST_AUTO_TEST_CASE(matches_relation)
 
 namespace {
 
+bool matches_str(logging::filter const& f, std::string const& str)
+{
+    attr_set set1, set2, set3;
+    set1["MyStr"] = attrs::constant< std::string >(str);
+    attr_values values(set1, set2, set3);
+    values.freeze();
+    return f(values);
+}
+
+} // namespace
+
+// Tests for regex matching relation filter with the expressions that are matched without the regex engine
+BOOST_AUTO_TEST_CASE(matches_relation_literals)
+{
+    {
+        logging::filter f = logging::parse_filter("%MyStr% matches \"net.http\"");
+        BOOST_CHECK(matches_str(f, "net.http"));
+        BOOST_CHECK(matches_str(f, "net-http"));
+        BOOST_CHECK(!matches_str(f, "net.https"));
+    }
+    {
+        logging::filter f = logging::parse_filter("%MyStr% matches \"^net\\\\.http$\"");
+        BOOST_CHECK(matches_str(f, "net.http"));
+        BOOST_CHECK(!matches_str(f, "net-http"));
+        BOOST_CHECK(!matches_str(f, "net.http.server"));
+    }
+    {
+        logging::filter f = logging::parse_filter("%MyStr% matches \"net\\\\..*\"");
+        BOOST_CHECK(matches_str(f, "net.http"));
+        BOOST_CHECK(matches_str(f, "net."));
+        BOOST_CHECK(!matches_str(f, "net"));
+        BOOST_CHECK(!matches_str(f, "gui.net.http"));
+    }
+    {
+        logging::filter f = logging::parse_filter("%MyStr% matches \".*\\\\(server\\\\)\"");
+        BOOST_CHECK(matches_str(f, "http (server)"));
+        BOOST_CHECK(matches_str(f, "(server)"));
+        BOOST_CHECK(!matches_str(f, "http (server) "));
+    }
+    {
+        logging::filter f = logging::parse_filter("%MyStr% matches \".*http.*\"");
+        BOOST_CHECK(matches_str(f, "http"));
+        BOOST_CHECK(matches_str(f, "net.http.server"));
+        BOOST_CHECK(matches_str(f, "hthttp"));
+        BOOST_CHECK(!matches_str(f, "htt"));
+        BOOST_CHECK(!matches_str(f, "net.htt.server"));
+    }
+    {
+        // Not a literal pattern
+        logging::filter f = logging::parse_filter("%MyStr% matches \"net.*s\"");
+        BOOST_CHECK(matches_str(f, "net.https"));
+        BOOST_CHECK(!matches_str(f, "net.http"));
+        BOOST_CHECK(matches_str(f, "net.https"));
+        BOOST_CHECK(!matches_str(f, "net.http"));
+    }
+}
+
+namespace {
+
 class test_filter_factory :
     public logging::filter_factory< char >
 {
@@ -723,6 +825,88 @@ private:
 
 } // namespace
 
+// Tests for channel severity thresholds filter
+BOOST_AUTO_TEST_CASE(thresholds_relation)
+{
+    attrs::constant< std::string > channel1("net.http.client");
+    attrs::constant< std::string > channel2("net.dns");
+    attrs::constant< std::string > channel3("gui");
+    attrs::constant< logging::trivial::severity_level > severity(logging::trivial::info);
+    attr_set set1, set2, set3;
+    set1["Severity"] = severity;
+
+    set1["Channel"] = channel1;
+    attr_values values1(set1, set2, set3);
+    values1.freeze();
+
+    set1["Channel"] = channel2;
+    attr_values values2(set1, set2, set3);
+    values2.freeze();
+
+    set1["Channel"] = channel3;
+    attr_values values3(set1, set2, set3);
+    values3.freeze();
+
+    {
+        logging::filter f = logging::parse_filter("%Channel% thresholds \"net.http=debug, net=warning\"");
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+        BOOST_CHECK(!f(values3));
+    }
+    {
+        logging::filter f = logging::parse_filter("%Channel% thresholds \"net.http = debug, net = warning, * = info\"");
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+        BOOST_CHECK(f(values3));
+    }
+    {
+        // Integral thresholds are also compared with trivial::severity_level values
+        logging::filter f = logging::parse_filter("%Channel% thresholds \"net.http=1, net=3\"");
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+        BOOST_CHECK(!f(values3));
+    }
+    BOOST_CHECK_THROW(logging::parse_filter("%Channel% thresholds \"net\""), logging::parse_error);
+    BOOST_CHECK_THROW(logging::parse_filter("%Channel% thresholds \"net=loud\""), logging::parse_error);
+    BOOST_CHECK_THROW(logging::parse_filter("%Channel% thresholds \"%Level% net=1\""), logging::parse_error);
+    BOOST_CHECK_THROW(logging::parse_filter("%Channel% thresholds \"%Level net=1\""), logging::parse_error);
+}
+
+// Tests for channel severity thresholds filter with a custom severity attribute of an integral type
+BOOST_AUTO_TEST_CASE(thresholds_relation_integral_severity)
+{
+    attrs::constant< std::string > channel1("net.http.client");
+    attrs::constant< std::string > channel2("net.dns");
+    attrs::constant< int > severity(2);
+    attr_set set1, set2, set3;
+    set1["Level"] = severity;
+
+    set1["Channel"] = channel1;
+    attr_values values1(set1, set2, set3);
+    values1.freeze();
+
+    set1["Channel"] = channel2;
+    attr_values values2(set1, set2, set3);
+    values2.freeze();
+
+    {
+        logging::filter f = logging::parse_filter("%Channel% thresholds \"%Level%: net.http=1, net=3\"");
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+    }
+    {
+        // Severity level names are compared as integers
+        logging::filter f = logging::parse_filter("%Channel% thresholds \" %Level% : net.http=debug, *=warning\"");
+        BOOST_CHECK(f(values1));
+        BOOST_CHECK(!f(values2));
+    }
+    {
+        // The default severity attribute name is "Severity"
+        logging::filter f = logging::parse_filter("%Channel% thresholds \"*=0\"");
+        BOOST_CHECK(!f(values1));
+    }
+}
+
 // Tests for filter factory
 BOOST_AUTO_TEST_CASE(filter_factory)
 {
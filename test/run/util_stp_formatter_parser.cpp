@@ -21,6 +21,8 @@
 #if !defined(BOOST_LOG_WITHOUT_SETTINGS_PARSERS) && !defined(BOOST_LOG_WITHOUT_DEFAULT_FACTORIES)
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/log/trivial.hpp>
 #include <boost/log/exceptions.hpp>
 #include <boost/log/core/record.hpp>
 #include <boost/log/core/record_view.hpp>
@@ -95,6 +97,106 @@ BOOST_AUTO_TEST_CASE(attr_placeholders)
     }
 }
 
+// Tests for formatting of the standard attributes
+BOOST_AUTO_TEST_CASE(standard_attributes)
+{
+    const boost::posix_time::ptime time_stamp(boost::gregorian::date(2026, 1, 2), boost::posix_time::time_duration(3, 4, 5, 6007));
+    attr_set set1;
+    set1["TimeStamp"] = attrs::make_constant(time_stamp);
+    set1["Severity"] = attrs::make_constant(logging::trivial::warning);
+    set1["Channel"] = attrs::make_constant(std::string("net"));
+    set1["LineID"] = attrs::make_constant(42u);
+    set1["Message"] = attrs::make_constant(std::string("Hello"));
+
+    record_view rec = make_record_view(set1);
+
+    {
+        formatter f = logging::parse_formatter("%TimeStamp% [%Severity%] %Channel%#%LineID%: %Message%\\t%_%");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, "2026-01-02 03:04:05.006007 [warning] net#42: Hello\tHello");
+    }
+
+    // Values of types other than the commonly used ones are also supported
+    attr_set set2;
+    set2["TimeStamp"] = attrs::make_constant(boost::posix_time::ptime(boost::posix_time::not_a_date_time));
+    set2["Severity"] = attrs::make_constant(3);
+    set2["LineID"] = attrs::make_constant(std::string("n/a"));
+
+    rec = make_record_view(set2);
+
+    {
+        formatter f = logging::parse_formatter("%TimeStamp% [%Severity%] %Channel%#%LineID%: %Message%");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, "not-a-date-time [3] #n/a: ");
+    }
+
+    {
+        formatter f = logging::parse_formatter("");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK(str.empty());
+    }
+}
+
+// Tests for the JSON formatter placeholder
+BOOST_AUTO_TEST_CASE(json_placeholder)
+{
+    const boost::posix_time::ptime time_stamp(boost::gregorian::date(2026, 1, 2), boost::posix_time::time_duration(3, 4, 5, 6007));
+    attr_set set1;
+    set1["TimeStamp"] = attrs::make_constant(time_stamp);
+    set1["Severity"] = attrs::make_constant(logging::trivial::warning);
+    set1["Channel"] = attrs::make_constant(std::string("n\"e\tt"));
+    set1["LineID"] = attrs::make_constant(42u);
+
+    record_view rec = make_record_view(set1);
+
+    {
+        formatter f = logging::parse_formatter("%JSON(attributes=\"LineID, TimeStamp,Severity,Channel,Missing\")%");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, "{\"LineID\":42,\"TimeStamp\":\"2026-01-02 03:04:05.006007\",\"Severity\":\"warning\",\"Channel\":\"n\\\"e\\tt\"}");
+    }
+
+    attr_set set2;
+    set2["LineID"] = attrs::make_constant(1u);
+    rec = make_record_view(set2);
+
+    {
+        formatter f = logging::parse_formatter("json: %JSON()%");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, "json: {\"LineID\":1}");
+    }
+
+    // Without the argument list, the placeholder outputs the attribute named "JSON"
+    attr_set set3;
+    set3["JSON"] = attrs::make_constant(std::string("value"));
+    rec = make_record_view(set3);
+
+    {
+        formatter f = logging::parse_formatter("json: %JSON%");
+        std::string str;
+        osstream strm(str);
+        f(rec, strm);
+        strm.flush();
+        BOOST_CHECK_EQUAL(str, "json: value");
+    }
+
+    BOOST_CHECK_THROW(logging::parse_formatter("%JSON(attributes=\"A,,B\")%"), logging::parse_error);
+}
+
 namespace {
 
 class test_formatter_factory :
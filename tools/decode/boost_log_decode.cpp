@@ -0,0 +1,126 @@
+/*
+ *             Copyright Andrey Semashev 2026.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+/*!
+ * \file   boost_log_decode.cpp
+ * \author Andrey Semashev
+ * \date   17.10.2026
+ *
+ * \brief  The tool converts log files written by \c binary_file_backend to text.
+ *
+ * Usage: boost_log_decode [--format <formatter>] [--filter <filter>] <file>...
+ *
+ * The formatter and filter are specified in the same syntax as in the library settings.
+ * The decoded records are written to the standard output.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <exception>
+#include <boost/move/utility_core.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/exceptions.hpp>
+#include <boost/log/attributes/attribute_value_set.hpp>
+#include <boost/log/utility/binary_log_reader.hpp>
+#include <boost/log/utility/setup/console.hpp>
+#include <boost/log/utility/setup/filter_parser.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
+
+namespace logging = boost::log;
+namespace keywords = boost::log::keywords;
+
+namespace {
+
+void print_usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--format <formatter>] [--filter <filter>] <file>...\n"
+        "Converts binary log files to text. The formatter and filter use the library settings syntax,\n"
+        "the default formatter is \"%Message%\"." << std::endl;
+}
+
+//! Decodes the file and passes the records to the logging core. Returns \c false if the file is damaged.
+bool decode_file(boost::filesystem::path const& file_name)
+{
+    logging::core_ptr core = logging::core::get();
+    logging::binary_log_reader reader(file_name);
+    bool intact = true;
+    while (true)
+    {
+        logging::attribute_value_set values;
+        try
+        {
+            if (!reader.read(values))
+                break;
+        }
+        catch (logging::parse_error& e)
+        {
+            std::cerr << file_name.string() << ": " << e.what() << std::endl;
+            intact = false;
+            continue;
+        }
+
+        logging::record rec = core->open_record(boost::move(values));
+        if (rec)
+            core->push_record(boost::move(rec));
+    }
+
+    return intact;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string format = "%Message%";
+    std::string filter;
+    std::vector< boost::filesystem::path > files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+            format = argv[++i];
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (std::strcmp(argv[i], "--help") == 0 || argv[i][0] == '-')
+        {
+            print_usage(argv[0]);
+            return 2;
+        }
+        else
+            files.push_back(argv[i]);
+    }
+
+    if (files.empty())
+    {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    int result = 0;
+    try
+    {
+        logging::add_console_log(std::cout, keywords::format = logging::parse_formatter(format));
+        if (!filter.empty())
+            logging::core::get()->set_filter(logging::parse_filter(filter));
+
+        for (std::vector< boost::filesystem::path >::const_iterator it = files.begin(), end = files.end(); it != end; ++it)
+        {
+            if (!decode_file(*it))
+                result = 1;
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        result = 1;
+    }
+
+    logging::core::get()->flush();
+    return result;
+}